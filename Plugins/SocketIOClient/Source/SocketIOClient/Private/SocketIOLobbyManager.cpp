@@ -70,6 +70,13 @@ void USocketIOLobbyManager::Initialize(UWorld* WorldContext)
     // Bind events
     SocketIOClient->OnConnected.AddDynamic(this, &USocketIOLobbyManager::HandleConnected);
     SocketIOClient->OnDisconnected.AddDynamic(this, &USocketIOLobbyManager::HandleDisconnected);
+    SocketIOClient->OnNativeEvent(TEXT("receiveBrushStrokes"), [this](const FString& Event, const TSharedPtr<FJsonValue>& Message)
+    {
+        if (FJsonValueBinary::IsBinary(Message))
+        {
+            OnBrushStrokesReceived.Broadcast(FJsonValueBinary::AsBinary(Message));
+        }
+    });
 
     bIsInitialized = true;
     
@@ -127,6 +134,17 @@ void USocketIOLobbyManager::JoinLobby(const FString& LobbyId)
     SocketIOClient->Emit(TEXT("joinLobby"), JsonValue);
 }
 
+void USocketIOLobbyManager::SendBrushStrokes(const FString& LobbyName, const TArray<uint8>& Payload)
+{
+    if (!IsConnected() || !SocketIOClient || Payload.Num() == 0) return;
+
+    // Goes out as a socket.io binary attachment, not base64 or a JSON number array
+    TSharedPtr<FJsonObject> Message = MakeShareable(new FJsonObject);
+    Message->SetStringField(TEXT("lobbyName"), LobbyName);
+    Message->SetField(TEXT("strokes"), MakeShareable(new FJsonValueBinary(Payload)));
+    SocketIOClient->EmitNative(TEXT("sendBrushStrokes"), Message);
+}
+
 void USocketIOLobbyManager::HandleConnected(FString SocketId, FString SessionId, bool bReconnected)
 {
     OnConnected(SocketId, SessionId, bReconnected);
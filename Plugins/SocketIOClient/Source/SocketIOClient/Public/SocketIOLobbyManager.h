@@ -7,6 +7,7 @@
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnLobbyConnected, const FString&, SocketId, const FString&, SessionId);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnLobbyDisconnected, TEnumAsByte<ESIOConnectionCloseReason>, Reason);
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnLobbyBrushStrokes, const TArray<uint8>& /*Payload*/);
 
 UCLASS(BlueprintType, Blueprintable)
 class SOCKETIOCLIENT_API USocketIOLobbyManager : public UObject
@@ -40,6 +41,11 @@ public:
     UPROPERTY(BlueprintAssignable, Category = "SocketIO|Lobby")
     FOnLobbyDisconnected OnLobbyDisconnected;
 
+    // Binary brush stroke batches, relayed by digger-network to everyone else in the lobby. C++ only.
+    void SendBrushStrokes(const FString& LobbyName, const TArray<uint8>& Payload);
+
+    FOnLobbyBrushStrokes OnBrushStrokesReceived;
+
 protected:
     UFUNCTION()
     void HandleConnected(FString SocketId, FString SessionId, bool bReconnected);
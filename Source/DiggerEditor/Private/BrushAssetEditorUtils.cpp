@@ -6,6 +6,7 @@
 #include "Misc/Paths.h"
 #include "HAL/PlatformFilemanager.h"
 #include "Async/ParallelFor.h"
+#include "FTriangleBVH.h"
 
 bool FBrushAssetEditorUtils::SaveSDFBrushToFile(const FCustomSDFBrush& Brush, const FString& FilePath)
 {
@@ -59,65 +60,246 @@ bool FBrushAssetEditorUtils::LoadSDFBrushFromFile(const FString& FilePath, FCust
     return true;
 }
 
+namespace
+{
+    // Exact distances are only computed this many voxels from the surface, the rest comes from fast sweeping
+    constexpr float NarrowBandVoxels = 3.0f;
+
+    // Empty voxels around the mesh so carving brushes have an outside to fade into
+    constexpr int32 BoundsPaddingVoxels = 2;
+
+    // Inside/outside by ray parity along each axis. A voxel is inside when at least two of the three axes
+    // agree, which papers over rays grazing an edge or slipping through a small hole.
+    void ComputeInsideMask(const FTriangleBVH& BVH, const FVector& Min, const FIntVector& Dims, float VoxelSize, TArray<bool>& OutInside)
+    {
+        const int32 NumVoxels = Dims.X * Dims.Y * Dims.Z;
+        TArray<uint8> Votes;
+        Votes.SetNumZeroed(NumVoxels);
+
+        for (int32 Axis = 0; Axis < 3; ++Axis)
+        {
+            const int32 U = (Axis + 1) % 3;
+            const int32 V = (Axis + 2) % 3;
+            const int32 NumU = Dims[U];
+            const int32 NumV = Dims[V];
+            const int32 NumAlong = Dims[Axis];
+
+            // Each row only touches its own voxels, so rows run in parallel
+            ParallelFor(NumU * NumV, [&](int32 RowIndex)
+            {
+                FIntVector Cell(0, 0, 0);
+                Cell[U] = RowIndex % NumU;
+                Cell[V] = RowIndex / NumU;
+
+                FVector3f Origin;
+                Origin[U] = (float)(Min[U] + (Cell[U] + 0.5f) * VoxelSize);
+                Origin[V] = (float)(Min[V] + (Cell[V] + 0.5f) * VoxelSize);
+                Origin[Axis] = 0.0f;
+
+                TArray<float, TInlineAllocator<32>> Hits;
+                TArray<float> HitScratch;
+                BVH.AxisLineHits(Origin, Axis, HitScratch);
+                if (HitScratch.Num() < 2)
+                {
+                    return;
+                }
+                HitScratch.Sort();
+
+                // A crossing on a shared edge is reported by both triangles, count it once
+                const float MergeDistance = VoxelSize * 1e-3f;
+                for (const float Hit : HitScratch)
+                {
+                    if (Hits.Num() == 0 || Hit - Hits.Last() > MergeDistance)
+                    {
+                        Hits.Add(Hit);
+                    }
+                }
+
+                int32 NextHit = 0;
+                for (int32 Step = 0; Step < NumAlong; ++Step)
+                {
+                    const float Coord = (float)(Min[Axis] + (Step + 0.5f) * VoxelSize);
+                    while (NextHit < Hits.Num() && Hits[NextHit] < Coord)
+                    {
+                        ++NextHit;
+                    }
+                    if (NextHit & 1)
+                    {
+                        Cell[Axis] = Step;
+                        ++Votes[Cell.X + Cell.Y * Dims.X + Cell.Z * Dims.X * Dims.Y];
+                    }
+                }
+            });
+        }
+
+        OutInside.SetNumUninitialized(NumVoxels);
+        for (int32 Index = 0; Index < NumVoxels; ++Index)
+        {
+            OutInside[Index] = Votes[Index] >= 2;
+        }
+    }
+
+    // Godunov upwind update of the eikonal equation |grad d| = 1 from the smallest neighbour on each axis
+    FORCEINLINE float SolveEikonal(float A, float B, float C, float H)
+    {
+        // Sort so A <= B <= C
+        if (A > B) Swap(A, B);
+        if (B > C) Swap(B, C);
+        if (A > B) Swap(A, B);
+
+        float Result = A + H;
+        if (Result > B)
+        {
+            Result = 0.5f * (A + B + FMath::Sqrt(FMath::Max(0.0f, 2.0f * H * H - FMath::Square(A - B))));
+            if (Result > C)
+            {
+                const float Sum = A + B + C;
+                const float Discriminant = Sum * Sum - 3.0f * (A * A + B * B + C * C - H * H);
+                Result = (Sum + FMath::Sqrt(FMath::Max(0.0f, Discriminant))) / 3.0f;
+            }
+        }
+        return Result;
+    }
+
+    // Fills every voxel outside the narrow band (Frozen == false) with the distance propagated from the band,
+    // one Gauss-Seidel pass per sweep direction
+    void FastSweepUnsignedDistance(TArray<float>& Distance, const TArray<bool>& Frozen, const FIntVector& Dims, float VoxelSize)
+    {
+        auto At = [&Distance, &Dims](int32 X, int32 Y, int32 Z) -> float
+        {
+            if (X < 0 || Y < 0 || Z < 0 || X >= Dims.X || Y >= Dims.Y || Z >= Dims.Z)
+            {
+                return MAX_flt;
+            }
+            return Distance[X + Y * Dims.X + Z * Dims.X * Dims.Y];
+        };
+
+        for (int32 Sweep = 0; Sweep < 8; ++Sweep)
+        {
+            const int32 StepX = (Sweep & 1) ? -1 : 1;
+            const int32 StepY = (Sweep & 2) ? -1 : 1;
+            const int32 StepZ = (Sweep & 4) ? -1 : 1;
+
+            for (int32 IZ = 0; IZ < Dims.Z; ++IZ)
+            {
+                const int32 Z = StepZ > 0 ? IZ : Dims.Z - 1 - IZ;
+                for (int32 IY = 0; IY < Dims.Y; ++IY)
+                {
+                    const int32 Y = StepY > 0 ? IY : Dims.Y - 1 - IY;
+                    for (int32 IX = 0; IX < Dims.X; ++IX)
+                    {
+                        const int32 X = StepX > 0 ? IX : Dims.X - 1 - IX;
+                        const int32 Index = X + Y * Dims.X + Z * Dims.X * Dims.Y;
+                        if (Frozen[Index])
+                        {
+                            continue;
+                        }
+
+                        const float A = FMath::Min(At(X - 1, Y, Z), At(X + 1, Y, Z));
+                        const float B = FMath::Min(At(X, Y - 1, Z), At(X, Y + 1, Z));
+                        const float C = FMath::Min(At(X, Y, Z - 1), At(X, Y, Z + 1));
+                        if (A == MAX_flt && B == MAX_flt && C == MAX_flt)
+                        {
+                            continue;
+                        }
+                        Distance[Index] = FMath::Min(Distance[Index], SolveEikonal(A, B, C, VoxelSize));
+                    }
+                }
+            }
+        }
+    }
+}
+
 bool FBrushAssetEditorUtils::GenerateSDFBrushFromStaticMesh(UStaticMesh* Mesh, const FTransform& MeshTransform, float InVoxelSize, FCustomSDFBrush& OutBrush)
 {
 #if WITH_EDITOR
-    if (!Mesh || !Mesh->GetRenderData() || Mesh->GetRenderData()->LODResources.Num() == 0)
+    if (!Mesh || !Mesh->GetRenderData() || Mesh->GetRenderData()->LODResources.Num() == 0 || InVoxelSize <= 0.0f)
         return false;
 
     const FStaticMeshLODResources& LOD = Mesh->GetRenderData()->LODResources[0];
     const FPositionVertexBuffer& PosBuffer = LOD.VertexBuffers.PositionVertexBuffer;
     const FRawStaticIndexBuffer& IndexBuffer = LOD.IndexBuffer;
 
-    // Determine bounds
+    // Transform every vertex once, up front
+    TArray<FVector3f> Vertices;
+    Vertices.SetNumUninitialized(PosBuffer.GetNumVertices());
     FBox LocalBounds(ForceInit);
     for (uint32 i = 0; i < PosBuffer.GetNumVertices(); ++i)
     {
-        FVector WorldPos = MeshTransform.TransformPosition((FVector)PosBuffer.VertexPosition(i));
+        const FVector WorldPos = MeshTransform.TransformPosition((FVector)PosBuffer.VertexPosition(i));
+        Vertices[i] = (FVector3f)WorldPos;
         LocalBounds += WorldPos;
     }
 
-    FVector Extents = LocalBounds.GetSize();
-    FVector Min = LocalBounds.Min;
+    TArray<FIntVector> Triangles;
+    Triangles.Reserve(IndexBuffer.GetNumIndices() / 3);
+    for (int32 TriIdx = 0; TriIdx + 2 < IndexBuffer.GetNumIndices(); TriIdx += 3)
+    {
+        Triangles.Add(FIntVector(IndexBuffer.GetIndex(TriIdx), IndexBuffer.GetIndex(TriIdx + 1), IndexBuffer.GetIndex(TriIdx + 2)));
+    }
+    if (Triangles.Num() == 0)
+        return false;
+
+    const double StartTime = FPlatformTime::Seconds();
+
+    FTriangleBVH BVH;
+    BVH.Build(MoveTemp(Vertices), MoveTemp(Triangles));
+
+    const FVector Min = LocalBounds.Min - FVector(BoundsPaddingVoxels * InVoxelSize);
+    const FVector Extents = LocalBounds.GetSize() + FVector(2 * BoundsPaddingVoxels * InVoxelSize);
 
     FIntVector Dimensions = FIntVector(
-        FMath::CeilToInt(Extents.X / InVoxelSize),
-        FMath::CeilToInt(Extents.Y / InVoxelSize),
-        FMath::CeilToInt(Extents.Z / InVoxelSize)
+        FMath::Max(1, FMath::CeilToInt(Extents.X / InVoxelSize)),
+        FMath::Max(1, FMath::CeilToInt(Extents.Y / InVoxelSize)),
+        FMath::Max(1, FMath::CeilToInt(Extents.Z / InVoxelSize))
     );
+    const int32 NumVoxels = Dimensions.X * Dimensions.Y * Dimensions.Z;
 
     OutBrush.Dimensions = Dimensions;
     OutBrush.VoxelSize = InVoxelSize;
     OutBrush.OriginOffset = Min;
-    OutBrush.SDFValues.SetNumZeroed(Dimensions.X * Dimensions.Y * Dimensions.Z);
+    OutBrush.SDFValues.SetNumUninitialized(NumVoxels);
+
+    // Narrow band: exact distance to the nearest triangle, the BVH query gives up past the band
+    const float BandRadius = NarrowBandVoxels * InVoxelSize;
+    const float BandRadiusSq = BandRadius * BandRadius;
+    TArray<bool> Frozen;
+    Frozen.SetNumZeroed(NumVoxels);
 
-    // Voxel center sampling
-    ParallelFor(Dimensions.X, [&](int32 X)
+    ParallelFor(Dimensions.Z, [&](int32 Z)
     {
         for (int32 Y = 0; Y < Dimensions.Y; ++Y)
-        for (int32 Z = 0; Z < Dimensions.Z; ++Z)
+        for (int32 X = 0; X < Dimensions.X; ++X)
         {
-            FVector SamplePoint = Min + FVector(X + 0.5f, Y + 0.5f, Z + 0.5f) * InVoxelSize;
-            float ClosestDistance = FLT_MAX;
-
-            // Iterate triangles
-            for (int32 TriIdx = 0; TriIdx < IndexBuffer.GetNumIndices(); TriIdx += 3)
-            {
-                FVector V0 = MeshTransform.TransformPosition((FVector)PosBuffer.VertexPosition(IndexBuffer.GetIndex(TriIdx)));
-                FVector V1 = MeshTransform.TransformPosition((FVector)PosBuffer.VertexPosition(IndexBuffer.GetIndex(TriIdx + 1)));
-                FVector V2 = MeshTransform.TransformPosition((FVector)PosBuffer.VertexPosition(IndexBuffer.GetIndex(TriIdx + 2)));
+            const FVector SamplePoint = Min + FVector(X + 0.5f, Y + 0.5f, Z + 0.5f) * InVoxelSize;
+            const float DistSq = BVH.ClosestDistSq((FVector3f)SamplePoint, BandRadiusSq);
 
-                FVector Closest = FMath::ClosestPointOnTriangleToPoint(SamplePoint, V0, V1, V2);
-                float Dist = FVector::Dist(SamplePoint, Closest);
+            const int32 Index = OutBrush.GetIndex(X, Y, Z);
+            const bool bInBand = DistSq < BandRadiusSq;
+            OutBrush.SDFValues[Index] = bInBand ? FMath::Sqrt(DistSq) : MAX_flt;
+            Frozen[Index] = bInBand;
+        }
+    });
 
-                if (Dist < ClosestDistance)
-                    ClosestDistance = Dist;
-            }
+    // Far field: propagate the band outwards
+    FastSweepUnsignedDistance(OutBrush.SDFValues, Frozen, Dimensions, InVoxelSize);
 
-            int32 Index = OutBrush.GetIndex(X, Y, Z);
-            OutBrush.SDFValues[Index] = ClosestDistance;
+    // Sign, negative inside like the terrain SDF
+    TArray<bool> Inside;
+    ComputeInsideMask(BVH, Min, Dimensions, InVoxelSize, Inside);
+    for (int32 Index = 0; Index < NumVoxels; ++Index)
+    {
+        if (Inside[Index])
+        {
+            OutBrush.SDFValues[Index] = -OutBrush.SDFValues[Index];
         }
-    });
+    }
+
+    if (DiggerDebug::IO)
+    {
+        UE_LOG(LogTemp, Log, TEXT("Generated SDF brush from %s: %d triangles, %dx%dx%d voxels in %.2fs"),
+            *Mesh->GetName(), BVH.NumTriangles(), Dimensions.X, Dimensions.Y, Dimensions.Z, FPlatformTime::Seconds() - StartTime);
+    }
 
     return true;
 #else
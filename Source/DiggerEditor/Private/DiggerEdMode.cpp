@@ -15,6 +15,7 @@
 #include "Engine/Selection.h"
 #include "Engine/StaticMeshActor.h"
 #include "Toolkits/ToolkitManager.h"
+#include "VoxelChunk.h"
 
 #define LOCTEXT_NAMESPACE "DiggerEditorMode"
 
@@ -45,6 +46,10 @@ void FDiggerEdMode::Enter()
     }
 }void FDiggerEdMode::Exit()
 {
+    // Leaving mid-drag would otherwise keep the manager recording forever
+    FlushPendingStamps();
+    EndStrokeUndoGroup();
+
     if (Toolkit.IsValid())
     {
         FDiggerEditorAccess::SetEditorModeActive(false); // ✅ fire broadcast
@@ -262,10 +267,26 @@ bool FDiggerEdMode::InputKey(FEditorViewportClient* ViewportClient, FViewport* V
         return true;
     }
 
+    // Voxel undo / redo while painting, the editor transaction system doesn't know about voxel edits.
+    // With no voxel step to pop the key goes on to the editor's own undo.
+    if (bPaintingEnabled && Event == IE_Pressed && !bMouseButtonDown
+        && (Viewport->KeyState(EKeys::LeftControl) || Viewport->KeyState(EKeys::RightControl))
+        && (Key == EKeys::Z || Key == EKeys::Y))
+    {
+        if (ADiggerManager* Digger = FindDiggerManager())
+        {
+            if (Key == EKeys::Z ? Digger->UndoVoxelEdit() : Digger->RedoVoxelEdit())
+            {
+                return true;
+            }
+        }
+    }
+
     if (bPaintingEnabled && (Key == EKeys::LeftMouseButton || Key == EKeys::RightMouseButton))
     {
         if (Event == IE_Pressed)
         {
+            BeginStrokeUndoGroup();
             bMouseButtonDown = true;
             bIsContinuouslyApplying = true;
             bIsPainting = true;
@@ -392,8 +413,34 @@ void FDiggerEdMode::StartContinuousApplication(const FViewportClick& Click)
     ContinuousApplicationTimer = 0.0f;
 }
 
+void FDiggerEdMode::BeginStrokeUndoGroup()
+{
+    if (UndoGroupManager.IsValid())
+    {
+        return;
+    }
+    if (ADiggerManager* Digger = FindDiggerManager())
+    {
+        Digger->BeginUndoGroup();
+        UndoGroupManager = Digger;
+    }
+}
+
+void FDiggerEdMode::EndStrokeUndoGroup()
+{
+    if (ADiggerManager* Digger = UndoGroupManager.Get())
+    {
+        Digger->EndUndoGroup();
+    }
+    UndoGroupManager.Reset();
+}
+
 void FDiggerEdMode::StopContinuousApplication()
 {
+    // InputKey clears bIsContinuouslyApplying before it gets here, so close the stroke regardless
+    FlushPendingStamps();
+    EndStrokeUndoGroup();
+
     if (bIsContinuouslyApplying)
     {
         bIsContinuouslyApplying = false;
@@ -492,8 +539,52 @@ void FDiggerEdMode::ApplyContinuousBrush(FEditorViewportClient* InViewportClient
 
         Digger->EditorBrushOffset = FinalOffset;
         Digger->EditorBrushPosition = HitLocation;
-        Digger->ApplyBrushInEditor(ContinuousSettings.bFinalBrushDig);
+
+        // Light brushes place actors, nothing to coalesce
+        if (Digger->EditorBrushType == EVoxelBrushType::Light)
+        {
+            Digger->ApplyBrushInEditor(ContinuousSettings.bFinalBrushDig);
+            return;
+        }
+        QueueBrushStamp(Digger, Digger->MakeEditorBrushStroke(ContinuousSettings.bFinalBrushDig));
+    }
+}
+
+void FDiggerEdMode::QueueBrushStamp(ADiggerManager* Digger, FBrushStroke&& Stamp)
+{
+    if (PendingStamps.Num() > 0)
+    {
+        const FBrushStroke& Last = PendingStamps.Last();
+
+        // The union only makes sense for stamps of the same kind and manager
+        if (PendingStampManager.Get() != Digger || Last.bDig != Stamp.bDig || Last.BrushType != Stamp.BrushType
+            || PendingStamps.Num() >= UVoxelChunk::MaxStrokesPerPass)
+        {
+            FlushPendingStamps();
+        }
+        // Tick and the mouse handlers can all stamp the same spot in one frame, the union of those is one stamp
+        else if (FVector::DistSquared(Last.BrushPosition, Stamp.BrushPosition) <= FMath::Square(Stamp.BrushRadius * 0.01f)
+            && Last.BrushRotation.Equals(Stamp.BrushRotation) && Last.BrushRadius == Stamp.BrushRadius)
+        {
+            return;
+        }
+    }
+
+    PendingStampManager = Digger;
+    PendingStamps.Add(MoveTemp(Stamp));
+}
+
+void FDiggerEdMode::FlushPendingStamps()
+{
+    if (ADiggerManager* Digger = PendingStampManager.Get())
+    {
+        if (PendingStamps.Num() > 0)
+        {
+            Digger->ApplyBrushStrokesInEditor(PendingStamps);
+        }
     }
+    PendingStamps.Reset();
+    PendingStampManager.Reset();
 }
 
 bool FDiggerEdMode::ShouldApplyContinuously() const
@@ -517,6 +608,9 @@ void FDiggerEdMode::Tick(FEditorViewportClient* ViewportClient, float DeltaTime)
         ContinuousApplicationTimer = 0.0f;
     }
 
+    // Everything stamped this frame, by Tick or the mouse handlers, goes in as one pass
+    FlushPendingStamps();
+
     if (GEditor)
     {
         GEditor->RedrawAllViewports();
@@ -6,6 +6,7 @@
 #include "EdMode.h"
 #include "EditorModeManager.h"
 #include "DiggerEdModeToolkit.h"
+#include "FBrushStroke.h"
 
 class ADiggerManager;
 
@@ -65,6 +66,18 @@ private:
     float ContinuousApplicationTimer = 0.0f;
     float ContinuousApplicationInterval = 0.05f;
 
+    // Manager holding the open undo group for the current drag, one drag = one undo step
+    TWeakObjectPtr<ADiggerManager> UndoGroupManager;
+    void BeginStrokeUndoGroup();
+    void EndStrokeUndoGroup();
+
+    // Stamps gathered since the last Tick, applied together as one union so overlapping stamps of a drag
+    // touch each chunk and voxel once per frame
+    TArray<FBrushStroke> PendingStamps;
+    TWeakObjectPtr<ADiggerManager> PendingStampManager;
+    void QueueBrushStamp(ADiggerManager* Digger, FBrushStroke&& Stamp);
+    void FlushPendingStamps();
+
     struct FContinuousClickSettings
     {
         bool bFinalBrushDig = false;
@@ -0,0 +1,221 @@
+// FTriangleBVH.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include <algorithm>
+
+// Bounding volume hierarchy over a triangle soup, built once and then queried from any number of threads.
+// Used by the mesh -> SDF brush conversion: closest distance for the narrow band, axis rays for inside/outside.
+class FTriangleBVH
+{
+public:
+	static constexpr int32 MaxLeafTriangles = 4;
+
+	void Build(TArray<FVector3f>&& InVertices, TArray<FIntVector>&& InTriangles)
+	{
+		Vertices = MoveTemp(InVertices);
+		Triangles = MoveTemp(InTriangles);
+		Nodes.Reset();
+
+		const int32 NumTriangles = Triangles.Num();
+		TriangleOrder.SetNumUninitialized(NumTriangles);
+		TArray<FVector3f> Centroids;
+		Centroids.SetNumUninitialized(NumTriangles);
+		for (int32 Index = 0; Index < NumTriangles; ++Index)
+		{
+			TriangleOrder[Index] = Index;
+			const FIntVector& Tri = Triangles[Index];
+			Centroids[Index] = (Vertices[Tri.X] + Vertices[Tri.Y] + Vertices[Tri.Z]) / 3.0f;
+		}
+
+		if (NumTriangles > 0)
+		{
+			Nodes.Reserve(NumTriangles);
+			Nodes.AddDefaulted();
+			BuildNode(0, 0, NumTriangles, Centroids);
+		}
+	}
+
+	bool IsEmpty() const { return Nodes.Num() == 0; }
+	int32 NumTriangles() const { return Triangles.Num(); }
+
+	// Squared distance from Point to the nearest triangle, or MaxDistSq when nothing is closer than that
+	float ClosestDistSq(const FVector3f& Point, float MaxDistSq) const
+	{
+		float BestDistSq = MaxDistSq;
+		if (IsEmpty())
+		{
+			return BestDistSq;
+		}
+
+		int32 Stack[64];
+		int32 StackSize = 0;
+		Stack[StackSize++] = 0;
+
+		while (StackSize > 0)
+		{
+			const FNode& Node = Nodes[Stack[--StackSize]];
+			if (BoxDistSq(Node.Bounds, Point) >= BestDistSq)
+			{
+				continue;
+			}
+
+			if (Node.Count > 0)
+			{
+				for (int32 Index = Node.First; Index < Node.First + Node.Count; ++Index)
+				{
+					const FIntVector& Tri = Triangles[TriangleOrder[Index]];
+					const FVector Closest = FMath::ClosestPointOnTriangleToPoint(
+						FVector(Point), FVector(Vertices[Tri.X]), FVector(Vertices[Tri.Y]), FVector(Vertices[Tri.Z]));
+					BestDistSq = FMath::Min(BestDistSq, (float)FVector::DistSquared(Closest, FVector(Point)));
+				}
+				continue;
+			}
+
+			// Nearer child last so it pops first and tightens the bound early
+			const int32 Left = Node.First;
+			const int32 Right = Node.First + 1;
+			const bool bLeftNearer = BoxDistSq(Nodes[Left].Bounds, Point) <= BoxDistSq(Nodes[Right].Bounds, Point);
+			if (StackSize + 2 <= UE_ARRAY_COUNT(Stack))
+			{
+				Stack[StackSize++] = bLeftNearer ? Right : Left;
+				Stack[StackSize++] = bLeftNearer ? Left : Right;
+			}
+		}
+		return BestDistSq;
+	}
+
+	// Every crossing of the infinite line through Origin along Axis (0 = X, 1 = Y, 2 = Z), as the coordinate
+	// on that axis. Unsorted, a crossing right on a shared edge may be reported once per triangle.
+	void AxisLineHits(const FVector3f& Origin, int32 Axis, TArray<float>& OutHits) const
+	{
+		if (IsEmpty())
+		{
+			return;
+		}
+
+		const int32 U = (Axis + 1) % 3;
+		const int32 V = (Axis + 2) % 3;
+		const float PU = Origin[U];
+		const float PV = Origin[V];
+
+		int32 Stack[64];
+		int32 StackSize = 0;
+		Stack[StackSize++] = 0;
+
+		while (StackSize > 0)
+		{
+			const FNode& Node = Nodes[Stack[--StackSize]];
+			if (PU < Node.Bounds.Min[U] || PU > Node.Bounds.Max[U] || PV < Node.Bounds.Min[V] || PV > Node.Bounds.Max[V])
+			{
+				continue;
+			}
+
+			if (Node.Count > 0)
+			{
+				for (int32 Index = Node.First; Index < Node.First + Node.Count; ++Index)
+				{
+					const FIntVector& Tri = Triangles[TriangleOrder[Index]];
+					float Hit;
+					if (IntersectAxisLine(Vertices[Tri.X], Vertices[Tri.Y], Vertices[Tri.Z], Axis, PU, PV, Hit))
+					{
+						OutHits.Add(Hit);
+					}
+				}
+				continue;
+			}
+
+			if (StackSize + 2 <= UE_ARRAY_COUNT(Stack))
+			{
+				Stack[StackSize++] = Node.First;
+				Stack[StackSize++] = Node.First + 1;
+			}
+		}
+	}
+
+private:
+	// Leaves (Count > 0) own TriangleOrder[First, First + Count), inner nodes have children First and First + 1
+	struct FNode
+	{
+		FBox3f Bounds;
+		int32 First = 0;
+		int32 Count = 0;
+	};
+
+	TArray<FVector3f> Vertices;
+	TArray<FIntVector> Triangles;
+	TArray<int32> TriangleOrder;
+	TArray<FNode> Nodes;
+
+	// Fills the already allocated node NodeIndex with TriangleOrder[Begin, End)
+	void BuildNode(int32 NodeIndex, int32 Begin, int32 End, const TArray<FVector3f>& Centroids)
+	{
+		FBox3f Bounds(ForceInit);
+		FBox3f CentroidBounds(ForceInit);
+		for (int32 Index = Begin; Index < End; ++Index)
+		{
+			const FIntVector& Tri = Triangles[TriangleOrder[Index]];
+			Bounds += Vertices[Tri.X];
+			Bounds += Vertices[Tri.Y];
+			Bounds += Vertices[Tri.Z];
+			CentroidBounds += Centroids[TriangleOrder[Index]];
+		}
+		Nodes[NodeIndex].Bounds = Bounds;
+
+		const FVector3f Extent = CentroidBounds.GetSize();
+		if (End - Begin <= MaxLeafTriangles || Extent.GetMax() <= 0.0f)
+		{
+			Nodes[NodeIndex].First = Begin;
+			Nodes[NodeIndex].Count = End - Begin;
+			return;
+		}
+
+		// Median split on the widest centroid axis keeps the tree balanced whatever the triangle sizes
+		const int32 Axis = Extent.X >= Extent.Y && Extent.X >= Extent.Z ? 0 : (Extent.Y >= Extent.Z ? 1 : 2);
+		const int32 Mid = Begin + (End - Begin) / 2;
+		int32* Order = TriangleOrder.GetData();
+		std::nth_element(Order + Begin, Order + Mid, Order + End, [&Centroids, Axis](int32 A, int32 B)
+		{
+			return Centroids[A][Axis] < Centroids[B][Axis];
+		});
+
+		// Children are allocated as a pair so the right one is always First + 1
+		const int32 Left = Nodes.AddDefaulted(2);
+		Nodes[NodeIndex].First = Left;
+		Nodes[NodeIndex].Count = 0;
+		BuildNode(Left, Begin, Mid, Centroids);
+		BuildNode(Left + 1, Mid, End, Centroids);
+	}
+
+	static float BoxDistSq(const FBox3f& Box, const FVector3f& Point)
+	{
+		const FVector3f Clamped(
+			FMath::Clamp(Point.X, Box.Min.X, Box.Max.X),
+			FMath::Clamp(Point.Y, Box.Min.Y, Box.Max.Y),
+			FMath::Clamp(Point.Z, Box.Min.Z, Box.Max.Z));
+		return FVector3f::DistSquared(Clamped, Point);
+	}
+
+	// 2D point-in-triangle on the two other axes, then the plane gives the crossing along Axis
+	static bool IntersectAxisLine(const FVector3f& A, const FVector3f& B, const FVector3f& C, int32 Axis, float PU, float PV, float& OutHit)
+	{
+		const int32 U = (Axis + 1) % 3;
+		const int32 V = (Axis + 2) % 3;
+
+		const float E0 = (B[U] - A[U]) * (PV - A[V]) - (B[V] - A[V]) * (PU - A[U]);
+		const float E1 = (C[U] - B[U]) * (PV - B[V]) - (C[V] - B[V]) * (PU - B[U]);
+		const float E2 = (A[U] - C[U]) * (PV - C[V]) - (A[V] - C[V]) * (PU - C[U]);
+		const bool bAllPositive = E0 >= 0.0f && E1 >= 0.0f && E2 >= 0.0f;
+		const bool bAllNegative = E0 <= 0.0f && E1 <= 0.0f && E2 <= 0.0f;
+		const float Area = E0 + E1 + E2;
+		if ((!bAllPositive && !bAllNegative) || FMath::IsNearlyZero(Area))
+		{
+			// Outside, or the triangle is edge-on to the line
+			return false;
+		}
+
+		// Barycentric weights are the opposite edge functions over the doubled area
+		OutHit = (E1 * A[Axis] + E2 * B[Axis] + E0 * C[Axis]) / Area;
+		return true;
+	}
+};
@@ -0,0 +1,322 @@
+#include "DiggerBenchmark.h"
+#include "MarchingCubes.h"
+#include "SparseVoxelGrid.h"
+#include "Voxel/MarchingCubesEdgeCache.h"
+#include "Voxel/MarchingCubesTables.h"
+#include "Async/ParallelFor.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+
+namespace
+{
+	// Same dig pattern for both write paths: a sphere of air with a soft SDF falloff
+	float BenchmarkSDF(int32 X, int32 Y, int32 Z, int32 VoxelsPerSide)
+	{
+		const float Half = VoxelsPerSide * 0.5f;
+		const float Dist = FVector(X - Half, Y - Half, Z - Half).Size();
+		return FMath::Clamp(Half - Dist, -1.0f, 1.0f);
+	}
+}
+
+void FDiggerBenchmark::RunVoxelWriteComparison(int32 VoxelsPerSide, int32 Iterations, TArray<FDiggerBenchmarkResult>& OutResults)
+{
+	VoxelsPerSide = FMath::Max(1, VoxelsPerSide);
+	Iterations = FMath::Max(1, Iterations);
+
+	const int32 SliceSize = VoxelsPerSide * VoxelsPerSide;
+	const int32 TotalVoxels = SliceSize * VoxelsPerSide;
+
+	auto ToCoords = [VoxelsPerSide, SliceSize](int32 Index)
+	{
+		return FIntVector(Index % VoxelsPerSide, (Index / VoxelsPerSide) % VoxelsPerSide, Index / SliceSize);
+	};
+
+	// Current path: every worker takes the grid lock per voxel
+	{
+		FDiggerBenchmarkResult Result;
+		Result.Name = TEXT("VoxelWrites.SetVoxelLocked");
+		Result.Iterations = Iterations;
+		Result.ItemsPerIteration = TotalVoxels;
+
+		for (int32 Iter = 0; Iter < Iterations; ++Iter)
+		{
+			USparseVoxelGrid* Grid = NewObject<USparseVoxelGrid>();
+			const double Start = FPlatformTime::Seconds();
+
+			ParallelFor(TotalVoxels, [&](int32 Index)
+			{
+				const FIntVector Coords = ToCoords(Index);
+				Grid->SetVoxel(Coords.X, Coords.Y, Coords.Z, BenchmarkSDF(Coords.X, Coords.Y, Coords.Z, VoxelsPerSide), true);
+			});
+
+			Result.TotalSeconds += FPlatformTime::Seconds() - Start;
+			Grid->MarkAsGarbage();
+		}
+		OutResults.Add(Result);
+	}
+
+	// Batched path: per-worker buffers merged once
+	{
+		FDiggerBenchmarkResult Result;
+		Result.Name = TEXT("VoxelWrites.Batched");
+		Result.Iterations = Iterations;
+		Result.ItemsPerIteration = TotalVoxels;
+
+		for (int32 Iter = 0; Iter < Iterations; ++Iter)
+		{
+			USparseVoxelGrid* Grid = NewObject<USparseVoxelGrid>();
+			const double Start = FPlatformTime::Seconds();
+
+			TArray<FVoxelWriteBatch> Batches;
+			ParallelForWithTaskContext(Batches, TotalVoxels, [&](FVoxelWriteBatch& Batch, int32 Index)
+			{
+				const FIntVector Coords = ToCoords(Index);
+				Batch.Add(Coords, BenchmarkSDF(Coords.X, Coords.Y, Coords.Z, VoxelsPerSide), true);
+			});
+			Grid->ApplyWriteBatches(Batches);
+
+			Result.TotalSeconds += FPlatformTime::Seconds() - Start;
+			Grid->MarkAsGarbage();
+		}
+		OutResults.Add(Result);
+	}
+}
+
+void FDiggerBenchmark::RunMarchingCubesCellComparison(int32 CellsPerSide, int32 Iterations, TArray<FDiggerBenchmarkResult>& OutResults)
+{
+	CellsPerSide = FMath::Clamp(CellsPerSide, 1, 256);
+	Iterations = FMath::Max(1, Iterations);
+
+	const int32 N = CellsPerSide;
+	const int32 C = N + 1;
+	constexpr float VoxelSize = 25.0f;
+
+	// Same seed every run so the two paths and successive runs see identical cells
+	TArray<float> Field;
+	Field.SetNumUninitialized(C * C * C);
+	FRandomStream Random(1234);
+	for (float& Value : Field)
+	{
+		Value = Random.FRandRange(-1.0f, 1.0f);
+	}
+
+	int32 CornerDelta[8];
+	FIntVector CornerOffsets[8];
+	for (int32 i = 0; i < 8; ++i)
+	{
+		CornerOffsets[i] = UMarchingCubes::GetCornerOffset(i);
+		CornerDelta[i] = (CornerOffsets[i].X * C + CornerOffsets[i].Y) * C + CornerOffsets[i].Z;
+	}
+	FMarchingCubesEdgeCache::FEdgeSlot EdgeSlots[12];
+	FMarchingCubesEdgeCache::BuildEdgeSlots(CornerOffsets, EdgeConnection, EdgeSlots);
+
+	TArray<FVector> Vertices;
+	TArray<int32> Triangles;
+	TArray<FVector> Normals;
+
+	// The mesher's cell loop minus terrain / landscape handling, EmitCell does the per case part
+	auto RunCells = [&](auto&& EmitCell)
+	{
+		Vertices.Reset();
+		Triangles.Reset();
+		FMarchingCubesEdgeCache EdgeCache;
+		EdgeCache.Init(N);
+
+		for (int32 x = 0; x < N; ++x)
+		for (int32 y = 0; y < N; ++y)
+		{
+			if (y == 0 && x > 0)
+			{
+				EdgeCache.AdvanceX();
+			}
+			for (int32 z = 0; z < N; ++z)
+			{
+				const int32 CornerIndex = (x * C + y) * C + z;
+				float CornerValues[8];
+				FVector CornerPositions[8];
+				int32 CubeIndex = 0;
+				for (int32 i = 0; i < 8; ++i)
+				{
+					CornerValues[i] = Field[CornerIndex + CornerDelta[i]];
+					CornerPositions[i] = FVector(FIntVector(x, y, z) + CornerOffsets[i]) * VoxelSize;
+					CubeIndex |= (int32)(CornerValues[i] < 0.0f) << i;
+				}
+				if (CubeIndex == 0 || CubeIndex == 255)
+				{
+					continue;
+				}
+
+				auto ResolveEdge = [&](int32 Edge)
+				{
+					const FMarchingCubesEdgeCache::FEdgeSlot& Slot = EdgeSlots[Edge];
+					int32& VertexIndex = EdgeCache.Get(Slot, y, z);
+					if (VertexIndex == INDEX_NONE)
+					{
+						VertexIndex = Vertices.Add(UMarchingCubes::InterpolateVertex(CornerPositions[Slot.LowCorner], CornerPositions[Slot.HighCorner],
+							CornerValues[Slot.LowCorner], CornerValues[Slot.HighCorner]));
+					}
+					return VertexIndex;
+				};
+				EmitCell(CubeIndex, ResolveEdge);
+			}
+		}
+	};
+
+	auto AccumulateNormals = [&](bool bFlip)
+	{
+		Normals.SetNum(Vertices.Num(), false);
+		for (FVector& Normal : Normals)
+		{
+			Normal = FVector::ZeroVector;
+		}
+		for (int32 i = 0; i < Triangles.Num(); i += 3)
+		{
+			const FVector& A = Vertices[Triangles[i]];
+			const FVector& B = Vertices[Triangles[i + 1]];
+			const FVector& CV = Vertices[Triangles[i + 2]];
+			const FVector FaceNormal = bFlip ? FVector::CrossProduct(B - A, CV - A) : FVector::CrossProduct(CV - A, B - A);
+			Normals[Triangles[i]] += FaceNormal;
+			Normals[Triangles[i + 1]] += FaceNormal;
+			Normals[Triangles[i + 2]] += FaceNormal;
+		}
+		for (FVector& Normal : Normals)
+		{
+			Normal = bFlip ? -Normal.GetSafeNormal() : Normal.GetSafeNormal();
+		}
+	};
+
+	const int64 TotalCells = (int64)N * N * N;
+
+	// Old path: walk the triangle list to its -1, an edge cache lookup per index, normals flipped afterwards
+	{
+		FDiggerBenchmarkResult Result;
+		Result.Name = TEXT("MarchingCubes.TriangleTable");
+		Result.ItemsPerIteration = TotalCells;
+
+		for (int32 Iter = 0; Iter < Iterations; ++Iter)
+		{
+			const double Start = FPlatformTime::Seconds();
+			RunCells([&](int32 CubeIndex, auto& ResolveEdge)
+			{
+				for (int32 i = 0; TriangleConnectionTable[CubeIndex][i] != -1; i += 3)
+				{
+					for (int32 j = 0; j < 3; ++j)
+					{
+						Triangles.Add(ResolveEdge(TriangleConnectionTable[CubeIndex][i + j]));
+					}
+				}
+			});
+			AccumulateNormals(true);
+			Result.AddIteration(FPlatformTime::Seconds() - Start);
+		}
+		Result.Counters.Add(TEXT("triangles"), (double)(Triangles.Num() / 3));
+		OutResults.Add(Result);
+	}
+
+	// Packed cases: each crossed edge resolved once, indices copied to a count, normals already the engine's way round
+	{
+		FDiggerBenchmarkResult Result;
+		Result.Name = TEXT("MarchingCubes.PackedCases");
+		Result.ItemsPerIteration = TotalCells;
+
+		for (int32 Iter = 0; Iter < Iterations; ++Iter)
+		{
+			const double Start = FPlatformTime::Seconds();
+			RunCells([&](int32 CubeIndex, auto& ResolveEdge)
+			{
+				const FMarchingCubesCase& Case = MarchingCubesCases[CubeIndex];
+				int32 CellVertices[12];
+				for (int32 e = 0; e < Case.NumEdges; ++e)
+				{
+					CellVertices[e] = ResolveEdge(Case.Edges[e]);
+				}
+				const int32 FirstIndex = Triangles.AddUninitialized(Case.NumIndices);
+				int32* RESTRICT CellIndices = Triangles.GetData() + FirstIndex;
+				for (int32 i = 0; i < Case.NumIndices; ++i)
+				{
+					CellIndices[i] = CellVertices[Case.Indices[i]];
+				}
+			});
+			AccumulateNormals(false);
+			Result.AddIteration(FPlatformTime::Seconds() - Start);
+		}
+		Result.Counters.Add(TEXT("triangles"), (double)(Triangles.Num() / 3));
+		OutResults.Add(Result);
+	}
+}
+
+void FDiggerBenchmark::LogResults(const TArray<FDiggerBenchmarkResult>& Results)
+{
+	for (const FDiggerBenchmarkResult& Result : Results)
+	{
+		UE_LOG(LogTemp, Display, TEXT("[DiggerBenchmark] %-32s %8.3f ms/iter  %12.0f items/s  (%d iters)"),
+			*Result.Name, Result.GetMillisecondsPerIteration(), Result.GetItemsPerSecond(), Result.Iterations);
+	}
+}
+
+FString FDiggerBenchmark::ResultsToJson(const TArray<FDiggerBenchmarkResult>& Results, const TMap<FString, FString>& Meta)
+{
+	auto Quote = [](const FString& Value)
+	{
+		return FString::Printf(TEXT("\"%s\""), *Value.ReplaceCharWithEscapedChar());
+	};
+
+	FString Json = TEXT("{\n  \"meta\": {");
+	int32 MetaIndex = 0;
+	for (const TPair<FString, FString>& Pair : Meta)
+	{
+		Json += FString::Printf(TEXT("%s\n    %s: %s"), MetaIndex++ > 0 ? TEXT(",") : TEXT(""), *Quote(Pair.Key), *Quote(Pair.Value));
+	}
+	Json += TEXT("\n  },\n  \"results\": [");
+
+	for (int32 i = 0; i < Results.Num(); ++i)
+	{
+		const FDiggerBenchmarkResult& Result = Results[i];
+		Json += FString::Printf(TEXT("%s\n    {\"name\": %s, \"iterations\": %d, \"items_per_iteration\": %lld, ")
+			TEXT("\"total_ms\": %.4f, \"ms_per_iteration\": %.4f, \"min_ms\": %.4f, \"max_ms\": %.4f, \"items_per_second\": %.1f"),
+			i > 0 ? TEXT(",") : TEXT(""), *Quote(Result.Name), Result.Iterations, Result.ItemsPerIteration,
+			Result.TotalSeconds * 1000.0, Result.GetMillisecondsPerIteration(), Result.MinSeconds * 1000.0, Result.MaxSeconds * 1000.0,
+			Result.GetItemsPerSecond());
+
+		if (Result.Counters.Num() > 0)
+		{
+			Json += TEXT(", \"counters\": {");
+			int32 CounterIndex = 0;
+			for (const TPair<FString, double>& Counter : Result.Counters)
+			{
+				Json += FString::Printf(TEXT("%s%s: %.3f"), CounterIndex++ > 0 ? TEXT(", ") : TEXT(""), *Quote(Counter.Key), Counter.Value);
+			}
+			Json += TEXT("}");
+		}
+		Json += TEXT("}");
+	}
+
+	Json += TEXT("\n  ]\n}\n");
+	return Json;
+}
+
+static FAutoConsoleCommand GDiggerBenchVoxelWritesCmd(
+	TEXT("Digger.Bench.VoxelWrites"),
+	TEXT("Compare locked per-voxel writes with batched writes. Args: [VoxelsPerSide=64] [Iterations=5]"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		const int32 VoxelsPerSide = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 64;
+		const int32 Iterations = Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 5;
+
+		TArray<FDiggerBenchmarkResult> Results;
+		FDiggerBenchmark::RunVoxelWriteComparison(VoxelsPerSide, Iterations, Results);
+		FDiggerBenchmark::LogResults(Results);
+	}));
+
+static FAutoConsoleCommand GDiggerBenchMarchingCubesCmd(
+	TEXT("Digger.Bench.MarchingCubes"),
+	TEXT("Marching cubes cells per second, triangle table walk vs packed cases, on a random field. Args: [CellsPerSide=64] [Iterations=5]"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		const int32 CellsPerSide = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 64;
+		const int32 Iterations = Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 5;
+
+		TArray<FDiggerBenchmarkResult> Results;
+		FDiggerBenchmark::RunMarchingCubesCellComparison(CellsPerSide, Iterations, Results);
+		FDiggerBenchmark::LogResults(Results);
+	}));
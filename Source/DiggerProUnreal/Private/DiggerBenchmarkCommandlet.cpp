@@ -0,0 +1,274 @@
+#include "DiggerBenchmarkCommandlet.h"
+#include "DiggerBenchmark.h"
+#include "DiggerManager.h"
+#include "FBrushStroke.h"
+#include "MarchingCubes.h"
+#include "SparseVoxelGrid.h"
+#include "VoxelChunk.h"
+#include "VoxelConversion.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+
+namespace
+{
+	const TCHAR* BenchmarkSaveName = TEXT("DiggerBenchmark");
+
+	// Stand-in for a landscape: gentle rolling hills a few hundred units high
+	float BenchmarkTerrainHeight(float X, float Y)
+	{
+		return 400.0f * FMath::Sin(X * 0.0015f) * FMath::Cos(Y * 0.0012f) + 150.0f * FMath::Sin((X + Y) * 0.004f);
+	}
+
+	// Writes a narrow SDF band (a couple of voxels either side of the surface) so the chunk meshes like
+	// a real terrain skin without filling every voxel below it
+	void FillChunkWithTerrain(UVoxelChunk* Chunk, int32 VoxelsPerChunk, float VoxelSize)
+	{
+		USparseVoxelGrid* Grid = Chunk ? Chunk->GetSparseVoxelGrid() : nullptr;
+		if (!Grid)
+		{
+			return;
+		}
+
+		// Voxel centres as the brush path places them: half a chunk back from ChunkToWorld, plus half a voxel
+		const FIntVector ChunkCoords = Chunk->GetChunkCoordinates();
+		const FVector BrushOffset(VoxelSize * 0.5f - VoxelsPerChunk * VoxelSize * 0.5f);
+		constexpr int32 BandVoxels = 2;
+
+		TArray<FVoxelWriteBatch> Batches;
+		Batches.SetNum(1);
+		for (int32 X = -1; X <= VoxelsPerChunk; ++X)
+		{
+			for (int32 Y = -1; Y <= VoxelsPerChunk; ++Y)
+			{
+				const FVector Column = FVoxelConversion::ChunkVoxelToWorld(ChunkCoords, FIntVector(X, Y, 0)) + BrushOffset;
+				const float Height = BenchmarkTerrainHeight(Column.X, Column.Y);
+				const int32 SurfaceZ = FMath::FloorToInt((Height - Column.Z) / VoxelSize);
+				for (int32 Z = FMath::Max(-1, SurfaceZ - BandVoxels); Z <= FMath::Min(VoxelsPerChunk, SurfaceZ + BandVoxels); ++Z)
+				{
+					// Negative = solid
+					const float SDF = FMath::Clamp((Column.Z + Z * VoxelSize - Height) / VoxelSize, -1.0f, 1.0f);
+					Batches[0].Add(FIntVector(X, Y, Z), SDF, false);
+				}
+			}
+		}
+		Grid->ApplyWriteBatches(Batches);
+	}
+}
+
+UDiggerBenchmarkCommandlet::UDiggerBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UDiggerBenchmarkCommandlet::Main(const FString& Params)
+{
+	int32 ChunksPerSide = 4;
+	int32 StrokeCount = 64;
+	int32 Iterations = 3;
+	int32 MarchingCubesCells = 64;
+	FString OutputPath = FPaths::ProjectSavedDir() / TEXT("DiggerBenchmark.json");
+
+	FParse::Value(*Params, TEXT("Chunks="), ChunksPerSide);
+	FParse::Value(*Params, TEXT("Strokes="), StrokeCount);
+	FParse::Value(*Params, TEXT("Iterations="), Iterations);
+	FParse::Value(*Params, TEXT("MCCells="), MarchingCubesCells);
+	FParse::Value(*Params, TEXT("Output="), OutputPath);
+	ChunksPerSide = FMath::Clamp(ChunksPerSide, 1, 32);
+	StrokeCount = FMath::Max(0, StrokeCount);
+	Iterations = FMath::Max(1, Iterations);
+
+	// Bare game world, nothing ticks and no BeginPlay, the manager is driven by hand below
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("DiggerBenchmarkWorld"));
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(World);
+
+	ADiggerManager* Manager = World->SpawnActor<ADiggerManager>();
+	if (!Manager)
+	{
+		UE_LOG(LogTemp, Error, TEXT("[DiggerBenchmark] Failed to spawn ADiggerManager"));
+		GEngine->DestroyWorldContext(World);
+		World->DestroyWorld(false);
+		return 1;
+	}
+
+	FVoxelConversion::InitFromConfig(Manager->ChunkSize, Manager->Subdivisions, Manager->TerrainGridSize, Manager->GetActorLocation());
+	Manager->InitializeBrushShapes();
+
+	const int32 VoxelsPerChunk = FVoxelConversion::ChunkSize * FVoxelConversion::Subdivisions;
+	const float VoxelSize = FVoxelConversion::LocalVoxelSize;
+	const float ChunkWorldSize = FVoxelConversion::ChunkSize * FVoxelConversion::TerrainGridSize;
+
+	TArray<FDiggerBenchmarkResult> Results;
+
+	// Terrain: one layer of chunks straddling Z = 0, plus the layer below for the deeper dig strokes
+	TArray<UVoxelChunk*> Chunks;
+	{
+		FDiggerBenchmarkResult Result;
+		Result.Name = TEXT("Pipeline.FillTerrain");
+		const double Start = FPlatformTime::Seconds();
+		for (int32 X = 0; X < ChunksPerSide; ++X)
+		{
+			for (int32 Y = 0; Y < ChunksPerSide; ++Y)
+			{
+				for (int32 Z = -1; Z <= 0; ++Z)
+				{
+					UVoxelChunk* Chunk = Manager->GetOrCreateChunkAtChunk(FIntVector(X, Y, Z));
+					FillChunkWithTerrain(Chunk, VoxelsPerChunk, VoxelSize);
+					if (Chunk)
+					{
+						Chunks.Add(Chunk);
+					}
+				}
+			}
+		}
+		Result.AddIteration(FPlatformTime::Seconds() - Start);
+		Result.ItemsPerIteration = Chunks.Num();
+		Results.Add(Result);
+	}
+
+	// Scripted dig: a sphere brush wandering across the block at surface height
+	{
+		FDiggerBenchmarkResult Result;
+		Result.Name = TEXT("Pipeline.BrushStrokes");
+		Result.ItemsPerIteration = StrokeCount;
+
+		const float Extent = ChunksPerSide * ChunkWorldSize;
+		const FVector Base = FVoxelConversion::ChunkToWorld(FIntVector::ZeroValue);
+		const double Start = FPlatformTime::Seconds();
+		for (int32 i = 0; i < StrokeCount; ++i)
+		{
+			const float T = StrokeCount > 1 ? (float)i / (StrokeCount - 1) : 0.0f;
+			const float X = Base.X + Extent * (0.1f + 0.8f * T);
+			const float Y = Base.Y + Extent * (0.5f + 0.35f * FMath::Sin(T * 2.0f * PI));
+
+			FBrushStroke Stroke;
+			Stroke.BrushType = EVoxelBrushType::Sphere;
+			Stroke.BrushPosition = FVector(X, Y, BenchmarkTerrainHeight(X, Y));
+			Stroke.BrushRadius = 150.0f + 100.0f * (i % 3);
+			Stroke.BrushStrength = 1.0f;
+			Stroke.BrushFalloff = 25.0f;
+			Stroke.bDig = (i % 5) != 4;
+			Manager->ApplyBrushToAllChunks(Stroke, true);
+		}
+		Result.AddIteration(FPlatformTime::Seconds() - Start);
+		Results.Add(Result);
+	}
+
+	// Meshing, every chunk per iteration
+	{
+		FDiggerBenchmarkResult Result;
+		Result.Name = TEXT("Pipeline.GenerateMeshFromGrid");
+		Result.ItemsPerIteration = Chunks.Num();
+
+		int64 VertexCount = 0;
+		int64 TriangleCount = 0;
+		TArray<FVector> Vertices;
+		TArray<int32> Triangles;
+		TArray<FVector> Normals;
+		for (int32 Iter = 0; Iter < Iterations; ++Iter)
+		{
+			VertexCount = 0;
+			TriangleCount = 0;
+			const double Start = FPlatformTime::Seconds();
+			for (UVoxelChunk* Chunk : Chunks)
+			{
+				UMarchingCubes* Generator = Chunk->GetMarchingCubesGenerator();
+				if (!Generator)
+				{
+					continue;
+				}
+				Vertices.Reset();
+				Triangles.Reset();
+				Normals.Reset();
+				Generator->GenerateMeshFromGrid(Chunk->GetSparseVoxelGrid(), FVoxelConversion::ChunkToWorld(Chunk->GetChunkCoordinates()),
+					VoxelSize, Vertices, Triangles, Normals);
+				VertexCount += Vertices.Num();
+				TriangleCount += Triangles.Num() / 3;
+			}
+			Result.AddIteration(FPlatformTime::Seconds() - Start);
+		}
+		Result.Counters.Add(TEXT("vertices"), (double)VertexCount);
+		Result.Counters.Add(TEXT("triangles"), (double)TriangleCount);
+		Results.Add(Result);
+	}
+
+	// Island detection over every chunk grid
+	{
+		FDiggerBenchmarkResult Result;
+		Result.Name = TEXT("Pipeline.DetectIslands");
+		Result.ItemsPerIteration = Chunks.Num();
+
+		int64 IslandCount = 0;
+		for (int32 Iter = 0; Iter < Iterations; ++Iter)
+		{
+			IslandCount = 0;
+			const double Start = FPlatformTime::Seconds();
+			for (UVoxelChunk* Chunk : Chunks)
+			{
+				if (USparseVoxelGrid* Grid = Chunk->GetSparseVoxelGrid())
+				{
+					IslandCount += Grid->DetectIslands(0.0f).Num();
+				}
+			}
+			Result.AddIteration(FPlatformTime::Seconds() - Start);
+		}
+		Result.Counters.Add(TEXT("islands"), (double)IslandCount);
+		Results.Add(Result);
+	}
+
+	// Save / load round trip through the regular save path
+	{
+		FDiggerBenchmarkResult SaveResult;
+		SaveResult.Name = TEXT("Pipeline.SaveAllChunks");
+		SaveResult.ItemsPerIteration = Chunks.Num();
+		FDiggerBenchmarkResult LoadResult;
+		LoadResult.Name = TEXT("Pipeline.LoadAllChunks");
+		LoadResult.ItemsPerIteration = Chunks.Num();
+
+		bool bRoundTripOk = true;
+		for (int32 Iter = 0; Iter < Iterations; ++Iter)
+		{
+			double Start = FPlatformTime::Seconds();
+			bRoundTripOk &= Manager->SaveAllChunks(BenchmarkSaveName);
+			SaveResult.AddIteration(FPlatformTime::Seconds() - Start);
+
+			Start = FPlatformTime::Seconds();
+			bRoundTripOk &= Manager->LoadAllChunks(BenchmarkSaveName);
+			LoadResult.AddIteration(FPlatformTime::Seconds() - Start);
+		}
+		Manager->DeleteSaveFile(BenchmarkSaveName);
+
+		LoadResult.Counters.Add(TEXT("ok"), bRoundTripOk ? 1.0 : 0.0);
+		Results.Add(SaveResult);
+		Results.Add(LoadResult);
+	}
+
+	// Mesher inner loop on its own, no grid or terrain involved
+	FDiggerBenchmark::RunMarchingCubesCellComparison(MarchingCubesCells, Iterations, Results);
+
+	FDiggerBenchmark::LogResults(Results);
+
+	TMap<FString, FString> Meta;
+	Meta.Add(TEXT("chunks"), FString::FromInt(Chunks.Num()));
+	Meta.Add(TEXT("chunk_size"), FString::FromInt(FVoxelConversion::ChunkSize));
+	Meta.Add(TEXT("subdivisions"), FString::FromInt(FVoxelConversion::Subdivisions));
+	Meta.Add(TEXT("strokes"), FString::FromInt(StrokeCount));
+	Meta.Add(TEXT("iterations"), FString::FromInt(Iterations));
+	Meta.Add(TEXT("timestamp"), FDateTime::UtcNow().ToIso8601());
+
+	const bool bWritten = FFileHelper::SaveStringToFile(FDiggerBenchmark::ResultsToJson(Results, Meta), *OutputPath);
+	UE_LOG(LogTemp, Display, TEXT("[DiggerBenchmark] %s %s"), bWritten ? TEXT("Wrote") : TEXT("Failed to write"), *OutputPath);
+
+	Manager->Destroy();
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+
+	return bWritten ? 0 : 1;
+}
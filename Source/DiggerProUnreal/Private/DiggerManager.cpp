@@ -3,15 +3,23 @@
 #include "CoreMinimal.h"
 
 // Voxel & Mesh Systems
+#include "DiggerStrokeNetComponent.h"
+#include "FBrushStrokeCodec.h"
+#include "FChunkLoadQueue.h"
 #include "FCustomSDFBrush.h"
 #include "MarchingCubes.h"
 #include "SparseVoxelGrid.h"
+#include "Voxel/VoxelDenseSlab.h"
+#include "Voxel/VoxelLODContour.h"
 #include "VoxelChunk.h"
 #include "VoxelConversion.h"
+#include "VoxelRegionFile.h"
 
 // Landscape & Island
 #include "IslandActor.h"
+#include "LandscapeComponent.h"
 #include "LandscapeEdit.h"
+#include "LandscapeHeightfieldCollisionComponent.h"
 #include "LandscapeInfo.h"
 #include "LandscapeProxy.h"
 
@@ -27,11 +35,19 @@
 // Engine Systems
 #include "TimerManager.h"
 #include "Engine/World.h"
+#include "Camera/PlayerCameraManager.h"
+#include "GameFramework/GameModeBase.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/PlayerStart.h"
 
 // Async & Performance
 #include "Async/Async.h"
 #include "Async/ParallelFor.h"
 
+// Networking
+#include "SocketIOLobbyManager.h"
+
 // Asset Management
 #include "AssetToolsModule.h"
 #include "IAssetTools.h"
@@ -57,6 +73,7 @@
 #include "Subsystems/EditorActorSubsystem.h"
 #include "UObject/ConstructorHelpers.h"
 #include "UObject/Package.h"
+#include "Voxel/BrushShapes/BrushBounds.h"
 #include "Voxel/BrushShapes/ConeBrushShape.h"
 #include "Voxel/BrushShapes/CubeBrushShape.h"
 #include "Voxel/BrushShapes/SphereBrushShape.h"
@@ -64,6 +81,7 @@
 // Save and Load
 #include "DiggerDebug.h"
 #include "DiggerEdMode.h"
+#include "DiggerStats.h"
 #include "HAL/PlatformFilemanager.h"
 #include "Misc/FileHelper.h"
 #include "Engine/Engine.h"
@@ -86,6 +104,7 @@
 #include "ScopedTransaction.h"
 #include "Engine/Selection.h"
 #include "Editor/EditorEngine.h"
+#include "EditorViewportClient.h"
 #include "DiggerEdModeToolkit.h"
 
 // Light Component Includes
@@ -123,6 +142,11 @@ FString ADiggerManager::GetChunkFilePath(const FIntVector& ChunkCoords, const FS
     return GetSaveFileDirectory(SaveFileName) / FileName;
 }
 
+FString ADiggerManager::GetRegionFilePath(const FIntVector& ChunkCoords, const FString& SaveFileName) const
+{
+    return FVoxelRegionFile::GetRegionFilePath(GetSaveFileDirectory(SaveFileName), FVoxelRegionFile::ChunkToRegion(ChunkCoords));
+}
+
 // Overload for backward compatibility - uses "Default" save file
 FString ADiggerManager::GetChunkFilePath(const FIntVector& ChunkCoords) const
 {
@@ -137,6 +161,14 @@ bool ADiggerManager::DoesSaveFileExist(const FString& SaveFileName) const
 
 bool ADiggerManager::DoesChunkFileExist(const FIntVector& ChunkCoords, const FString& SaveFileName) const
 {
+    TArray<FVoxelRegionFile::FEntry> Entries;
+    if (FVoxelRegionFile::ReadTable(GetRegionFilePath(ChunkCoords, SaveFileName), Entries)
+        && Entries.ContainsByPredicate([&ChunkCoords](const FVoxelRegionFile::FEntry& Entry) { return Entry.ChunkCoords == ChunkCoords; }))
+    {
+        return true;
+    }
+
+    // Saves from before region packs
     FString FilePath = GetChunkFilePath(ChunkCoords, SaveFileName);
     return FPaths::FileExists(FilePath);
 }
@@ -169,6 +201,8 @@ void ADiggerManager::EnsureSaveFileDirectoryExists(const FString& SaveFileName)
 
 bool ADiggerManager::SaveChunk(const FIntVector& ChunkCoords, const FString& SaveFileName)
 {
+    DIGGER_SCOPE_CYCLE_COUNTER(STAT_DiggerSaveChunks);
+
     EnsureSaveFileDirectoryExists(SaveFileName);
     
     UVoxelChunk** ChunkPtr = ChunkMap.Find(ChunkCoords);
@@ -180,9 +214,17 @@ bool ADiggerManager::SaveChunk(const FIntVector& ChunkCoords, const FString& Sav
     }
     
     UVoxelChunk* Chunk = *ChunkPtr;
-    FString FilePath = GetChunkFilePath(ChunkCoords, SaveFileName);
-    
-    bool bSaveSuccess = Chunk->SaveChunkData(FilePath);
+
+    TMap<FIntVector, TArray<uint8>> Payloads;
+    bool bSaveSuccess = Chunk->SaveChunkPayload(Payloads.Add(ChunkCoords))
+        && FVoxelRegionFile::WriteChunks(GetRegionFilePath(ChunkCoords, SaveFileName), Payloads, TSet<FIntVector>());
+
+    if (bSaveSuccess)
+    {
+        // The region copy supersedes any per-chunk file from an older save
+        IFileManager::Get().Delete(*GetChunkFilePath(ChunkCoords, SaveFileName), false, false, true);
+        Chunk->ClearUnsavedChanges();
+    }
     
     if (bSaveSuccess)
     {
@@ -207,8 +249,47 @@ bool ADiggerManager::SaveChunk(const FIntVector& ChunkCoords)
     return SaveChunk(ChunkCoords, TEXT("Default"));
 }
 
+bool ADiggerManager::LoadChunkFromPayload(const FIntVector& ChunkCoords, const TArray<uint8>& Payload, const FString& SaveFileName)
+{
+    UVoxelChunk* Chunk = GetOrCreateChunkAtChunk(ChunkCoords);
+    if (!Chunk)
+    {
+        UE_LOG(LogTemp, Error, TEXT("Failed to get or create chunk at %s for save file '%s'"), 
+            *ChunkCoords.ToString(), *SaveFileName);
+        return false;
+    }
+
+    if (!Chunk->LoadChunkPayload(Payload, false))
+    {
+        UE_LOG(LogTemp, Error, TEXT("Failed to load chunk %s from save file '%s'"), 
+            *ChunkCoords.ToString(), *SaveFileName);
+        return false;
+    }
+
+    // IMPORTANT: Force mesh regeneration after loading
+    Chunk->ForceUpdate();
+    Chunk->ClearUnsavedChanges();
+
+    if (DiggerDebug::IO)
+    {
+        UE_LOG(LogTemp, Log, TEXT("Successfully loaded chunk %s from save file '%s'"), 
+            *ChunkCoords.ToString(), *SaveFileName);
+    }
+    return true;
+}
+
 bool ADiggerManager::LoadChunk(const FIntVector& ChunkCoords, const FString& SaveFileName)
 {
+    DIGGER_SCOPE_CYCLE_COUNTER(STAT_DiggerLoadChunks);
+
+    // Region pack first, only this chunk's blob is read
+    TArray<uint8> Payload;
+    if (FVoxelRegionFile::ReadChunk(GetRegionFilePath(ChunkCoords, SaveFileName), ChunkCoords, Payload))
+    {
+        return LoadChunkFromPayload(ChunkCoords, Payload, SaveFileName);
+    }
+
+    // Saves from before region packs
     FString FilePath = GetChunkFilePath(ChunkCoords, SaveFileName);
     
     if (!FPaths::FileExists(FilePath))
@@ -237,6 +318,7 @@ bool ADiggerManager::LoadChunk(const FIntVector& ChunkCoords, const FString& Sav
         
         // IMPORTANT: Force mesh regeneration after loading
         Chunk->ForceUpdate();
+        Chunk->ClearUnsavedChanges();
         
         UE_LOG(LogTemp, Log, TEXT("Triggered mesh regeneration for loaded chunk %s from save file '%s'"), 
             *ChunkCoords.ToString(), *SaveFileName);
@@ -258,6 +340,8 @@ bool ADiggerManager::LoadChunk(const FIntVector& ChunkCoords)
 
 bool ADiggerManager::SaveAllChunks(const FString& SaveFileName)
 {
+    DIGGER_SCOPE_CYCLE_COUNTER(STAT_DiggerSaveChunks);
+
     EnsureSaveFileDirectoryExists(SaveFileName);
     
     if (ChunkMap.Num() == 0)
@@ -271,17 +355,42 @@ bool ADiggerManager::SaveAllChunks(const FString& SaveFileName)
     
     UE_LOG(LogTemp, Log, TEXT("Starting to save %d chunks to save file '%s'..."), ChunkMap.Num(), *SaveFileName);
     
+    // Payloads are built here (grid reads), grouped per region, then each region is written once
+    TMap<FIntVector, TMap<FIntVector, TArray<uint8>>> PayloadsByRegion;
     for (const auto& ChunkPair : ChunkMap)
     {
         const FIntVector& ChunkCoords = ChunkPair.Key;
+        UVoxelChunk* Chunk = ChunkPair.Value;
         
-        if (SaveChunk(ChunkCoords, SaveFileName))
+        TMap<FIntVector, TArray<uint8>>& RegionPayloads = PayloadsByRegion.FindOrAdd(FVoxelRegionFile::ChunkToRegion(ChunkCoords));
+        if (!Chunk || !Chunk->SaveChunkPayload(RegionPayloads.Add(ChunkCoords)))
+        {
+            RegionPayloads.Remove(ChunkCoords);
+            FailedCount++;
+        }
+    }
+
+    const FString SaveDir = GetSaveFileDirectory(SaveFileName);
+    for (const auto& RegionPair : PayloadsByRegion)
+    {
+        if (RegionPair.Value.Num() == 0)
+        {
+            continue;
+        }
+
+        if (FVoxelRegionFile::WriteChunks(FVoxelRegionFile::GetRegionFilePath(SaveDir, RegionPair.Key), RegionPair.Value, TSet<FIntVector>()))
         {
-            SavedCount++;
+            SavedCount += RegionPair.Value.Num();
+            for (const auto& ChunkPayload : RegionPair.Value)
+            {
+                // The region copy supersedes any per-chunk file from an older save
+                IFileManager::Get().Delete(*GetChunkFilePath(ChunkPayload.Key, SaveFileName), false, false, true);
+                ChunkMap.FindRef(ChunkPayload.Key)->ClearUnsavedChanges();
+            }
         }
         else
         {
-            FailedCount++;
+            FailedCount += RegionPair.Value.Num();
         }
     }
     
@@ -300,8 +409,213 @@ bool ADiggerManager::SaveAllChunks()
     return SaveAllChunks(TEXT("Default"));
 }
 
+namespace
+{
+    // Where a save's chunks live on disk, gathered on the game thread before decoding starts
+    struct FChunkLoadSources
+    {
+        struct FChunkSource
+        {
+            FIntVector ChunkCoords;
+            FString RegionPath;
+            // Per-chunk file from older saves, only read when no region had the chunk
+            FString LegacyPath;
+        };
+        TArray<FChunkSource> Chunks;
+        TArray<FString> RegionPaths;
+        TSet<FIntVector> Wanted;
+        // Full loads read each region in one go, streaming a handful of chunks seeks to each blob instead
+        bool bReadWholeRegions = true;
+    };
+
+    FChunkLoadSources GatherChunkLoadSources(const ADiggerManager& Manager, const FString& SaveFileName, const TArray<FIntVector>& ChunkCoords, bool bReadWholeRegions)
+    {
+        FChunkLoadSources Sources;
+        Sources.bReadWholeRegions = bReadWholeRegions;
+        TSet<FString> Regions;
+        for (const FIntVector& Coords : ChunkCoords)
+        {
+            FChunkLoadSources::FChunkSource& Source = Sources.Chunks.AddDefaulted_GetRef();
+            Source.ChunkCoords = Coords;
+            Source.RegionPath = Manager.GetRegionFilePath(Coords, SaveFileName);
+            Source.LegacyPath = Manager.GetChunkFilePath(Coords, SaveFileName);
+            Sources.Wanted.Add(Coords);
+
+            if (bReadWholeRegions && !Regions.Contains(Source.RegionPath))
+            {
+                Regions.Add(Source.RegionPath);
+                if (FPaths::FileExists(Source.RegionPath))
+                {
+                    Sources.RegionPaths.Add(Source.RegionPath);
+                }
+            }
+        }
+        return Sources;
+    }
+
+    bool DecodeLegacyChunk(const FChunkLoadSources::FChunkSource& Source, FDecodedChunkPayload& OutDecoded)
+    {
+        TArray<uint8> FileData;
+        return FFileHelper::LoadFileToArray(FileData, *Source.LegacyPath, FILEREAD_Silent)
+            && UVoxelChunk::DecodeLegacyChunkFile(FileData, OutDecoded);
+    }
+
+    // File reads and decoding, no UObjects touched. Regions and the chunks inside them decode in parallel,
+    // each region's chunks are pushed as soon as it's done so the game thread can start applying early.
+    void DecodeSavedChunks(FChunkLoadQueue& Queue, const FChunkLoadSources& Sources)
+    {
+        if (!Sources.bReadWholeRegions)
+        {
+            ParallelFor(Sources.Chunks.Num(), [&Queue, &Sources](int32 Index)
+            {
+                if (Queue.IsCancelled())
+                {
+                    return;
+                }
+
+                const FChunkLoadSources::FChunkSource& Source = Sources.Chunks[Index];
+                TArray<FDecodedChunkPayload> Decoded;
+                FDecodedChunkPayload& Chunk = Decoded.AddDefaulted_GetRef();
+                Chunk.ChunkCoords = Source.ChunkCoords;
+
+                TArray<uint8> Payload;
+                const bool bDecoded = FVoxelRegionFile::ReadChunk(Source.RegionPath, Source.ChunkCoords, Payload)
+                    ? UVoxelChunk::DecodeChunkPayload(Payload, Chunk)
+                    : DecodeLegacyChunk(Source, Chunk);
+                if (bDecoded)
+                {
+                    Queue.Push(MoveTemp(Decoded));
+                }
+                else
+                {
+                    Queue.AddFailed(1);
+                }
+            });
+
+            Queue.MarkDecodeFinished();
+            return;
+        }
+
+        TArray<TArray<FIntVector>> RegionChunks;
+        RegionChunks.SetNum(Sources.RegionPaths.Num());
+
+        ParallelFor(Sources.RegionPaths.Num(), [&Queue, &Sources, &RegionChunks](int32 RegionIndex)
+        {
+            if (Queue.IsCancelled())
+            {
+                return;
+            }
+
+            TMap<FIntVector, TArray<uint8>> Payloads;
+            if (!FVoxelRegionFile::ReadAllChunks(Sources.RegionPaths[RegionIndex], Payloads))
+            {
+                UE_LOG(LogTemp, Error, TEXT("Region file '%s' is damaged, loading what could be read"), *Sources.RegionPaths[RegionIndex]);
+            }
+
+            TArray<const TPair<FIntVector, TArray<uint8>>*> Items;
+            for (const TPair<FIntVector, TArray<uint8>>& Pair : Payloads)
+            {
+                if (Sources.Wanted.Contains(Pair.Key))
+                {
+                    Items.Add(&Pair);
+                    RegionChunks[RegionIndex].Add(Pair.Key);
+                }
+            }
+
+            TArray<FDecodedChunkPayload> Decoded;
+            TArray<bool> Decodes;
+            Decoded.SetNum(Items.Num());
+            Decodes.SetNumZeroed(Items.Num());
+            ParallelFor(Items.Num(), [&Items, &Decoded, &Decodes](int32 Index)
+            {
+                Decoded[Index].ChunkCoords = Items[Index]->Key;
+                Decodes[Index] = UVoxelChunk::DecodeChunkPayload(Items[Index]->Value, Decoded[Index]);
+            });
+
+            int32 NumFailed = 0;
+            for (int32 Index = Decoded.Num() - 1; Index >= 0; --Index)
+            {
+                if (!Decodes[Index])
+                {
+                    Decoded.RemoveAtSwap(Index, 1, false);
+                    ++NumFailed;
+                }
+            }
+            Queue.AddFailed(NumFailed);
+            Queue.Push(MoveTemp(Decoded));
+        });
+
+        // Whatever is left lives in per-chunk files from an older save
+        TSet<FIntVector> InRegions;
+        for (const TArray<FIntVector>& Chunks : RegionChunks)
+        {
+            InRegions.Append(Chunks);
+        }
+
+        TArray<const FChunkLoadSources::FChunkSource*> LegacyChunks;
+        for (const FChunkLoadSources::FChunkSource& Source : Sources.Chunks)
+        {
+            if (!InRegions.Contains(Source.ChunkCoords))
+            {
+                LegacyChunks.Add(&Source);
+            }
+        }
+
+        ParallelFor(LegacyChunks.Num(), [&Queue, &LegacyChunks](int32 Index)
+        {
+            if (Queue.IsCancelled())
+            {
+                return;
+            }
+
+            TArray<FDecodedChunkPayload> Decoded;
+            FDecodedChunkPayload& Chunk = Decoded.AddDefaulted_GetRef();
+            Chunk.ChunkCoords = LegacyChunks[Index]->ChunkCoords;
+            if (DecodeLegacyChunk(*LegacyChunks[Index], Chunk))
+            {
+                Queue.Push(MoveTemp(Decoded));
+            }
+            else
+            {
+                Queue.AddFailed(1);
+            }
+        });
+
+        Queue.MarkDecodeFinished();
+    }
+}
+
+UVoxelChunk* ADiggerManager::ApplyDecodedChunk(FDecodedChunkPayload&& Decoded, bool bQueueMesh)
+{
+    DIGGER_SCOPE_CYCLE_COUNTER(STAT_DiggerLoadChunks);
+
+    const FIntVector ChunkCoords = Decoded.ChunkCoords;
+    UVoxelChunk* Chunk = GetOrCreateChunkAtChunk(ChunkCoords);
+    if (!Chunk)
+    {
+        UE_LOG(LogTemp, Error, TEXT("Failed to get or create chunk at %s while loading"), *ChunkCoords.ToString());
+        return nullptr;
+    }
+
+    Chunk->ApplyDecodedPayload(MoveTemp(Decoded), false);
+    if (bQueueMesh)
+    {
+        // Meshing goes through the regular mesh queue instead of a ForceUpdate per chunk
+        Chunk->MarkDirty();
+        EnqueueDirtyChunk(ChunkCoords);
+    }
+    // Matches what's on disk
+    Chunk->ClearUnsavedChanges();
+    return Chunk;
+}
+
 bool ADiggerManager::LoadAllChunks(const FString& SaveFileName)
 {
+    DIGGER_SCOPE_CYCLE_COUNTER(STAT_DiggerLoadChunks);
+
+    // A synchronous load replaces whatever async load was still running
+    CancelAsyncChunkLoad();
+
     TArray<FIntVector> SavedChunkCoords = GetAllSavedChunkCoordinates(SaveFileName, true); // Force refresh
     
     if (SavedChunkCoords.Num() == 0)
@@ -314,18 +628,26 @@ bool ADiggerManager::LoadAllChunks(const FString& SaveFileName)
     int32 FailedCount = 0;
     
     UE_LOG(LogTemp, Log, TEXT("Starting to load %d chunks from save file '%s'..."), SavedChunkCoords.Num(), *SaveFileName);
-    
-    for (const FIntVector& ChunkCoords : SavedChunkCoords)
+
+    // Decode in parallel, then apply and mesh here; callers of the blocking load expect meshes when it returns
+    FChunkLoadQueue Queue;
+    DecodeSavedChunks(Queue, GatherChunkLoadSources(*this, SaveFileName, SavedChunkCoords, true));
+
+    FDecodedChunkPayload Decoded;
+    while (Queue.PopNearest(TOptional<FVector>(), Decoded))
     {
-        if (LoadChunk(ChunkCoords, SaveFileName))
+        if (UVoxelChunk* Chunk = ApplyDecodedChunk(MoveTemp(Decoded), false))
         {
+            Chunk->ForceUpdate();
             LoadedCount++;
         }
         else
         {
             FailedCount++;
         }
+        Decoded = FDecodedChunkPayload();
     }
+    FailedCount += Queue.NumFailed();
     
     UE_LOG(LogTemp, Log, TEXT("Finished loading chunks from save file '%s': %d successful, %d failed"), 
         *SaveFileName, LoadedCount, FailedCount);
@@ -333,567 +655,1184 @@ bool ADiggerManager::LoadAllChunks(const FString& SaveFileName)
     return FailedCount == 0;
 }
 
-// Overload for backward compatibility
-bool ADiggerManager::LoadAllChunks()
+bool ADiggerManager::LoadAllChunksAsync(const FString& SaveFileName)
 {
-    return LoadAllChunks(TEXT("Default"));
+    TArray<FIntVector> SavedChunkCoords = GetAllSavedChunkCoordinates(SaveFileName, true); // Force refresh
+    StartChunkLoad(SaveFileName, SavedChunkCoords);
+    return true;
 }
 
-TArray<FIntVector> ADiggerManager::GetAllSavedChunkCoordinates(const FString& SaveFileName, bool bForceRefresh)
+void ADiggerManager::StartChunkLoad(const FString& SaveFileName, const TArray<FIntVector>& ChunkCoords)
 {
-    // Use per-save-file caching
-    FString CacheKey = SaveFileName;
-    
-    if (!bForceRefresh && SavedChunkCache.Contains(CacheKey))
+    CancelAsyncChunkLoad();
+
+    ChunkLoadTotal = ChunkCoords.Num();
+    ChunkLoadApplied = 0;
+    ChunkLoadFailed = 0;
+
+    if (ChunkCoords.Num() == 0)
     {
-        return SavedChunkCache[CacheKey];
+        UE_LOG(LogTemp, Log, TEXT("No saved chunks found to load from save file '%s'"), *SaveFileName);
+        OnChunkLoadFinished.Broadcast(0, 0);
+        return;
     }
-    
-    TArray<FIntVector> SavedChunks;
-    FString SaveDir = GetSaveFileDirectory(SaveFileName);
-    
-    if (!FPaths::DirectoryExists(SaveDir))
+
+    UE_LOG(LogTemp, Log, TEXT("Starting async load of %d chunks from save file '%s'..."), ChunkCoords.Num(), *SaveFileName);
+
+    ChunkLoadFocus = FindChunkLoadFocus();
+    ActiveChunkLoad = MakeShared<FChunkLoadQueue, ESPMode::ThreadSafe>();
+
+    // The worker only holds the queue, never the manager
+    TSharedPtr<FChunkLoadQueue, ESPMode::ThreadSafe> Queue = ActiveChunkLoad;
+    Async(EAsyncExecution::ThreadPool, [Queue, Sources = GatherChunkLoadSources(*this, SaveFileName, ChunkCoords, true)]()
     {
-        // Directory doesn't exist, so no saved chunks
-        SavedChunkCache.Add(CacheKey, SavedChunks);
-        return SavedChunks;
-    }
-    
-    TArray<FString> FoundFiles;
-    FString SearchPattern = SaveDir / FString::Printf(TEXT("*%s"), *CHUNK_FILE_EXTENSION);
-    FFileManagerGeneric::Get().FindFiles(FoundFiles, *SearchPattern, true, false);
-    
-    for (const FString& FileName : FoundFiles)
+        DecodeSavedChunks(*Queue, Sources);
+    });
+
+    ScheduleChunkLoadPump();
+}
+
+void ADiggerManager::CancelAsyncChunkLoad()
+{
+    if (ActiveChunkLoad.IsValid())
     {
-        // Parse filename to extract coordinates
-        FString BaseName = FPaths::GetBaseFilename(FileName);
-        
-        // Expected format: Chunk_X_Y_Z
-        TArray<FString> Parts;
-        BaseName.ParseIntoArray(Parts, TEXT("_"), true);
-        
-        if (Parts.Num() >= 4 && Parts[0] == TEXT("Chunk"))
-        {
-            int32 X = FCString::Atoi(*Parts[1]);
-            int32 Y = FCString::Atoi(*Parts[2]);
-            int32 Z = FCString::Atoi(*Parts[3]);
-            
-            SavedChunks.Add(FIntVector(X, Y, Z));
-        }
+        ActiveChunkLoad->Cancel();
+        ActiveChunkLoad.Reset();
     }
-    
-    // Cache the results
-    SavedChunkCache.Add(CacheKey, SavedChunks);
-    
-    return SavedChunks;
+    ChunkLoadAwaitingMesh.Reset();
 }
 
-// Overload for backward compatibility
-TArray<FIntVector> ADiggerManager::GetAllSavedChunkCoordinates(bool bForceRefresh)
+float ADiggerManager::GetChunkLoadProgress() const
 {
-    return GetAllSavedChunkCoordinates(TEXT("Default"), bForceRefresh);
+    if (!IsLoadingChunks() || ChunkLoadTotal == 0)
+    {
+        return 1.0f;
+    }
+    // A chunk counts once its mesh is up
+    const int32 Done = ChunkLoadApplied - ChunkLoadAwaitingMesh.Num() + ChunkLoadFailed;
+    return FMath::Clamp((float)Done / ChunkLoadTotal, 0.0f, 1.0f);
 }
 
-TArray<FString> ADiggerManager::GetAllSaveFileNames() const
+void ADiggerManager::ScheduleChunkLoadPump()
 {
-    TArray<FString> SaveFileNames;
-    FString MainDir = FPaths::ProjectContentDir() / VOXEL_DATA_DIRECTORY;
-    
-    UE_LOG(LogTemp, Log, TEXT("GetAllSaveFileNames: Searching in directory: %s"), *MainDir);
-    
-    if (!FPaths::DirectoryExists(MainDir))
+    UWorld* PumpWorld = GetWorld();
+    if (!PumpWorld)
     {
-        UE_LOG(LogTemp, Log, TEXT("GetAllSaveFileNames: Main directory does not exist"));
-        return SaveFileNames;
+        return;
     }
-    
-    // Get all entries in the main directory
-    TArray<FString> DirectoryContents;
-    IFileManager& FileManager = IFileManager::Get();
-    FileManager.FindFiles(DirectoryContents, *(MainDir / TEXT("*")), false, true);
-    
-    UE_LOG(LogTemp, Log, TEXT("Found %d potential directories"), DirectoryContents.Num());
-    
-    // Check each directory to see if it contains chunk files
-    for (const FString& DirName : DirectoryContents)
+
+    FTimerManager& TimerManager = PumpWorld->GetTimerManager();
+    if (!TimerManager.TimerExists(ChunkLoadPumpHandle))
     {
-        FString FullDirPath = MainDir / DirName;
-        
-        UE_LOG(LogTemp, Log, TEXT("Checking directory: %s"), *DirName);
-        
-        // Skip any hidden directories or files
-        if (DirName.StartsWith(TEXT(".")))
+        ChunkLoadPumpHandle = TimerManager.SetTimerForNextTick(this, &ADiggerManager::PumpChunkLoad);
+    }
+}
+
+void ADiggerManager::PumpChunkLoad()
+{
+    check(IsInGameThread());
+
+    const double StartTime = FPlatformTime::Seconds();
+    const double BudgetSeconds = ChunkLoadBudgetMs * 0.001;
+    int32 NumPopped = 0;
+
+    // Always apply at least one so a slow frame can't stall the load
+    auto HasBudget = [this, &NumPopped, StartTime, BudgetSeconds]()
+    {
+        return NumPopped < MaxChunksLoadedPerFrame && (NumPopped == 0 || FPlatformTime::Seconds() - StartTime <= BudgetSeconds);
+    };
+
+    if (ActiveChunkLoad.IsValid())
+    {
+        // Checked before draining: the worker pushes everything before it flags itself finished
+        const bool bDecodeFinished = ActiveChunkLoad->IsDecodeFinished();
+
+        int32 NumApplied = 0;
+        int32 NumApplyFailed = 0;
+        FDecodedChunkPayload Decoded;
+        while (HasBudget() && ActiveChunkLoad->PopNearest(ChunkLoadFocus, Decoded))
         {
-            UE_LOG(LogTemp, Log, TEXT("Skipping hidden directory: %s"), *DirName);
-            continue;
+            ++NumPopped;
+            const FIntVector ChunkCoords = Decoded.ChunkCoords;
+            if (ApplyDecodedChunk(MoveTemp(Decoded), true))
+            {
+                ChunkLoadAwaitingMesh.Add(ChunkCoords);
+                ++NumApplied;
+            }
+            else
+            {
+                ++NumApplyFailed;
+            }
+            Decoded = FDecodedChunkPayload();
         }
-        
-        // Verify it's actually a directory
-        if (!FPaths::DirectoryExists(FullDirPath))
+
+        // Dispatched and uploaded means done; ClearDirty happens at dispatch, the job stays in flight until upload
+        const int32 NumAwaitingBefore = ChunkLoadAwaitingMesh.Num();
+        for (auto It = ChunkLoadAwaitingMesh.CreateIterator(); It; ++It)
         {
-            UE_LOG(LogTemp, Log, TEXT("Not a directory: %s"), *DirName);
-            continue;
+            UVoxelChunk** ChunkPtr = ChunkMap.Find(*It);
+            if (!ChunkPtr || !IsValid(*ChunkPtr) || (!(*ChunkPtr)->IsDirty() && !InFlightMeshJobs.Contains(*It)))
+            {
+                It.RemoveCurrent();
+            }
         }
-        
-        // Check if this directory contains chunk files
-        TArray<FString> ChunkFiles;
-        FString ChunkSearchPattern = FullDirPath / FString::Printf(TEXT("*%s"), *CHUNK_FILE_EXTENSION);
-        FileManager.FindFiles(ChunkFiles, *ChunkSearchPattern, true, false);
-        
-        UE_LOG(LogTemp, Log, TEXT("Directory '%s' contains %d chunk files"), *DirName, ChunkFiles.Num());
-        
-        if (ChunkFiles.Num() > 0)
+
+        const int32 NumFailed = ActiveChunkLoad->NumFailed() + NumApplyFailed;
+        const bool bProgressed = NumApplied > 0 || NumFailed != ChunkLoadFailed || NumAwaitingBefore != ChunkLoadAwaitingMesh.Num();
+        ChunkLoadApplied += NumApplied;
+        ChunkLoadFailed = NumFailed;
+
+        if (bProgressed)
         {
-            SaveFileNames.Add(DirName);
-            UE_LOG(LogTemp, Log, TEXT("Added '%s' to save files list"), *DirName);
+            if (DiggerDebug::IO)
+            {
+                UE_LOG(LogTemp, Verbose, TEXT("[ChunkLoad] Applied: %d/%d  Failed: %d  Awaiting mesh: %d"),
+                    ChunkLoadApplied, ChunkLoadTotal, ChunkLoadFailed, ChunkLoadAwaitingMesh.Num());
+            }
+            OnChunkLoadProgress.Broadcast(ChunkLoadApplied - ChunkLoadAwaitingMesh.Num(), ChunkLoadTotal, ChunkLoadFailed);
         }
-        else
+
+        if (bDecodeFinished && ActiveChunkLoad->NumReady() == 0 && ChunkLoadAwaitingMesh.Num() == 0)
         {
-            UE_LOG(LogTemp, Log, TEXT("Skipping '%s' - no chunk files found"), *DirName);
+            ActiveChunkLoad.Reset();
+            UE_LOG(LogTemp, Log, TEXT("Finished async chunk load: %d successful, %d failed"), ChunkLoadApplied, ChunkLoadFailed);
+            OnChunkLoadFinished.Broadcast(ChunkLoadApplied, ChunkLoadFailed);
         }
     }
-    
-    UE_LOG(LogTemp, Log, TEXT("GetAllSaveFileNames: Final result - %d save files: [%s]"), 
-        SaveFileNames.Num(), *FString::Join(SaveFileNames, TEXT(", ")));
-    
-    return SaveFileNames;
-}
 
-bool ADiggerManager::DeleteSaveFile(const FString& SaveFileName)
-{
-    FString SaveDir = GetSaveFileDirectory(SaveFileName);
-    
-    if (!FPaths::DirectoryExists(SaveDir))
-    {
-        UE_LOG(LogTemp, Warning, TEXT("Cannot delete save file '%s' - directory does not exist"), *SaveFileName);
-        return false;
-    }
-    
-    // Delete all files in the directory first
-    TArray<FString> FilesToDelete;
-    FFileManagerGeneric::Get().FindFilesRecursive(FilesToDelete, *SaveDir, TEXT("*"), true, false);
-    
-    bool bAllFilesDeleted = true;
-    for (const FString& FileToDelete : FilesToDelete)
+    if (StreamingChunkLoad.IsValid())
     {
-        if (!FPlatformFileManager::Get().GetPlatformFile().DeleteFile(*FileToDelete))
+        const bool bDecodeFinished = StreamingChunkLoad->IsDecodeFinished();
+
+        FDecodedChunkPayload Decoded;
+        while (HasBudget() && StreamingChunkLoad->PopNearest(TOptional<FVector>(), Decoded))
         {
-            UE_LOG(LogTemp, Error, TEXT("Failed to delete file: %s"), *FileToDelete);
-            bAllFilesDeleted = false;
+            ++NumPopped;
+            // Not in flight anymore means GetOrCreateChunkAtChunk already restored it synchronously
+            if (StreamingInFlight.Remove(Decoded.ChunkCoords) > 0 && !ChunkMap.Contains(Decoded.ChunkCoords))
+            {
+                ApplyDecodedChunk(MoveTemp(Decoded), true);
+            }
+            Decoded = FDecodedChunkPayload();
+        }
+
+        if (bDecodeFinished && StreamingChunkLoad->NumReady() == 0)
+        {
+            if (StreamingInFlight.Num() > 0)
+            {
+                UE_LOG(LogTemp, Error, TEXT("Chunk streaming: %d chunks could not be read back from '%s'"),
+                    StreamingInFlight.Num(), *StreamingSaveFileName);
+                StreamingInFlight.Reset();
+            }
+            StreamingChunkLoad.Reset();
         }
     }
-    
-    // Delete the directory itself
-    bool bDirectoryDeleted = FPlatformFileManager::Get().GetPlatformFile().DeleteDirectory(*SaveDir);
-    
-    if (bDirectoryDeleted && bAllFilesDeleted)
+
+    if (ActiveChunkLoad.IsValid() || StreamingChunkLoad.IsValid())
     {
-        UE_LOG(LogTemp, Log, TEXT("Successfully deleted save file '%s'"), *SaveFileName);
-        
-        // Remove from cache
-        InvalidateSavedChunkCache(SaveFileName);
-        
-        return true;
+        ScheduleChunkLoadPump();
     }
-    else
+}
+
+TOptional<FVector> ADiggerManager::FindChunkLoadFocus() const
+{
+    UWorld* FocusWorld = GetWorld();
+    if (FocusWorld && FocusWorld->IsGameWorld())
     {
-        UE_LOG(LogTemp, Error, TEXT("Failed to completely delete save file '%s'"), *SaveFileName);
-        return false;
+        APlayerController* PC = FocusWorld->GetFirstPlayerController();
+        if (PC && PC->GetPawn())
+        {
+            return PC->GetPawn()->GetActorLocation();
+        }
+        // BeginPlay usually runs before the pawn exists
+        for (TActorIterator<APlayerStart> It(FocusWorld); It; ++It)
+        {
+            return It->GetActorLocation();
+        }
     }
+    return GetMeshPriorityViewLocation();
 }
 
-void ADiggerManager::InvalidateSavedChunkCache(const FString& SaveFileName)
+void ADiggerManager::StartChunkStreaming()
 {
-    if (SaveFileName.IsEmpty())
+    TArray<FIntVector> SavedChunkCoords = GetAllSavedChunkCoordinates(StreamingSaveFileName, true);
+
+    TArray<FVector> Sources;
+    GatherStreamingSourceLocations(Sources);
+    if (Sources.Num() == 0)
     {
-        // Clear all cache entries
-        SavedChunkCache.Empty();
+        if (const TOptional<FVector> Focus = FindChunkLoadFocus())
+        {
+            Sources.Add(Focus.GetValue());
+        }
     }
-    else
+
+    // Only what's around the player is loaded up front, the rest waits on disk until someone gets close
+    TArray<FIntVector> NearChunks;
+    StreamedOutChunks.Reset();
+    StreamingInFlight.Reset();
+    const float LoadRadiusSq = FMath::Square(StreamingLoadRadius);
+    for (const FIntVector& ChunkCoords : SavedChunkCoords)
     {
-        // Clear specific save file cache
-        SavedChunkCache.Remove(SaveFileName);
+        if (Sources.Num() == 0 || GetDistSqToNearestStreamingSource(ChunkCoords, Sources) <= LoadRadiusSq)
+        {
+            NearChunks.Add(ChunkCoords);
+        }
+        else
+        {
+            StreamedOutChunks.Add(ChunkCoords);
+        }
     }
-}
 
+    UE_LOG(LogTemp, Log, TEXT("Chunk streaming: %d saved chunks, %d loaded now, %d left on disk"),
+        SavedChunkCoords.Num(), NearChunks.Num(), StreamedOutChunks.Num());
 
-//End New Multi Save Files System.
+    StartChunkLoad(StreamingSaveFileName, NearChunks);
 
+    if (UWorld* StreamingWorld = GetWorld())
+    {
+        StreamingWorld->GetTimerManager().SetTimer(StreamingTimerHandle, this, &ADiggerManager::UpdateChunkStreaming,
+            FMath::Max(StreamingUpdateInterval, 0.05f), true);
+    }
+}
 
-void ADiggerManager::ApplyBrushInEditor(bool bDig)
+void ADiggerManager::RegisterStreamingSource(AActor* Source)
 {
-    if (DiggerDebug::Brush) {
-        UE_LOG(LogTemp, Error, TEXT("ApplyBrushInEditor Called!"));
-    }
-    
-    // Create the brush stroke with all the editor properties
-    FBrushStroke BrushStroke;
-    BrushStroke.BrushPosition = EditorBrushPosition + EditorBrushOffset;
-    BrushStroke.BrushRadius = EditorBrushRadius;
-    BrushStroke.BrushRotation = EditorBrushRotation;
-    BrushStroke.bHiddenSeam = EditorBrushHiddenSeam;
-    UE_LOG(LogTemp, Warning, TEXT("Seam Type Received in DiggerManager type: %s"), EditorBrushHiddenSeam ? TEXT("true") : TEXT("false"));
-    BrushStroke.BrushType = EditorBrushType;
-    BrushStroke.bDig = bDig;
-    BrushStroke.BrushLength = EditorBrushLength;
-    BrushStroke.bIsFilled = EditorBrushIsFilled;
-    BrushStroke.BrushAngle = EditorBrushAngle;
-    BrushStroke.HoleShape = EditorBrushHoleShape;
-    BrushStroke.bUseAdvancedCubeBrush = EditorbUseAdvancedCubeBrush;
-    BrushStroke.AdvancedCubeHalfExtentX = EditorCubeHalfExtentX;
-    BrushStroke.AdvancedCubeHalfExtentY = EditorCubeHalfExtentY;
-    BrushStroke.AdvancedCubeHalfExtentZ = EditorCubeHalfExtentZ;
-    BrushStroke.BrushStrength = EditorBrushStrength; // Make sure this is set
-    // In your ApplyBrushInEditor method, add this line when creating the BrushStroke:
-    BrushStroke.LightColor = EditorBrushLightColor;
-    
-    // Set light-specific properties if it's a light brush
-    if (EditorBrushType == EVoxelBrushType::Light)
+    if (Source)
     {
-        BrushStroke.LightType = EditorBrushLightType;
-        BrushStroke.LightColor = EditorBrushLightColor;
+        StreamingSourceActors.AddUnique(Source);
+    }
+}
 
-        if (DiggerDebug::Lights || DiggerDebug::Brush)
-        {
-            UE_LOG(LogTemp, Warning, TEXT("Light brush setup: LightType = %d, Color = %s"),
-                (int32)BrushStroke.LightType,
-                *BrushStroke.LightColor.ToString());
-        }
+void ADiggerManager::UnregisterStreamingSource(AActor* Source)
+{
+    StreamingSourceActors.Remove(Source);
+}
 
-        ApplyLightBrushInEditor(BrushStroke);
+void ADiggerManager::GatherStreamingSourceLocations(TArray<FVector>& OutLocations) const
+{
+    OutLocations.Reset();
+    UWorld* StreamingWorld = GetWorld();
+    if (!StreamingWorld)
+    {
         return;
     }
 
-    
-    if (EditorBrushType == EVoxelBrushType::Light)
+    for (FConstPlayerControllerIterator It = StreamingWorld->GetPlayerControllerIterator(); It; ++It)
     {
-        // Default fallback
-        //BrushStroke.LightType = ELightBrushType::Point;
-    
-        // Get both light type and color from toolkit
-        if (GLevelEditorModeTools().IsModeActive(FDiggerEdMode::EM_DiggerEdModeId))
+        if (const APlayerController* PC = It->Get())
         {
-            UE_LOG(LogTemp, Warning, TEXT("getting both light type and color from toolkit!"));
-            FDiggerEdMode* DiggerMode = (FDiggerEdMode*)GLevelEditorModeTools().GetActiveMode(FDiggerEdMode::EM_DiggerEdModeId);
-           // if (DiggerMode && DiggerMode->GetToolkit().IsValid())
-            {
-                TSharedPtr<FDiggerEdModeToolkit> Toolkit = StaticCastSharedPtr<FDiggerEdModeToolkit>(DiggerMode->GetToolkit());
-                if (Toolkit.IsValid())
-                {
-                    BrushStroke.LightType = Toolkit->GetCurrentLightType();
-                    BrushStroke.LightColor = Toolkit->GetCurrentLightColor(); // Add this line
-
-                    if (DiggerDebug::Lights || DiggerDebug::Brush)
-                    {
-                        UE_LOG(LogTemp, Warning, TEXT("Light type from toolkit: %d, Color: %s"), 
-                               (int32)BrushStroke.LightType, 
-                               *BrushStroke.LightColor.ToString());
-                    }
-                }
-            }
-        }
-        if (DiggerDebug::Lights || DiggerDebug::Brush)
-        {
-            UE_LOG(LogTemp, Warning, TEXT("ApplyBrushInEditor: this = %p"), this);
-            UE_LOG(LogTemp, Warning, TEXT("ApplyBrushInEditor: EditorBrushType = %d"), (int32)EditorBrushType);
+            FVector ViewLocation;
+            FRotator ViewRotation;
+            PC->GetPlayerViewPoint(ViewLocation, ViewRotation);
+            OutLocations.Add(ViewLocation);
         }
-    
-        // Route to light handler with the full brush stroke
-        ApplyLightBrushInEditor(BrushStroke);
-        return;
-    }
-    
-    // Handle voxel brushes (existing logic)
-    if (DiggerDebug::Brush) {
-        UE_LOG(LogTemp, Warning, TEXT("DiggerManager.cpp: Extent X: %.2f  Extent Y: %.2f  Extent Z: %.2f"),
-               BrushStroke.AdvancedCubeHalfExtentX,
-               BrushStroke.AdvancedCubeHalfExtentY,
-               BrushStroke.AdvancedCubeHalfExtentZ);
     }
-    
-    if (DiggerDebug::Brush || DiggerDebug::Casts)
+
+    for (const TWeakObjectPtr<AActor>& Source : StreamingSourceActors)
     {
-        UE_LOG(LogTemp, Warning, TEXT("[ApplyBrushInEditor] EditorBrushPosition (World): %s"), *EditorBrushPosition.ToString());
+        if (const AActor* SourceActor = Source.Get())
+        {
+            OutLocations.Add(SourceActor->GetActorLocation());
+        }
     }
+}
 
-    ApplyBrushToAllChunks(BrushStroke);
-    ProcessDirtyChunks();
-
-    if (GEditor)
+float ADiggerManager::GetDistSqToNearestStreamingSource(const FIntVector& ChunkCoords, const TArray<FVector>& Sources)
+{
+    // ChunkToWorld is the chunk centre
+    const FVector Center = FVoxelConversion::ChunkToWorld(ChunkCoords);
+    float BestDistSq = TNumericLimits<float>::Max();
+    for (const FVector& Source : Sources)
     {
-        GEditor->RedrawAllViewports();
+        BestDistSq = FMath::Min(BestDistSq, (float)FVector::DistSquared(Center, Source));
     }
-
-    // Update islands for the UI/toolkit
-    TArray<FIslandData> DetectedIslands = DetectUnifiedIslands();
+    return BestDistSq;
 }
 
-void ADiggerManager::RemoveIslandAtPosition(const FVector& IslandCenter, const FIntVector& ReferenceVoxel)
+void ADiggerManager::UpdateChunkStreaming()
 {
-    UE_LOG(LogTemp, Warning, TEXT("[DiggerPro] RemoveIslandAtPosition called at %s"), *IslandCenter.ToString());
-
-    // Guard 1: Reference voxel must be valid
-    if (!ensure(!ReferenceVoxel.IsZero()))
+    if (!bEnableChunkStreaming)
     {
-        UE_LOG(LogTemp, Error, TEXT("[DiggerPro] No reference voxel provided."));
         return;
     }
 
-    FIntVector ChunkCoords, LocalVoxel;
-    FVoxelConversion::GlobalVoxelToChunkAndLocal_CenterAligned(ReferenceVoxel, ChunkCoords, LocalVoxel);
-
-    // Guard 2: Chunk must exist and be valid
-    UVoxelChunk** ChunkPtr = ChunkMap.Find(ChunkCoords);
-    if (!ChunkPtr || !IsValid(*ChunkPtr))
+    TArray<FVector> Sources;
+    GatherStreamingSourceLocations(Sources);
+    if (Sources.Num() == 0)
     {
-        UE_LOG(LogTemp, Error, TEXT("[DiggerPro] Invalid or missing chunk at coords %s"), *ChunkCoords.ToString());
+        // Nobody to stream around yet, keep everything where it is
         return;
     }
 
-    UVoxelChunk* Chunk = *ChunkPtr;
+    // Unload radius always leaves a chunk of slack over the load radius so border chunks don't flap
+    const float LoadRadiusSq = FMath::Square(StreamingLoadRadius);
+    const float UnloadRadiusSq = FMath::Square(FMath::Max(StreamingUnloadRadius, StreamingLoadRadius + FVoxelConversion::ChunkWorldSize));
 
-    // Guard 3: Grid must exist and be valid
-    USparseVoxelGrid* Grid = Chunk->GetSparseVoxelGrid();
-    if (!IsValid(Grid))
+    // Out: farthest first
+    TArray<TPair<float, FIntVector>> EvictCandidates;
+    for (const TPair<FIntVector, UVoxelChunk*>& Pair : ChunkMap)
     {
-        UE_LOG(LogTemp, Error, TEXT("[DiggerPro] Invalid SparseVoxelGrid in chunk."));
-        return;
+        const float DistSq = GetDistSqToNearestStreamingSource(Pair.Key, Sources);
+        if (DistSq > UnloadRadiusSq)
+        {
+            EvictCandidates.Emplace(DistSq, Pair.Key);
+        }
+    }
+    if (EvictCandidates.Num() > 0)
+    {
+        EvictCandidates.Sort([](const TPair<float, FIntVector>& A, const TPair<float, FIntVector>& B) { return A.Key > B.Key; });
+        TArray<FIntVector> ToEvict;
+        for (int32 i = 0; i < EvictCandidates.Num() && i < MaxChunksEvictedPerUpdate; ++i)
+        {
+            ToEvict.Add(EvictCandidates[i].Value);
+        }
+        EvictChunks(ToEvict);
     }
 
-    // Guard 4: Attempt island extraction
-    USparseVoxelGrid* ExtractedIsland = nullptr;
-    TArray<FIntVector> ExtractedVoxels;
-
-    if (!Grid->ExtractIslandByVoxel(LocalVoxel, ExtractedIsland, ExtractedVoxels) || !IsValid(ExtractedIsland) || ExtractedVoxels.IsEmpty())
+    // In: nearest first, one batch in flight at a time
+    if (StreamingChunkLoad.IsValid() || StreamedOutChunks.Num() == 0)
     {
-        UE_LOG(LogTemp, Error, TEXT("[DiggerPro] Failed to extract island at voxel %s"), *LocalVoxel.ToString());
         return;
     }
 
-    // Safe voxel removal (encapsulated)
-    Grid->RemoveVoxels(ExtractedVoxels);
-    Chunk->MarkDirty();
+    TArray<TPair<float, FIntVector>> LoadCandidates;
+    for (const FIntVector& ChunkCoords : StreamedOutChunks)
+    {
+        const float DistSq = GetDistSqToNearestStreamingSource(ChunkCoords, Sources);
+        if (DistSq <= LoadRadiusSq)
+        {
+            LoadCandidates.Emplace(DistSq, ChunkCoords);
+        }
+    }
+    if (LoadCandidates.Num() == 0)
+    {
+        return;
+    }
 
-    UE_LOG(LogTemp, Display, TEXT("[DiggerPro] Successfully removed %d voxels at %s."), ExtractedVoxels.Num(), *IslandCenter.ToString());
-}
+    LoadCandidates.Sort([](const TPair<float, FIntVector>& A, const TPair<float, FIntVector>& B) { return A.Key < B.Key; });
+    TArray<FIntVector> ToLoad;
+    for (int32 i = 0; i < LoadCandidates.Num() && i < MaxChunksStreamedInPerUpdate; ++i)
+    {
+        const FIntVector& ChunkCoords = LoadCandidates[i].Value;
+        StreamedOutChunks.Remove(ChunkCoords);
+        StreamingInFlight.Add(ChunkCoords);
+        ToLoad.Add(ChunkCoords);
+    }
 
-
-
-
-void ADiggerManager::ApplyLightBrushInEditor(const FBrushStroke& BrushStroke)
-{
-    if (DiggerDebug::Lights || DiggerDebug::Brush) {
-        UE_LOG(LogTemp, Warning, TEXT("ApplyLightBrushInEditor called at position: %s"), *BrushStroke.BrushPosition.ToString());
-        UE_LOG(LogTemp, Warning, TEXT("Light stroke - Type: %d, Radius: %f, Strength: %f, Rotation: %s"), 
-               (int32)BrushStroke.LightType, 
-               BrushStroke.BrushRadius, 
-               BrushStroke.BrushStrength,
-               *BrushStroke.BrushRotation.ToString());
+    if (DiggerDebug::IO || DiggerDebug::Chunks)
+    {
+        UE_LOG(LogTemp, Log, TEXT("Chunk streaming: loading %d chunks (%d still on disk)"), ToLoad.Num(), StreamedOutChunks.Num());
     }
 
-    // Now you have access to all brush stroke properties:
-    // - BrushStroke.BrushPosition
-    // - BrushStroke.BrushRadius  
-    // - BrushStroke.BrushStrength
-    // - BrushStroke.BrushRotation (for future light rotation)
-    // - BrushStroke.LightType
-    // - Any other properties you add later
-
-    SpawnLight(BrushStroke);
-
-    // Redraw viewports to show the new light
-    if (GEditor)
+    StreamingChunkLoad = MakeShared<FChunkLoadQueue, ESPMode::ThreadSafe>();
+    TSharedPtr<FChunkLoadQueue, ESPMode::ThreadSafe> Queue = StreamingChunkLoad;
+    Async(EAsyncExecution::ThreadPool, [Queue, Sources = GatherChunkLoadSources(*this, StreamingSaveFileName, ToLoad, false)]()
     {
-        GEditor->RedrawAllViewports();
-    }
+        DecodeSavedChunks(*Queue, Sources);
+    });
+    ScheduleChunkLoadPump();
 }
 
-
-
-
-#endif
-void ADiggerManager::OnConstruction(const FTransform& Transform)
+int32 ADiggerManager::EvictChunks(const TArray<FIntVector>& ChunkCoords)
 {
-    Super::OnConstruction(Transform);
-
-    // Initialize the Hole Shape Library
-    InitHoleShapeLibrary();
-
-    // Populate Landscape Height Cache.
-    for (TActorIterator<ALandscapeProxy> It(GetWorld()); It; ++It)
+    // Unsaved chunks go to disk first, one write per region like SaveAllChunks
+    TArray<UVoxelChunk*> Evictable;
+    TMap<FIntVector, TMap<FIntVector, TArray<uint8>>> PayloadsByRegion;
+    for (const FIntVector& Coords : ChunkCoords)
     {
-        ALandscapeProxy* Landscape = *It;
-        if (Landscape)
+        UVoxelChunk** ChunkPtr = ChunkMap.Find(Coords);
+        if (!ChunkPtr || !IsValid(*ChunkPtr))
         {
-            HeightCacheLoadingSet.Add(Landscape);
-            PopulateLandscapeHeightCache(Landscape);
+            ChunkMap.Remove(Coords);
+            continue;
         }
-    }
-    
-    FVoxelConversion::InitFromConfig(ChunkSize,Subdivisions, TerrainGridSize, GetActorLocation());
-}
 
+        // Its mesh job still holds the generator, try again next update
+        if (InFlightMeshJobs.Contains(Coords))
+        {
+            continue;
+        }
 
-void ADiggerManager::InitHoleShapeLibrary()
-{
-    if (!HoleShapeLibrary)
-    {
-        // Load class dynamically
-        const FSoftClassPath LibraryClassRef(TEXT("/Game/Blueprints/MyHoleShapeLibrary.MyHoleShapeLibrary_C"));
-        UClass* LoadedClass = LibraryClassRef.TryLoadClass<UHoleShapeLibrary>();
+        UVoxelChunk* Chunk = *ChunkPtr;
 
-        if (LoadedClass)
+        // Mid-stroke, the capture would be lost with the grid
+        if (Chunk->GetSparseVoxelGrid() && Chunk->GetSparseVoxelGrid()->HasUndoCapture())
         {
-            HoleShapeLibrary = NewObject<UHoleShapeLibrary>(this, LoadedClass);
-            UE_LOG(LogTemp, Warning, TEXT("HoleShapeLibrary created at runtime successfully."));
+            continue;
         }
-        else
+        if (Chunk->HasUnsavedChanges())
         {
-            UE_LOG(LogTemp, Error, TEXT("Failed to load MyHoleShapeLibrary class dynamically."));
+            TMap<FIntVector, TArray<uint8>>& RegionPayloads = PayloadsByRegion.FindOrAdd(FVoxelRegionFile::ChunkToRegion(Coords));
+            if (!Chunk->SaveChunkPayload(RegionPayloads.Add(Coords)))
+            {
+                RegionPayloads.Remove(Coords);
+                continue;
+            }
         }
+        Evictable.Add(Chunk);
     }
-}
-
 
+    TSet<FIntVector> FailedRegions;
+    if (PayloadsByRegion.Num() > 0)
+    {
+        EnsureSaveFileDirectoryExists(StreamingSaveFileName);
+        const FString SaveDir = GetSaveFileDirectory(StreamingSaveFileName);
+        for (const auto& RegionPair : PayloadsByRegion)
+        {
+            if (RegionPair.Value.Num() == 0)
+            {
+                continue;
+            }
 
-ADiggerManager::ADiggerManager()
-{
-#if WITH_EDITOR  
-    this->SetFlags(RF_Transactional); // Enable undo/redo support in editor
-#endif
+            if (FVoxelRegionFile::WriteChunks(FVoxelRegionFile::GetRegionFilePath(SaveDir, RegionPair.Key), RegionPair.Value, TSet<FIntVector>()))
+            {
+                for (const auto& ChunkPayload : RegionPair.Value)
+                {
+                    IFileManager::Get().Delete(*GetChunkFilePath(ChunkPayload.Key, StreamingSaveFileName), false, false, true);
+                }
+            }
+            else
+            {
+                FailedRegions.Add(RegionPair.Key);
+            }
+        }
+        InvalidateSavedChunkCache(StreamingSaveFileName);
+    }
 
-    // Initialize the ProceduralMeshComponent
-    ProceduralMesh = CreateDefaultSubobject<UProceduralMeshComponent>(TEXT("GeneratedMesh"));
-    RootComponent = ProceduralMesh;
+    int32 NumEvicted = 0;
+    for (UVoxelChunk* Chunk : Evictable)
+    {
+        const FIntVector Coords = Chunk->GetChunkCoordinates();
+        if (Chunk->HasUnsavedChanges())
+        {
+            if (FailedRegions.Contains(FVoxelRegionFile::ChunkToRegion(Coords)))
+            {
+                // Better to keep it in memory than to lose the edits
+                UE_LOG(LogTemp, Error, TEXT("Chunk streaming: failed to save chunk %s, keeping it loaded"), *Coords.ToString());
+                continue;
+            }
+            Chunk->ClearUnsavedChanges();
+        }
 
-    // Initialize the voxel grid and marching cubes
-    SparseVoxelGrid = CreateDefaultSubobject<USparseVoxelGrid>(TEXT("SparseVoxelGrid"));
-    MarchingCubes = CreateDefaultSubobject<UMarchingCubes>(TEXT("MarchingCubes"));
-    
-    
+        // Clean and non-empty means it came from (or went to) disk; empty chunks have nothing to bring back
+        const USparseVoxelGrid* Grid = Chunk->GetSparseVoxelGrid();
+        if ((Grid && Grid->VoxelData.Num() > 0) || Chunk->HoleDataArray.Num() > 0)
+        {
+            StreamedOutChunks.Add(Coords);
+        }
 
-    // Load the material in the constructor
-    static ConstructorHelpers::FObjectFinder<UMaterial> Material(TEXT("/Game/Materials/M_VoxelMat.M_VoxelMat"));
-    if (Material.Succeeded())
-    {
-        TerrainMaterial = Material.Object;
+        ReleaseChunk(Chunk);
+        ++NumEvicted;
     }
-    else
+
+    if (NumEvicted > 0 && (DiggerDebug::IO || DiggerDebug::Chunks))
     {
-        if (DiggerDebug::UserConv)
-        {
-            UE_LOG(LogTemp, Error, TEXT("Material M_ProcGrid required in /Content/Materials/ folder. Please ensure it is there."));
-        }
+        UE_LOG(LogTemp, Log, TEXT("Chunk streaming: evicted %d chunks (%d resident, %d on disk)"),
+            NumEvicted, ChunkMap.Num(), StreamedOutChunks.Num());
     }
+    return NumEvicted;
 }
 
-void ADiggerManager::SpawnLight(const FBrushStroke& BrushStroke)
+void ADiggerManager::ReleaseChunk(UVoxelChunk* Chunk)
 {
-    if (!GetWorld())
+    const FIntVector Coords = Chunk->GetChunkCoordinates();
+
+    MeshQueue.Remove(Coords);
+    PendingCollisionCooks.Remove(Coords);
+    ChunkLoadAwaitingMesh.Remove(Coords);
+
+    Chunk->ClearSpawnedHoles();
+    if (UProceduralMeshComponent* MeshComponent = Chunk->GetMeshComponent())
     {
-        if (DiggerDebug::Lights || DiggerDebug::Brush || DiggerDebug::Context)
-        UE_LOG(LogTemp, Error, TEXT("SpawnLight: World is null"));
-        return;
+        ProceduralMeshComponents.Remove(MeshComponent);
+        RemoveInstanceComponent(MeshComponent);
+        MeshComponent->DestroyComponent();
+    }
+    if (UProceduralMeshComponent* CollisionComponent = Chunk->GetCollisionComponent())
+    {
+        RemoveInstanceComponent(CollisionComponent);
+        CollisionComponent->DestroyComponent();
     }
 
-    FVector FinalPosition = BrushStroke.BrushPosition + BrushStroke.BrushOffset;
-    FRotator Rotation = BrushStroke.BrushRotation;
+    // Nothing else holds the chunk, its grid and generator go with the next GC
+    ChunkMap.Remove(Coords);
+}
 
-    ADynamicLightActor* Light = GetWorld()->SpawnActor<ADynamicLightActor>(
-        ADynamicLightActor::StaticClass(), FinalPosition, Rotation);
+bool ADiggerManager::RestoreStreamedOutChunk(UVoxelChunk* Chunk)
+{
+    const FIntVector Coords = Chunk->GetChunkCoordinates();
 
-    if (Light)
+    bool bRestored = false;
+    TArray<uint8> Payload;
+    if (FVoxelRegionFile::ReadChunk(GetRegionFilePath(Coords, StreamingSaveFileName), Coords, Payload))
     {
-        Light->InitializeFromBrush(BrushStroke);
-        SpawnedLights.Add(Light);
-
-        if (DiggerDebug::Lights || DiggerDebug::Brush)
-        UE_LOG(LogTemp, Warning, TEXT("Successfully spawned dynamic light actor of type %d"), (int32)BrushStroke.LightType);
+        bRestored = Chunk->LoadChunkPayload(Payload, false);
     }
     else
     {
-        if (DiggerDebug::Lights || DiggerDebug::Brush)
-        UE_LOG(LogTemp, Error, TEXT("Failed to spawn dynamic light actor"));
+        const FString FilePath = GetChunkFilePath(Coords, StreamingSaveFileName);
+        bRestored = FPaths::FileExists(FilePath) && Chunk->LoadChunkData(FilePath, false);
     }
-}
-
 
-void ADiggerManager::PostInitProperties()
-{
-    Super::PostInitProperties();
-    if (!HasAnyFlags(RF_ClassDefaultObject))
+    if (!bRestored)
     {
-        InitializeBrushShapes();
+        UE_LOG(LogTemp, Error, TEXT("Chunk streaming: failed to read chunk %s back from '%s'"), *Coords.ToString(), *StreamingSaveFileName);
     }
-}
 
+    Chunk->MarkDirty();
+    Chunk->ClearUnsavedChanges();
+    return bRestored;
+}
 
-// In ADiggerManager.cpp
-void ADiggerManager::InitializeBrushShapes()
+// Overload for backward compatibility
+bool ADiggerManager::LoadAllChunks()
 {
-    // Clear existing brushes
-    BrushShapeMap.Empty();
-
-    // Initialize all available brush shapes
-    BrushShapeMap.Add(EVoxelBrushType::Sphere, NewObject<USphereBrushShape>(this));
-    BrushShapeMap.Add(EVoxelBrushType::Cube, NewObject<UCubeBrushShape>(this));
-    BrushShapeMap.Add(EVoxelBrushType::Cone, NewObject<UConeBrushShape>(this));
-    BrushShapeMap.Add(EVoxelBrushType::Cylinder, NewObject<UCylinderBrushShape>(this));
-    BrushShapeMap.Add(EVoxelBrushType::Capsule, NewObject<UCapsuleBrushShape>(this));
-    BrushShapeMap.Add(EVoxelBrushType::Torus, NewObject<UTorusBrushShape>(this));
-    BrushShapeMap.Add(EVoxelBrushType::Pyramid, NewObject<UPyramidBrushShape>(this));
-    BrushShapeMap.Add(EVoxelBrushType::Icosphere, NewObject<UIcosphereBrushShape>(this));
-    BrushShapeMap.Add(EVoxelBrushType::Smooth, NewObject<USmoothBrushShape>(this));
-    
-    // Log initialization for debugging
-    /*UE_LOG(LogTemp, Warning, TEXT("Initializing brush shapes..."));
-    for (const auto& Pair : BrushShapeMap)
-    {
-        UE_LOG(LogTemp, Warning, TEXT("Initialized %s for brush type %d"), 
-            *Pair.Value->GetClass()->GetName(), 
-            (int32)Pair.Key);
-    }*/
-
-    // If there's an ActiveBrush member, we should probably handle it differently
-    // Can you show me the ActiveBrush related code so we can fix that?
+    return LoadAllChunks(TEXT("Default"));
 }
 
-UVoxelBrushShape* ADiggerManager::GetActiveBrushShape(EVoxelBrushType BrushType) const
+TArray<FIntVector> ADiggerManager::GetAllSavedChunkCoordinates(const FString& SaveFileName, bool bForceRefresh)
 {
-    if (UVoxelBrushShape* const* Found = BrushShapeMap.Find(BrushType))
+    // Use per-save-file caching
+    FString CacheKey = SaveFileName;
+    
+    if (!bForceRefresh && SavedChunkCache.Contains(CacheKey))
     {
-        return *Found;
+        return SavedChunkCache[CacheKey];
     }
-    return nullptr;
-}
-
-
-/*void ADiggerManager::ApplyBrushAtCameraHit()
-{
-    // Get the active brush shape
-    const UVoxelBrushShape* ActiveBrushShape = GetActiveBrushShape(ActiveBrush->GetBrushType());
-    if (!ActiveBrushShape)
+    
+    TArray<FIntVector> SavedChunks;
+    FString SaveDir = GetSaveFileDirectory(SaveFileName);
+    
+    if (!FPaths::DirectoryExists(SaveDir))
     {
-        UE_LOG(LogTemp, Error, TEXT("ActiveBrushShape is null"));
-        return;
+        // Directory doesn't exist, so no saved chunks
+        SavedChunkCache.Add(CacheKey, SavedChunks);
+        return SavedChunks;
+    }
+    
+    // Region packs: just the offset tables
+    TSet<FIntVector> SeenChunks;
+    TArray<FString> RegionFiles;
+    FFileManagerGeneric::Get().FindFiles(RegionFiles, *(SaveDir / FString::Printf(TEXT("*%s"), FVoxelRegionFile::Extension)), true, false);
+    for (const FString& FileName : RegionFiles)
+    {
+        TArray<FVoxelRegionFile::FEntry> Entries;
+        if (FVoxelRegionFile::ReadTable(SaveDir / FileName, Entries))
+        {
+            for (const FVoxelRegionFile::FEntry& Entry : Entries)
+            {
+                if (!SeenChunks.Contains(Entry.ChunkCoords))
+                {
+                    SeenChunks.Add(Entry.ChunkCoords);
+                    SavedChunks.Add(Entry.ChunkCoords);
+                }
+            }
+        }
     }
 
-    // Get hit location
-    FHitResult HitResult;
-    if (!ActiveBrushShape->GetCameraHitLocation(HitResult))
+    // Per-chunk files from older saves
+    TArray<FString> FoundFiles;
+    FString SearchPattern = SaveDir / FString::Printf(TEXT("*%s"), *CHUNK_FILE_EXTENSION);
+    FFileManagerGeneric::Get().FindFiles(FoundFiles, *SearchPattern, true, false);
+    
+    for (const FString& FileName : FoundFiles)
     {
-        UE_LOG(LogTemp, Warning, TEXT("No valid hit found"));
-        return;
+        // Parse filename to extract coordinates
+        FString BaseName = FPaths::GetBaseFilename(FileName);
+        
+        // Expected format: Chunk_X_Y_Z
+        TArray<FString> Parts;
+        BaseName.ParseIntoArray(Parts, TEXT("_"), true);
+        
+        if (Parts.Num() >= 4 && Parts[0] == TEXT("Chunk"))
+        {
+            int32 X = FCString::Atoi(*Parts[1]);
+            int32 Y = FCString::Atoi(*Parts[2]);
+            int32 Z = FCString::Atoi(*Parts[3]);
+            
+            if (!SeenChunks.Contains(FIntVector(X, Y, Z)))
+            {
+                SavedChunks.Add(FIntVector(X, Y, Z));
+            }
+        }
     }
+    
+    // Cache the results
+    SavedChunkCache.Add(CacheKey, SavedChunks);
+    
+    return SavedChunks;
+}
 
-    // Create brush stroke with correct data
-    FBrushStroke BrushStroke;
-    BrushStroke.BrushPosition = HitResult.Location;
-    BrushStroke.BrushRadius = ActiveBrush->GetBrushSize();
-    BrushStroke.BrushFalloff = 0.f;
-    BrushStroke.BrushStrength = 1.f;
-    BrushStroke.bDig = ActiveBrush->GetDig();
-    BrushStroke.BrushType = ActiveBrush->GetBrushType();
+// Overload for backward compatibility
+TArray<FIntVector> ADiggerManager::GetAllSavedChunkCoordinates(bool bForceRefresh)
+{
+    return GetAllSavedChunkCoordinates(TEXT("Default"), bForceRefresh);
+}
+
+TArray<FString> ADiggerManager::GetAllSaveFileNames() const
+{
+    TArray<FString> SaveFileNames;
+    FString MainDir = FPaths::ProjectContentDir() / VOXEL_DATA_DIRECTORY;
+    
+    UE_LOG(LogTemp, Log, TEXT("GetAllSaveFileNames: Searching in directory: %s"), *MainDir);
+    
+    if (!FPaths::DirectoryExists(MainDir))
+    {
+        UE_LOG(LogTemp, Log, TEXT("GetAllSaveFileNames: Main directory does not exist"));
+        return SaveFileNames;
+    }
+    
+    // Get all entries in the main directory
+    TArray<FString> DirectoryContents;
+    IFileManager& FileManager = IFileManager::Get();
+    FileManager.FindFiles(DirectoryContents, *(MainDir / TEXT("*")), false, true);
+    
+    UE_LOG(LogTemp, Log, TEXT("Found %d potential directories"), DirectoryContents.Num());
+    
+    // Check each directory to see if it contains chunk files
+    for (const FString& DirName : DirectoryContents)
+    {
+        FString FullDirPath = MainDir / DirName;
+        
+        UE_LOG(LogTemp, Log, TEXT("Checking directory: %s"), *DirName);
+        
+        // Skip any hidden directories or files
+        if (DirName.StartsWith(TEXT(".")))
+        {
+            UE_LOG(LogTemp, Log, TEXT("Skipping hidden directory: %s"), *DirName);
+            continue;
+        }
+        
+        // Verify it's actually a directory
+        if (!FPaths::DirectoryExists(FullDirPath))
+        {
+            UE_LOG(LogTemp, Log, TEXT("Not a directory: %s"), *DirName);
+            continue;
+        }
+        
+        // Check if this directory contains chunk files
+        TArray<FString> ChunkFiles;
+        FString ChunkSearchPattern = FullDirPath / FString::Printf(TEXT("*%s"), *CHUNK_FILE_EXTENSION);
+        FileManager.FindFiles(ChunkFiles, *ChunkSearchPattern, true, false);
+        FileManager.FindFiles(ChunkFiles, *(FullDirPath / FString::Printf(TEXT("*%s"), FVoxelRegionFile::Extension)), true, false);
+        
+        UE_LOG(LogTemp, Log, TEXT("Directory '%s' contains %d chunk files"), *DirName, ChunkFiles.Num());
+        
+        if (ChunkFiles.Num() > 0)
+        {
+            SaveFileNames.Add(DirName);
+            UE_LOG(LogTemp, Log, TEXT("Added '%s' to save files list"), *DirName);
+        }
+        else
+        {
+            UE_LOG(LogTemp, Log, TEXT("Skipping '%s' - no chunk files found"), *DirName);
+        }
+    }
+    
+    UE_LOG(LogTemp, Log, TEXT("GetAllSaveFileNames: Final result - %d save files: [%s]"), 
+        SaveFileNames.Num(), *FString::Join(SaveFileNames, TEXT(", ")));
+    
+    return SaveFileNames;
+}
+
+bool ADiggerManager::DeleteSaveFile(const FString& SaveFileName)
+{
+    FString SaveDir = GetSaveFileDirectory(SaveFileName);
+    
+    if (!FPaths::DirectoryExists(SaveDir))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Cannot delete save file '%s' - directory does not exist"), *SaveFileName);
+        return false;
+    }
+    
+    // Delete all files in the directory first
+    TArray<FString> FilesToDelete;
+    FFileManagerGeneric::Get().FindFilesRecursive(FilesToDelete, *SaveDir, TEXT("*"), true, false);
+    
+    bool bAllFilesDeleted = true;
+    for (const FString& FileToDelete : FilesToDelete)
+    {
+        if (!FPlatformFileManager::Get().GetPlatformFile().DeleteFile(*FileToDelete))
+        {
+            UE_LOG(LogTemp, Error, TEXT("Failed to delete file: %s"), *FileToDelete);
+            bAllFilesDeleted = false;
+        }
+    }
+    
+    // Delete the directory itself
+    bool bDirectoryDeleted = FPlatformFileManager::Get().GetPlatformFile().DeleteDirectory(*SaveDir);
+    
+    if (bDirectoryDeleted && bAllFilesDeleted)
+    {
+        UE_LOG(LogTemp, Log, TEXT("Successfully deleted save file '%s'"), *SaveFileName);
+        
+        // Remove from cache
+        InvalidateSavedChunkCache(SaveFileName);
+        
+        return true;
+    }
+    else
+    {
+        UE_LOG(LogTemp, Error, TEXT("Failed to completely delete save file '%s'"), *SaveFileName);
+        return false;
+    }
+}
+
+void ADiggerManager::InvalidateSavedChunkCache(const FString& SaveFileName)
+{
+    if (SaveFileName.IsEmpty())
+    {
+        // Clear all cache entries
+        SavedChunkCache.Empty();
+    }
+    else
+    {
+        // Clear specific save file cache
+        SavedChunkCache.Remove(SaveFileName);
+    }
+}
+
+
+//End New Multi Save Files System.
+
+
+FBrushStroke ADiggerManager::MakeEditorBrushStroke(bool bDig) const
+{
+    // Create the brush stroke with all the editor properties
+    FBrushStroke BrushStroke;
+    BrushStroke.BrushPosition = EditorBrushPosition + EditorBrushOffset;
+    BrushStroke.BrushRadius = EditorBrushRadius;
+    BrushStroke.BrushRotation = EditorBrushRotation;
+    BrushStroke.bHiddenSeam = EditorBrushHiddenSeam;
+    UE_LOG(LogTemp, Warning, TEXT("Seam Type Received in DiggerManager type: %s"), EditorBrushHiddenSeam ? TEXT("true") : TEXT("false"));
+    BrushStroke.BrushType = EditorBrushType;
+    BrushStroke.bDig = bDig;
+    BrushStroke.BrushLength = EditorBrushLength;
+    BrushStroke.bIsFilled = EditorBrushIsFilled;
+    BrushStroke.BrushAngle = EditorBrushAngle;
+    BrushStroke.HoleShape = EditorBrushHoleShape;
+    BrushStroke.bUseAdvancedCubeBrush = EditorbUseAdvancedCubeBrush;
+    BrushStroke.AdvancedCubeHalfExtentX = EditorCubeHalfExtentX;
+    BrushStroke.AdvancedCubeHalfExtentY = EditorCubeHalfExtentY;
+    BrushStroke.AdvancedCubeHalfExtentZ = EditorCubeHalfExtentZ;
+    BrushStroke.BrushStrength = EditorBrushStrength; // Make sure this is set
+    // In your ApplyBrushInEditor method, add this line when creating the BrushStroke:
+    BrushStroke.LightColor = EditorBrushLightColor;
+    return BrushStroke;
+}
+
+void ADiggerManager::ApplyBrushInEditor(bool bDig)
+{
+    if (DiggerDebug::Brush) {
+        UE_LOG(LogTemp, Error, TEXT("ApplyBrushInEditor Called!"));
+    }
+
+    FBrushStroke BrushStroke = MakeEditorBrushStroke(bDig);
+    
+    // Set light-specific properties if it's a light brush
+    if (EditorBrushType == EVoxelBrushType::Light)
+    {
+        BrushStroke.LightType = EditorBrushLightType;
+        BrushStroke.LightColor = EditorBrushLightColor;
+
+        if (DiggerDebug::Lights || DiggerDebug::Brush)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("Light brush setup: LightType = %d, Color = %s"),
+                (int32)BrushStroke.LightType,
+                *BrushStroke.LightColor.ToString());
+        }
+
+        ApplyLightBrushInEditor(BrushStroke);
+        return;
+    }
+
+    
+    if (EditorBrushType == EVoxelBrushType::Light)
+    {
+        // Default fallback
+        //BrushStroke.LightType = ELightBrushType::Point;
+    
+        // Get both light type and color from toolkit
+        if (GLevelEditorModeTools().IsModeActive(FDiggerEdMode::EM_DiggerEdModeId))
+        {
+            UE_LOG(LogTemp, Warning, TEXT("getting both light type and color from toolkit!"));
+            FDiggerEdMode* DiggerMode = (FDiggerEdMode*)GLevelEditorModeTools().GetActiveMode(FDiggerEdMode::EM_DiggerEdModeId);
+           // if (DiggerMode && DiggerMode->GetToolkit().IsValid())
+            {
+                TSharedPtr<FDiggerEdModeToolkit> Toolkit = StaticCastSharedPtr<FDiggerEdModeToolkit>(DiggerMode->GetToolkit());
+                if (Toolkit.IsValid())
+                {
+                    BrushStroke.LightType = Toolkit->GetCurrentLightType();
+                    BrushStroke.LightColor = Toolkit->GetCurrentLightColor(); // Add this line
+
+                    if (DiggerDebug::Lights || DiggerDebug::Brush)
+                    {
+                        UE_LOG(LogTemp, Warning, TEXT("Light type from toolkit: %d, Color: %s"), 
+                               (int32)BrushStroke.LightType, 
+                               *BrushStroke.LightColor.ToString());
+                    }
+                }
+            }
+        }
+        if (DiggerDebug::Lights || DiggerDebug::Brush)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("ApplyBrushInEditor: this = %p"), this);
+            UE_LOG(LogTemp, Warning, TEXT("ApplyBrushInEditor: EditorBrushType = %d"), (int32)EditorBrushType);
+        }
+    
+        // Route to light handler with the full brush stroke
+        ApplyLightBrushInEditor(BrushStroke);
+        return;
+    }
+    
+    // Handle voxel brushes (existing logic)
+    if (DiggerDebug::Brush) {
+        UE_LOG(LogTemp, Warning, TEXT("DiggerManager.cpp: Extent X: %.2f  Extent Y: %.2f  Extent Z: %.2f"),
+               BrushStroke.AdvancedCubeHalfExtentX,
+               BrushStroke.AdvancedCubeHalfExtentY,
+               BrushStroke.AdvancedCubeHalfExtentZ);
+    }
+    
+    if (DiggerDebug::Brush || DiggerDebug::Casts)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[ApplyBrushInEditor] EditorBrushPosition (World): %s"), *EditorBrushPosition.ToString());
+    }
+
+    ApplyBrushToAllChunks(BrushStroke);
+    ProcessDirtyChunks();
+
+    if (GEditor)
+    {
+        GEditor->RedrawAllViewports();
+    }
+
+    // Update islands for the UI/toolkit
+    TArray<FIslandData> DetectedIslands = DetectUnifiedIslands();
+}
+
+void ADiggerManager::ApplyBrushStrokesInEditor(TArray<FBrushStroke>& Strokes)
+{
+    if (Strokes.Num() == 0)
+    {
+        return;
+    }
+
+    // One remesh, redraw and island pass for the whole batch instead of one per stamp
+    ApplyBrushStrokesToAllChunks(Strokes);
+    ProcessDirtyChunks();
+
+    if (GEditor)
+    {
+        GEditor->RedrawAllViewports();
+    }
+
+    // Update islands for the UI/toolkit
+    TArray<FIslandData> DetectedIslands = DetectUnifiedIslands();
+}
+
+void ADiggerManager::RemoveIslandAtPosition(const FVector& IslandCenter, const FIntVector& ReferenceVoxel)
+{
+    UE_LOG(LogTemp, Warning, TEXT("[DiggerPro] RemoveIslandAtPosition called at %s"), *IslandCenter.ToString());
+
+    // Guard 1: Reference voxel must be valid
+    if (!ensure(!ReferenceVoxel.IsZero()))
+    {
+        UE_LOG(LogTemp, Error, TEXT("[DiggerPro] No reference voxel provided."));
+        return;
+    }
+
+    FIntVector ChunkCoords, LocalVoxel;
+    FVoxelConversion::GlobalVoxelToChunkAndLocal_CenterAligned(ReferenceVoxel, ChunkCoords, LocalVoxel);
+
+    // Guard 2: Chunk must exist and be valid
+    UVoxelChunk** ChunkPtr = ChunkMap.Find(ChunkCoords);
+    if (!ChunkPtr || !IsValid(*ChunkPtr))
+    {
+        UE_LOG(LogTemp, Error, TEXT("[DiggerPro] Invalid or missing chunk at coords %s"), *ChunkCoords.ToString());
+        return;
+    }
+
+    UVoxelChunk* Chunk = *ChunkPtr;
+
+    // Guard 3: Grid must exist and be valid
+    USparseVoxelGrid* Grid = Chunk->GetSparseVoxelGrid();
+    if (!IsValid(Grid))
+    {
+        UE_LOG(LogTemp, Error, TEXT("[DiggerPro] Invalid SparseVoxelGrid in chunk."));
+        return;
+    }
+
+    // Guard 4: Attempt island extraction
+    USparseVoxelGrid* ExtractedIsland = nullptr;
+    TArray<FIntVector> ExtractedVoxels;
+
+    if (!Grid->ExtractIslandByVoxel(LocalVoxel, ExtractedIsland, ExtractedVoxels) || !IsValid(ExtractedIsland) || ExtractedVoxels.IsEmpty())
+    {
+        UE_LOG(LogTemp, Error, TEXT("[DiggerPro] Failed to extract island at voxel %s"), *LocalVoxel.ToString());
+        return;
+    }
+
+    // Safe voxel removal (encapsulated)
+    Grid->RemoveVoxels(ExtractedVoxels);
+    Chunk->MarkDirty();
+
+    UE_LOG(LogTemp, Display, TEXT("[DiggerPro] Successfully removed %d voxels at %s."), ExtractedVoxels.Num(), *IslandCenter.ToString());
+}
+
+
+
+
+void ADiggerManager::ApplyLightBrushInEditor(const FBrushStroke& BrushStroke)
+{
+    if (DiggerDebug::Lights || DiggerDebug::Brush) {
+        UE_LOG(LogTemp, Warning, TEXT("ApplyLightBrushInEditor called at position: %s"), *BrushStroke.BrushPosition.ToString());
+        UE_LOG(LogTemp, Warning, TEXT("Light stroke - Type: %d, Radius: %f, Strength: %f, Rotation: %s"), 
+               (int32)BrushStroke.LightType, 
+               BrushStroke.BrushRadius, 
+               BrushStroke.BrushStrength,
+               *BrushStroke.BrushRotation.ToString());
+    }
+
+    // Now you have access to all brush stroke properties:
+    // - BrushStroke.BrushPosition
+    // - BrushStroke.BrushRadius  
+    // - BrushStroke.BrushStrength
+    // - BrushStroke.BrushRotation (for future light rotation)
+    // - BrushStroke.LightType
+    // - Any other properties you add later
+
+    SpawnLight(BrushStroke);
+
+    // Redraw viewports to show the new light
+    if (GEditor)
+    {
+        GEditor->RedrawAllViewports();
+    }
+}
+
+
+
+
+#endif
+void ADiggerManager::OnConstruction(const FTransform& Transform)
+{
+    Super::OnConstruction(Transform);
+
+    // Initialize the Hole Shape Library
+    InitHoleShapeLibrary();
+
+    RebuildLandscapeProxyIndex();
+
+    // Populate Landscape Height Cache. OnConstruction runs on every editor tweak, so only build what's missing
+    // and keep the work off the game thread.
+    for (TActorIterator<ALandscapeProxy> It(GetWorld()); It; ++It)
+    {
+        ALandscapeProxy* Landscape = *It;
+        if (Landscape && !HeightCacheLoadingSet.Contains(Landscape) && !FindLandscapeHeightfield(Landscape).IsValid())
+        {
+            HeightCacheLoadingSet.Add(Landscape);
+            PopulateLandscapeHeightCacheAsync(Landscape);
+        }
+    }
+    
+    FVoxelConversion::InitFromConfig(ChunkSize,Subdivisions, TerrainGridSize, GetActorLocation());
+
+    // Picks up bEnableMeshLOD being toggled in the details panel too
+    StartMeshLODUpdates();
+}
+
+
+void ADiggerManager::InitHoleShapeLibrary()
+{
+    if (!HoleShapeLibrary)
+    {
+        // Load class dynamically
+        const FSoftClassPath LibraryClassRef(TEXT("/Game/Blueprints/MyHoleShapeLibrary.MyHoleShapeLibrary_C"));
+        UClass* LoadedClass = LibraryClassRef.TryLoadClass<UHoleShapeLibrary>();
+
+        if (LoadedClass)
+        {
+            HoleShapeLibrary = NewObject<UHoleShapeLibrary>(this, LoadedClass);
+            UE_LOG(LogTemp, Warning, TEXT("HoleShapeLibrary created at runtime successfully."));
+        }
+        else
+        {
+            UE_LOG(LogTemp, Error, TEXT("Failed to load MyHoleShapeLibrary class dynamically."));
+        }
+    }
+}
+
+
+
+ADiggerManager::ADiggerManager()
+{
+#if WITH_EDITOR  
+    this->SetFlags(RF_Transactional); // Enable undo/redo support in editor
+#endif
+
+    // Networked strokes travel as a multicast on the manager (MulticastApplyBrushStrokeBatch)
+    bReplicates = true;
+
+    // Initialize the ProceduralMeshComponent
+    ProceduralMesh = CreateDefaultSubobject<UProceduralMeshComponent>(TEXT("GeneratedMesh"));
+    RootComponent = ProceduralMesh;
+
+    // Initialize the voxel grid and marching cubes
+    SparseVoxelGrid = CreateDefaultSubobject<USparseVoxelGrid>(TEXT("SparseVoxelGrid"));
+    MarchingCubes = CreateDefaultSubobject<UMarchingCubes>(TEXT("MarchingCubes"));
+    
+    
+
+    // Load the material in the constructor
+    static ConstructorHelpers::FObjectFinder<UMaterial> Material(TEXT("/Game/Materials/M_VoxelMat.M_VoxelMat"));
+    if (Material.Succeeded())
+    {
+        TerrainMaterial = Material.Object;
+    }
+    else
+    {
+        if (DiggerDebug::UserConv)
+        {
+            UE_LOG(LogTemp, Error, TEXT("Material M_ProcGrid required in /Content/Materials/ folder. Please ensure it is there."));
+        }
+    }
+}
+
+void ADiggerManager::SpawnLight(const FBrushStroke& BrushStroke)
+{
+    if (!GetWorld())
+    {
+        if (DiggerDebug::Lights || DiggerDebug::Brush || DiggerDebug::Context)
+        UE_LOG(LogTemp, Error, TEXT("SpawnLight: World is null"));
+        return;
+    }
+
+    FVector FinalPosition = BrushStroke.BrushPosition + BrushStroke.BrushOffset;
+    FRotator Rotation = BrushStroke.BrushRotation;
+
+    ADynamicLightActor* Light = GetWorld()->SpawnActor<ADynamicLightActor>(
+        ADynamicLightActor::StaticClass(), FinalPosition, Rotation);
+
+    if (Light)
+    {
+        Light->InitializeFromBrush(BrushStroke);
+        SpawnedLights.Add(Light);
+
+        if (DiggerDebug::Lights || DiggerDebug::Brush)
+        UE_LOG(LogTemp, Warning, TEXT("Successfully spawned dynamic light actor of type %d"), (int32)BrushStroke.LightType);
+    }
+    else
+    {
+        if (DiggerDebug::Lights || DiggerDebug::Brush)
+        UE_LOG(LogTemp, Error, TEXT("Failed to spawn dynamic light actor"));
+    }
+}
+
+
+void ADiggerManager::PostInitProperties()
+{
+    Super::PostInitProperties();
+    if (!HasAnyFlags(RF_ClassDefaultObject))
+    {
+        InitializeBrushShapes();
+
+#if WITH_EDITOR
+        // Landscape sculpting needs to invalidate the cached heightfield under the edited components
+        LandscapeModifiedHandle = FCoreUObjectDelegates::OnObjectModified.AddUObject(this, &ADiggerManager::OnLandscapeObjectModified);
+#endif
+    }
+}
+
+void ADiggerManager::BeginDestroy()
+{
+    UnregisterLandscapeProxyIndexHandlers();
+    MeshQueue.Reset();
+    CancelAsyncChunkLoad();
+    if (StreamingChunkLoad.IsValid())
+    {
+        StreamingChunkLoad->Cancel();
+        StreamingChunkLoad.Reset();
+    }
+
+#if WITH_EDITOR
+    if (LandscapeModifiedHandle.IsValid())
+    {
+        FCoreUObjectDelegates::OnObjectModified.Remove(LandscapeModifiedHandle);
+        LandscapeModifiedHandle.Reset();
+    }
+#endif
+
+    Super::BeginDestroy();
+}
+
+
+// In ADiggerManager.cpp
+void ADiggerManager::InitializeBrushShapes()
+{
+    // Clear existing brushes
+    BrushShapeMap.Empty();
+
+    // Initialize all available brush shapes
+    BrushShapeMap.Add(EVoxelBrushType::Sphere, NewObject<USphereBrushShape>(this));
+    BrushShapeMap.Add(EVoxelBrushType::Cube, NewObject<UCubeBrushShape>(this));
+    BrushShapeMap.Add(EVoxelBrushType::Cone, NewObject<UConeBrushShape>(this));
+    BrushShapeMap.Add(EVoxelBrushType::Cylinder, NewObject<UCylinderBrushShape>(this));
+    BrushShapeMap.Add(EVoxelBrushType::Capsule, NewObject<UCapsuleBrushShape>(this));
+    BrushShapeMap.Add(EVoxelBrushType::Torus, NewObject<UTorusBrushShape>(this));
+    BrushShapeMap.Add(EVoxelBrushType::Pyramid, NewObject<UPyramidBrushShape>(this));
+    BrushShapeMap.Add(EVoxelBrushType::Icosphere, NewObject<UIcosphereBrushShape>(this));
+    BrushShapeMap.Add(EVoxelBrushType::Smooth, NewObject<USmoothBrushShape>(this));
+    
+    // Log initialization for debugging
+    /*UE_LOG(LogTemp, Warning, TEXT("Initializing brush shapes..."));
+    for (const auto& Pair : BrushShapeMap)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Initialized %s for brush type %d"), 
+            *Pair.Value->GetClass()->GetName(), 
+            (int32)Pair.Key);
+    }*/
+
+    // If there's an ActiveBrush member, we should probably handle it differently
+    // Can you show me the ActiveBrush related code so we can fix that?
+}
+
+UVoxelBrushShape* ADiggerManager::GetActiveBrushShape(EVoxelBrushType BrushType) const
+{
+    if (UVoxelBrushShape* const* Found = BrushShapeMap.Find(BrushType))
+    {
+        return *Found;
+    }
+    return nullptr;
+}
+
+
+/*void ADiggerManager::ApplyBrushAtCameraHit()
+{
+    // Get the active brush shape
+    const UVoxelBrushShape* ActiveBrushShape = GetActiveBrushShape(ActiveBrush->GetBrushType());
+    if (!ActiveBrushShape)
+    {
+        UE_LOG(LogTemp, Error, TEXT("ActiveBrushShape is null"));
+        return;
+    }
+
+    // Get hit location
+    FHitResult HitResult;
+    if (!ActiveBrushShape->GetCameraHitLocation(HitResult))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("No valid hit found"));
+        return;
+    }
+
+    // Create brush stroke with correct data
+    FBrushStroke BrushStroke;
+    BrushStroke.BrushPosition = HitResult.Location;
+    BrushStroke.BrushRadius = ActiveBrush->GetBrushSize();
+    BrushStroke.BrushFalloff = 0.f;
+    BrushStroke.BrushStrength = 1.f;
+    BrushStroke.bDig = ActiveBrush->GetDig();
+    BrushStroke.BrushType = ActiveBrush->GetBrushType();
 
     //Log the brushstrok details
     UE_LOG(LogTemp, Warning, TEXT("PIE: === BRUSH STROKE DEBUG ==="));
@@ -903,591 +1842,1600 @@ UVoxelBrushShape* ADiggerManager::GetActiveBrushShape(EVoxelBrushType BrushType)
     UE_LOG(LogTemp, Warning, TEXT("PIE: Strength: %f"), BrushStroke.BrushStrength);
     UE_LOG(LogTemp, Warning, TEXT("PIE: bDig: %s"), BrushStroke.bDig ? TEXT("true") : TEXT("false"));
 
-    UE_LOG(LogTemp, Warning, TEXT("Applying brush at location: %s, radius: %f"), 
-           *BrushStroke.BrushPosition.ToString(), BrushStroke.BrushRadius);
+    UE_LOG(LogTemp, Warning, TEXT("Applying brush at location: %s, radius: %f"), 
+           *BrushStroke.BrushPosition.ToString(), BrushStroke.BrushRadius);
+
+    // Apply the brush
+    ApplyBrushToAllChunks(BrushStroke);
+}*/
+
+void ADiggerManager::ApplyBrushToAllChunksPIE(FBrushStroke& BrushStroke)
+{
+    // Get the hit location from camera first
+    FHitResult HitResult;
+    if (!ActiveBrush->GetCameraHitLocation(HitResult))
+    {
+        if (DiggerDebug::Brush)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("No valid hit found"));
+        }
+        return;
+    }
+
+    // Create brush stroke with the hit location and brush settings
+    BrushStroke = ActiveBrush->CreateBrushStroke(HitResult, ActiveBrush->GetDig());
+
+    if (DiggerDebug::UserConv)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("PIE Brush applied at: %s"), *BrushStroke.BrushPosition.ToString());
+    }
+    
+    // Apply the brush
+    ApplyBrushToAllChunks(BrushStroke);
+}
+
+void ADiggerManager::ApplyBrushToAllChunks(FBrushStroke& BrushStroke, bool ForceUpdate)
+{
+    ApplyBrushToAllChunks(BrushStroke);
+}
+
+void ADiggerManager::ApplyBrushToAllChunks(FBrushStroke& BrushStroke)
+{
+    const UVoxelBrushShape* ActiveBrushShape = GetActiveBrushShape(BrushStroke.BrushType);
+    if (!ActiveBrushShape)
+    {
+        if (DiggerDebug::Brush)
+        {
+            UE_LOG(LogTemp, Error, TEXT("ActiveBrushShape is null for brush type %d"), (int32)BrushStroke.BrushType);
+        }
+        return;
+    }
+
+    // Multiplayer: the stroke goes out with the next batch and the multicast applies it here too
+    if (ShouldReplicateStrokes())
+    {
+        QueueNetBrushStroke(BrushStroke);
+        return;
+    }
+    if (ShouldRelayStrokes())
+    {
+        // Apply exactly what the lobby will get
+        BrushStroke = FBrushStrokeCodec::Quantized(BrushStroke);
+        QueueNetBrushStroke(BrushStroke);
+    }
+
+    // A stroke outside any open group (PIE, blueprint calls) is its own undo step
+    BeginUndoGroup();
+
+    /*UE_LOG(LogTemp, Warning, TEXT("ApplyBrushToAllChunks: === BRUSH STROKE DEBUG ==="));
+    UE_LOG(LogTemp, Warning, TEXT("ApplyBrushToAllChunks: Position: %s"), *BrushStroke.BrushPosition.ToString());
+    UE_LOG(LogTemp, Warning, TEXT("ApplyBrushToAllChunks: Radius: %f"), BrushStroke.BrushRadius);
+    UE_LOG(LogTemp, Warning, TEXT("ApplyBrushToAllChunks: Falloff: %f"), BrushStroke.BrushFalloff);
+    UE_LOG(LogTemp, Warning, TEXT("ApplyBrushToAllChunks: Strength: %f"), BrushStroke.BrushStrength);
+    UE_LOG(LogTemp, Warning, TEXT("ApplyBrushToAllChunks: bDig: %s"), BrushStroke.bDig ? TEXT("true") : TEXT("false"));*/
+    
+    // Once per stroke, chunks the stroke finds already loaded skip GetOrCreateChunkAtChunk and its re-init
+    FVoxelConversion::InitFromConfig(ChunkSize, Subdivisions, TerrainGridSize, GetActorLocation());
+
+    // Handle hole spawn ONCE per brush stroke, before processing chunks
+    if (BrushStroke.bDig)
+    {
+        if(BrushStroke.BrushPosition.Z - BrushStroke.BrushRadius + BrushStroke.BrushFalloff <= GetLandscapeHeightAt(BrushStroke.BrushPosition))
+        {
+            HandleHoleSpawn(BrushStroke);
+        }
+    }
+
+    TArray<FIntVector> BrushChunks;
+    GetBrushChunks(BrushStroke, BrushChunks);
+
+    for (const FIntVector& ChunkCoords : BrushChunks)
+    {
+        if (DiggerDebug::Chunks)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("Trying to get/create chunk at: %s"), *ChunkCoords.ToString());
+        }
+
+        bool bFreshChunk = false;
+        if (UVoxelChunk* Chunk = GetOrCreateBrushChunk(ChunkCoords, MakeArrayView(&BrushStroke, 1), bFreshChunk))
+        {
+            Chunk->ApplyBrushStroke(BrushStroke);
+            ReleaseUntouchedBrushChunk(Chunk, bFreshChunk);
+        }
+    }
+
+    EndUndoGroup();
+}
+
+void ADiggerManager::GetBrushChunkRange(const FBrushStroke& BrushStroke, FIntVector& OutMinChunk, FIntVector& OutMaxChunk)
+{
+    // A chunk owns voxels -1..N, one voxel past its own cube on every side
+    const FBox BrushBox = FBrushBounds::FromStroke(BrushStroke).GetWorldBox();
+    const FVector Overflow(FVoxelConversion::LocalVoxelSize);
+
+    OutMinChunk = FVoxelConversion::WorldToChunk(BrushBox.Min - Overflow);
+    OutMaxChunk = FVoxelConversion::WorldToChunk(BrushBox.Max + Overflow);
+}
+
+void ADiggerManager::GetBrushChunks(const FBrushStroke& BrushStroke, TArray<FIntVector>& OutChunks)
+{
+    const FBrushBounds Bounds = FBrushBounds::FromStroke(BrushStroke);
+    const FVector ChunkExtent(FVoxelConversion::ChunkWorldSize * 0.5f + FVoxelConversion::LocalVoxelSize);
+
+    // The range is the rotated shape's AABB, the shape itself often misses its corners (tilted cylinders, capsules)
+    FIntVector MinChunk, MaxChunk;
+    GetBrushChunkRange(BrushStroke, MinChunk, MaxChunk);
+    for (int32 X = MinChunk.X; X <= MaxChunk.X; ++X)
+    for (int32 Y = MinChunk.Y; Y <= MaxChunk.Y; ++Y)
+    for (int32 Z = MinChunk.Z; Z <= MaxChunk.Z; ++Z)
+    {
+        const FIntVector ChunkCoords(X, Y, Z);
+        if (Bounds.Intersects(FBox::BuildAABB(FVoxelConversion::ChunkToWorld(ChunkCoords), ChunkExtent)))
+        {
+            OutChunks.Add(ChunkCoords);
+        }
+    }
+}
+
+UVoxelChunk* ADiggerManager::GetOrCreateBrushChunk(const FIntVector& ChunkCoords, TArrayView<const FBrushStroke> Strokes, bool& bOutFresh)
+{
+    bOutFresh = false;
+    if (UVoxelChunk* Chunk = ChunkMap.FindRef(ChunkCoords))
+    {
+        return Chunk;
+    }
+
+    // Chunks coming back from streaming have saved data and stay whatever the stroke does
+    bOutFresh = !StreamedOutChunks.Contains(ChunkCoords) && !StreamingInFlight.Contains(ChunkCoords);
+
+    // A new chunk is only worth creating if the stroke writes to it, the shape often just grazes the chunk box
+    if (bOutFresh && !UVoxelChunk::WouldBrushStrokesWrite(ChunkCoords, Strokes, this))
+    {
+        if (DiggerDebug::Chunks)
+        {
+            UE_LOG(LogTemp, Log, TEXT("Brush wouldn't write to chunk %s, not creating it"), *ChunkCoords.ToString());
+        }
+        return nullptr;
+    }
+
+    UVoxelChunk* Chunk = GetOrCreateChunkAtChunk(ChunkCoords);
+    if (!Chunk && DiggerDebug::Chunks)
+    {
+        UE_LOG(LogTemp, Error, TEXT("Failed to get/create chunk at: %s"), *ChunkCoords.ToString());
+    }
+    return Chunk;
+}
+
+void ADiggerManager::ReleaseUntouchedBrushChunk(UVoxelChunk* Chunk, bool bFresh)
+{
+    // Created for this stroke but nothing ended up stored in it (the write batch collapsed back to nothing, or the
+    // dry run couldn't judge the shape), so it goes again instead of sitting empty in the map
+    if (bFresh && !Chunk->IsDirty() && Chunk->GetSparseVoxelGrid() && Chunk->GetSparseVoxelGrid()->VoxelData.IsEmpty())
+    {
+        if (DiggerDebug::Chunks)
+        {
+            UE_LOG(LogTemp, Log, TEXT("Brush left new chunk %s untouched, releasing it"), *Chunk->GetChunkCoordinates().ToString());
+        }
+        ReleaseChunk(Chunk);
+    }
+}
+
+void ADiggerManager::ApplyBrushStrokesToAllChunks(TArray<FBrushStroke>& Strokes)
+{
+    // Networked strokes go through the batch queue stroke by stroke
+    if (Strokes.Num() == 1 || !GetWorld() || ShouldReplicateStrokes())
+    {
+        for (FBrushStroke& Stroke : Strokes)
+        {
+            ApplyBrushToAllChunks(Stroke);
+        }
+        return;
+    }
+
+    if (ShouldRelayStrokes())
+    {
+        for (FBrushStroke& Stroke : Strokes)
+        {
+            Stroke = FBrushStrokeCodec::Quantized(Stroke);
+            QueueNetBrushStroke(Stroke);
+        }
+    }
+
+    FVoxelConversion::InitFromConfig(ChunkSize, Subdivisions, TerrainGridSize, GetActorLocation());
+
+    BeginUndoGroup();
+
+    // Every chunk any stamp reaches, each visited once with all the stamps
+    TSet<FIntVector> TouchedChunks;
+    TArray<FIntVector> StrokeChunks;
+    for (const FBrushStroke& Stroke : Strokes)
+    {
+        if (!GetActiveBrushShape(Stroke.BrushType))
+        {
+            continue;
+        }
+
+        // Handle hole spawn once per stamp, before processing chunks
+        if (Stroke.bDig && Stroke.BrushPosition.Z - Stroke.BrushRadius + Stroke.BrushFalloff <= GetLandscapeHeightAt(Stroke.BrushPosition))
+        {
+            HandleHoleSpawn(Stroke);
+        }
+
+        StrokeChunks.Reset();
+        GetBrushChunks(Stroke, StrokeChunks);
+        TouchedChunks.Append(StrokeChunks);
+    }
+
+    for (const FIntVector& ChunkCoords : TouchedChunks)
+    {
+        bool bFreshChunk = false;
+        if (UVoxelChunk* Chunk = GetOrCreateBrushChunk(ChunkCoords, Strokes, bFreshChunk))
+        {
+            Chunk->ApplyBrushStrokes(Strokes);
+            ReleaseUntouchedBrushChunk(Chunk, bFreshChunk);
+        }
+    }
+
+    EndUndoGroup();
+
+    if (DiggerDebug::Brush)
+    {
+        UE_LOG(LogTemp, Log, TEXT("Coalesced %d brush stamps into one pass over %d chunks"), Strokes.Num(), TouchedChunks.Num());
+    }
+}
+
+bool ADiggerManager::ShouldReplicateStrokes() const
+{
+    return !bApplyingNetStrokes && GetWorld() && GetWorld()->GetNetMode() != NM_Standalone;
+}
+
+bool ADiggerManager::ShouldRelayStrokes() const
+{
+    return !bApplyingNetStrokes && StrokeRelay && StrokeRelay->IsConnected();
+}
+
+bool ADiggerManager::IsSharingStrokes() const
+{
+    return (GetWorld() && GetWorld()->GetNetMode() != NM_Standalone) || (StrokeRelay && StrokeRelay->IsConnected());
+}
+
+void ADiggerManager::QueueNetBrushStroke(const FBrushStroke& Stroke)
+{
+    PendingNetStrokes.Add(Stroke);
+
+    UWorld* World = GetWorld();
+    if (!World || PendingNetStrokes.Num() >= FBrushStrokeCodec::MaxStrokesPerBatch)
+    {
+        FlushNetBrushStrokes();
+        return;
+    }
+
+    // The first stroke of a batch opens the window, the rest ride along
+    FTimerManager& TimerManager = World->GetTimerManager();
+    if (!TimerManager.IsTimerActive(NetStrokeFlushHandle) && !TimerManager.IsTimerPending(NetStrokeFlushHandle))
+    {
+        if (StrokeBatchWindow > 0.f)
+        {
+            TimerManager.SetTimer(NetStrokeFlushHandle, this, &ADiggerManager::FlushNetBrushStrokes, StrokeBatchWindow, false);
+        }
+        else
+        {
+            NetStrokeFlushHandle = TimerManager.SetTimerForNextTick(this, &ADiggerManager::FlushNetBrushStrokes);
+        }
+    }
+}
+
+void ADiggerManager::FlushNetBrushStrokes()
+{
+    UWorld* World = GetWorld();
+    if (World)
+    {
+        World->GetTimerManager().ClearTimer(NetStrokeFlushHandle);
+    }
+    if (PendingNetStrokes.Num() == 0)
+    {
+        return;
+    }
+
+    TArray<uint8> Payload;
+    FBrushStrokeCodec::Encode(PendingNetStrokes, Payload);
+
+    if (DiggerDebug::Brush)
+    {
+        UE_LOG(LogTemp, Log, TEXT("Sending %d brush strokes in %d bytes"), PendingNetStrokes.Num(), Payload.Num());
+    }
+    PendingNetStrokes.Reset();
+
+    if (StrokeRelay && StrokeRelay->IsConnected())
+    {
+        StrokeRelay->SendBrushStrokes(StrokeRelayLobby, Payload);
+    }
+    if (!World || World->GetNetMode() == NM_Standalone)
+    {
+        return;
+    }
+
+    // Only the server can multicast, clients hand the batch to it through their controller
+    if (HasAuthority())
+    {
+        MulticastApplyBrushStrokeBatch(Payload);
+    }
+    else if (UDiggerStrokeNetComponent* StrokeNet = UDiggerStrokeNetComponent::FindLocal(World))
+    {
+        StrokeNet->ServerSendBrushStrokeBatch(Payload);
+    }
+    else if (DiggerDebug::Error)
+    {
+        UE_LOG(LogTemp, Error, TEXT("No UDiggerStrokeNetComponent on the local player controller, %d byte stroke batch dropped"), Payload.Num());
+    }
+}
+
+void ADiggerManager::AddStrokeNetComponent(AGameModeBase* GameMode, APlayerController* Controller)
+{
+    if (!Controller || Controller->GetWorld() != GetWorld() || Controller->FindComponentByClass<UDiggerStrokeNetComponent>())
+    {
+        return;
+    }
+
+    // Created on the server, replicates to the owning client with the controller
+    UDiggerStrokeNetComponent* StrokeNet = NewObject<UDiggerStrokeNetComponent>(Controller, TEXT("DiggerStrokeNet"));
+    StrokeNet->RegisterComponent();
+    Controller->AddInstanceComponent(StrokeNet);
+
+    if (DiggerDebug::Brush)
+    {
+        UE_LOG(LogTemp, Log, TEXT("Added stroke net component to %s"), *Controller->GetName());
+    }
+}
+
+void ADiggerManager::MulticastApplyBrushStrokeBatch_Implementation(const TArray<uint8>& Payload)
+{
+    ApplyEncodedBrushStrokes(Payload);
+}
+
+bool ADiggerManager::ApplyEncodedBrushStrokes(const TArray<uint8>& Payload)
+{
+    TArray<FBrushStroke> Strokes;
+    if (!FBrushStrokeCodec::Decode(Payload, Strokes))
+    {
+        if (DiggerDebug::Error)
+        {
+            UE_LOG(LogTemp, Error, TEXT("Dropped a brush stroke batch that doesn't decode (%d bytes)"), Payload.Num());
+        }
+        return false;
+    }
+
+    TGuardValue<bool> ApplyingGuard(bApplyingNetStrokes, true);
+
+    // Coalesce runs of strokes that agree on dig / fill, in order
+    int32 RunStart = 0;
+    for (int32 Index = 1; Index <= Strokes.Num(); ++Index)
+    {
+        if (Index == Strokes.Num() || Strokes[Index].bDig != Strokes[RunStart].bDig)
+        {
+            TArray<FBrushStroke> Run(Strokes.GetData() + RunStart, Index - RunStart);
+            ApplyBrushStrokesToAllChunks(Run);
+            RunStart = Index;
+        }
+    }
+    return true;
+}
+
+void ADiggerManager::SetStrokeRelay(USocketIOLobbyManager* LobbyManager, const FString& LobbyName)
+{
+    if (StrokeRelay)
+    {
+        StrokeRelay->OnBrushStrokesReceived.Remove(StrokeRelayHandle);
+        StrokeRelayHandle.Reset();
+    }
+
+    StrokeRelay = LobbyManager;
+    StrokeRelayLobby = LobbyName;
+
+    if (StrokeRelay)
+    {
+        StrokeRelayHandle = StrokeRelay->OnBrushStrokesReceived.AddWeakLambda(this, [this](const TArray<uint8>& Payload)
+        {
+            ApplyEncodedBrushStrokes(Payload);
+        });
+    }
+}
+
+void ADiggerManager::BeginUndoGroup()
+{
+    if (UndoGroupDepth++ == 0)
+    {
+        // Undo isn't replicated, other worlds would keep the edit
+        bUndoGroupRecords = UndoMemoryBudgetMB > 0.f && !IsSharingStrokes();
+    }
+}
+
+void ADiggerManager::EndUndoGroup()
+{
+    if (UndoGroupDepth <= 0)
+    {
+        return;
+    }
+    if (--UndoGroupDepth > 0)
+    {
+        return;
+    }
+
+    // Only the grids that captured something while the group was open, see RegisterUndoGrid
+    TArray<TWeakObjectPtr<USparseVoxelGrid>> Grids;
+    {
+        FScopeLock Lock(&UndoGroupGridsMutex);
+        Grids = MoveTemp(UndoGroupGrids);
+        UndoGroupGrids.Reset();
+    }
+
+    FVoxelUndoEntry Entry;
+    for (const TWeakObjectPtr<USparseVoxelGrid>& GridPtr : Grids)
+    {
+        USparseVoxelGrid* Grid = GridPtr.Get();
+        if (!Grid)
+        {
+            continue;
+        }
+
+        FVoxelChunkDelta Delta;
+        Delta.ChunkCoords = Grid->GetParentChunkCoordinates();
+        if (Grid->TakeUndoCapture(Delta))
+        {
+            Entry.Chunks.Add(MoveTemp(Delta));
+        }
+    }
+
+    if (Entry.Chunks.Num() == 0)
+    {
+        return;
+    }
+
+    const int32 NumVoxels = Entry.NumVoxels();
+    UndoJournal.Push(MoveTemp(Entry), (SIZE_T)(UndoMemoryBudgetMB * 1024.f * 1024.f));
+
+    if (DiggerDebug::Brush)
+    {
+        UE_LOG(LogTemp, Log, TEXT("Undo step recorded: %d voxels, %d steps, %.2f MB"),
+            NumVoxels, UndoJournal.NumUndo(), UndoJournal.GetMemoryUsage() / (1024.0 * 1024.0));
+    }
+}
+
+void ADiggerManager::RegisterUndoGrid(USparseVoxelGrid* Grid)
+{
+    FScopeLock Lock(&UndoGroupGridsMutex);
+    UndoGroupGrids.Add(Grid);
+}
+
+bool ADiggerManager::UndoVoxelEdit()
+{
+    // Half a stroke has been captured, undoing under it would tangle the two. Shared worlds never see an undo.
+    if (UndoGroupDepth > 0 || IsSharingStrokes())
+    {
+        return false;
+    }
+
+    FVoxelUndoEntry Entry;
+    if (!UndoJournal.PopUndo(Entry))
+    {
+        return false;
+    }
+
+    ApplyUndoEntry(Entry, true);
+    UndoJournal.PushRedo(MoveTemp(Entry));
+    return true;
+}
+
+bool ADiggerManager::RedoVoxelEdit()
+{
+    if (UndoGroupDepth > 0 || IsSharingStrokes())
+    {
+        return false;
+    }
+
+    FVoxelUndoEntry Entry;
+    if (!UndoJournal.PopRedo(Entry))
+    {
+        return false;
+    }
+
+    ApplyUndoEntry(Entry, false);
+    UndoJournal.PushUndo(MoveTemp(Entry));
+    return true;
+}
+
+void ADiggerManager::ClearUndoHistory()
+{
+    UndoJournal.Reset();
+}
+
+void ADiggerManager::ApplyUndoEntry(const FVoxelUndoEntry& Entry, bool bRestoreBefore)
+{
+    // Chunk lookup / creation touches UObjects, so it stays on the game thread. The voxel writes don't.
+    TArray<UVoxelChunk*> Chunks;
+    TArray<USparseVoxelGrid*> Grids;
+    Chunks.SetNum(Entry.Chunks.Num());
+    Grids.SetNum(Entry.Chunks.Num());
+    for (int32 Index = 0; Index < Entry.Chunks.Num(); ++Index)
+    {
+        Chunks[Index] = GetOrCreateChunkAtChunk(Entry.Chunks[Index].ChunkCoords);
+        Grids[Index] = Chunks[Index] ? Chunks[Index]->GetSparseVoxelGrid() : nullptr;
+    }
+
+    ParallelFor(Entry.Chunks.Num(), [&Entry, &Grids, bRestoreBefore](int32 Index)
+    {
+        if (Grids[Index])
+        {
+            Grids[Index]->RestoreVoxels(Entry.Chunks[Index], bRestoreBefore);
+        }
+    });
+
+    // Remeshes go through the normal queue, only the chunks this step touched
+    for (int32 Index = 0; Index < Chunks.Num(); ++Index)
+    {
+        if (Grids[Index])
+        {
+            Chunks[Index]->MarkDirty();
+        }
+    }
+
+    if (DiggerDebug::Brush)
+    {
+        UE_LOG(LogTemp, Log, TEXT("%s %d voxels across %d chunks"), bRestoreBefore ? TEXT("Undo:") : TEXT("Redo:"),
+            Entry.NumVoxels(), Entry.Chunks.Num());
+    }
+}
+
+void ADiggerManager::SetVoxelAtWorldPosition(const FVector& WorldPos, float Value)
+{
+    // Safety checks
+    if (TerrainGridSize <= 0.0f || Subdivisions <= 0)
+    {
+        if (DiggerDebug::Space || DiggerDebug::Chunks)
+        {
+            UE_LOG(LogTemp, Error, TEXT("SetVoxelAtWorldPosition: Invalid TerrainGridSize or Subdivisions!"));
+        }
+        return;
+    }
+
+    // Calculate chunk and voxel index
+    FIntVector ChunkCoords = FVoxelConversion::WorldToChunk(WorldPos);
+    FIntVector LocalVoxelIndex = FVoxelConversion::WorldToMinCornerVoxel(WorldPos);
+
+    // Try to get or create the chunk
+    if (UVoxelChunk* Chunk = GetOrCreateChunkAtChunk(ChunkCoords))
+    {
+        //Chunk->GetSparseVoxelGrid()->SetVoxel(LocalVoxelIndex, Value, true);
+
+        if (DiggerDebug::Space || DiggerDebug::Chunks)
+        {
+            UE_LOG(LogTemp, Display, TEXT("[SetVoxelAtWorldPosition] WorldPos: %s → Chunk: %s, Voxel: %s, Value: %.2f"),
+                   *WorldPos.ToString(), *ChunkCoords.ToString(), *LocalVoxelIndex.ToString(), Value);
+        }
+    }
+    else
+    {
+        if (DiggerDebug::Space || DiggerDebug::Chunks)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("SetVoxelAtWorldPosition: Failed to get or create chunk at %s"), *ChunkCoords.ToString());
+        }
+    }
+}
+
+
+// Updated ADiggerManager::DebugBrushPlacement()
+void ADiggerManager::DebugBrushPlacement(const FVector& ClickPosition)
+{
+    if (!IsInGameThread())
+    {
+        if (DiggerDebug::Brush || DiggerDebug::Threads)
+        {
+            UE_LOG(LogTemp, Error, TEXT("DebugBrushPlacement: Not called from game thread!"));
+        }
+        return;
+    }
+
+    UWorld* CurrentWorld = GetSafeWorld();
+    if (!CurrentWorld)
+    {
+        if (DiggerDebug::Context)
+        {
+            UE_LOG(LogTemp, Error, TEXT("DebugBrushPlacement: GetSafeWorld() returned null!"));
+        }
+        return;
+    }
+
+    // Ensure parameters are valid
+    if (TerrainGridSize <= 0.0f || Subdivisions <= 0)
+    {
+        if (DiggerDebug::Brush || DiggerDebug::Space)
+        {
+            UE_LOG(LogTemp, Error, TEXT("DebugBrushPlacement: Invalid TerrainGridSize or Subdivisions!"));
+        }
+        return;
+    }
+
+    VoxelSize = TerrainGridSize / Subdivisions;
+    float ChunkWorldSize = ChunkSize * TerrainGridSize;
+
+    if (DiggerDebug::Space)
+    {
+        UE_LOG(LogTemp, Display, TEXT("ChunkSize=%d, Subdivisions=%d, VoxelSize=%.2f, ChunkWorldSize=%.2f"),
+               ChunkSize, Subdivisions, VoxelSize, ChunkWorldSize);
+    }
+
+    // Compute chunk coordinates from world position
+    FIntVector ChunkCoords = FVoxelConversion::WorldToChunk(ClickPosition);
+
+    if (DiggerDebug::Chunks || DiggerDebug::Space || DiggerDebug::Brush)
+    {
+        UE_LOG(LogTemp, Display, TEXT("ClickPos: %s → ChunkCoords: %s"),
+               *ClickPosition.ToString(), *ChunkCoords.ToString());
+    }
+
+    // Fetch or create the relevant chunk
+    if (UVoxelChunk* Chunk = GetOrCreateChunkAtChunk(ChunkCoords))
+    {
+        Chunk->GetSparseVoxelGrid()->RenderVoxels();
+        Chunk->GetSparseVoxelGrid()->LogVoxelData();
+    }
+    else
+    {
+        if (DiggerDebug::Chunks || DiggerDebug::Space)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("Failed to get or create chunk at %s"), *ChunkCoords.ToString());
+        }
+        return;
+    }
+
+    // Compute chunk origin and extent
+    FVector ChunkCenter = FVector(ChunkCoords) * ChunkWorldSize;
+    FVector ChunkExtent = FVector(ChunkWorldSize * 0.5f);
+    FVector ChunkOrigin = ChunkCenter - ChunkExtent;
+
+    FVector LocalInChunk = ClickPosition - ChunkOrigin;
+    FIntVector LocalVoxel = FVoxelConversion::WorldToLocalVoxel(ClickPosition);
+    FVector LocalVoxelToWorld = FVoxelConversion::LocalVoxelToWorld(LocalVoxel);
+
+    if (DiggerDebug::Space || DiggerDebug::Voxels || DiggerDebug::Chunks)
+    {
+        UE_LOG(LogTemp, Error, TEXT("LocalInChunk: %s, LocalVoxel: %s, WorldPosition: %s"),
+               *LocalInChunk.ToString(), *LocalVoxel.ToString(), *LocalVoxelToWorld.ToString());
+    }
+
+    // World-space center of the voxel
+    FVector VoxelCenter = ChunkOrigin + FVector(LocalVoxel) * VoxelSize + FVector(VoxelSize * 0.5f);
+
+    if (DiggerDebug::Voxels)
+    {
+        UE_LOG(LogTemp, Display, TEXT("VoxelCenter: %s"), *VoxelCenter.ToString());
+    }
+    
+    try
+    {
+        // Get the fast debug subsystem
+        if (auto* FastDebug = UFastDebugSubsystem::Get(this))
+        {
+            // Draw the chunk bounding box (red)
+            FastDebug->DrawBox(ChunkCenter, ChunkExtent, FRotator::ZeroRotator, 
+                              FFastDebugConfig(FLinearColor::Red, 30.0f, 2.0f));
+
+            // Draw chunk center (yellow sphere)
+            FastDebug->DrawSphere(ChunkCenter, 30.0f, 
+                                 FFastDebugConfig(FLinearColor::Yellow, 30.0f, 2.0f));
+
+            // Draw chunk origin (orange sphere)
+            FastDebug->DrawSphere(ChunkOrigin, 20.0f, 
+                                 FFastDebugConfig(FLinearColor(1.0f, 0.5f, 0.0f), 30.0f, 2.0f));
+
+            const int32 ChunkVoxels = ChunkSize * Subdivisions;
+            FVector SelectedVoxelCenter = FVector::ZeroVector;
+
+            // Collect edge voxel positions for batch rendering
+            TArray<FVector> EdgeVoxelPositions;
+            EdgeVoxelPositions.Reserve(ChunkVoxels * ChunkVoxels * 6); // Rough estimate
+
+            for (int32 X = 0; X < ChunkVoxels; X++)
+            {
+                for (int32 Y = 0; Y < ChunkVoxels; Y++)
+                {
+                    for (int32 Z = 0; Z < ChunkVoxels; Z++)
+                    {
+                        FIntVector VoxelCoord(X, Y, Z);
+                        FVector CurrentVoxelCenter = ChunkOrigin + FVector(VoxelCoord) * VoxelSize + FVector(VoxelSize * 0.5f);
+
+                        // Collect edge voxels
+                        if (X == 0 || X == ChunkVoxels - 1 ||
+                            Y == 0 || Y == ChunkVoxels - 1 ||
+                            Z == 0 || Z == ChunkVoxels - 1)
+                        {
+                            EdgeVoxelPositions.Add(CurrentVoxelCenter);
+                        }
+
+                        // Track the selected voxel
+                        if (VoxelCoord == LocalVoxel)
+                        {
+                            SelectedVoxelCenter = CurrentVoxelCenter;
+                        }
+                    }
+                }
+            }
+
+            // Batch draw edge voxels as points (cyan)
+            if (EdgeVoxelPositions.Num() > 0)
+            {
+                FastDebug->DrawPoints(EdgeVoxelPositions, 5.0f, 
+                                     FFastDebugConfig(FColor::Cyan, 30.0f, 2.0f));
+            }
+
+            // Draw the selected voxel (magenta box)
+            if (SelectedVoxelCenter != FVector::ZeroVector)
+            {
+                FastDebug->DrawBox(SelectedVoxelCenter, FVector(VoxelSize * 0.5f), FRotator::ZeroRotator,
+                                  FFastDebugConfig(FLinearColor(1.0f, 0.0f, 1.0f), 30.0f, 2.0f));
+            }
+
+            // Draw interaction line
+            FastDebug->DrawLine(ClickPosition, SelectedVoxelCenter, 
+                               FFastDebugConfig(FLinearColor::Green, 30.0f, 3.0f));
+
+            // Draw interaction points
+            FastDebug->DrawSphere(ClickPosition, 20.0f, 
+                                 FFastDebugConfig(FLinearColor::Blue, 30.0f, 2.0f));
+            FastDebug->DrawSphere(SelectedVoxelCenter, 20.0f, 
+                                 FFastDebugConfig(FLinearColor(1.0f, 0.0f, 1.0f), 30.0f, 2.0f));
+        }
+
+        if (DiggerDebug::Brush)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("DebugBrushPlacement: Debug visuals drawn successfully"));
+        }
+    }
+    catch (...)
+    {
+        UE_LOG(LogTemp, Error, TEXT("DebugBrushPlacement: Exception drawing debug visuals"));
+    }
+
+    // Diagonal marker boxes
+    DrawDiagonalDebugVoxelsFast(ChunkCoords);
+    // Individual voxels right nearest the click position
+    DebugDrawVoxelAtWorldPositionFast(ClickPosition, FLinearColor::White, 25.0f, 2.0f);
+
+    if (DiggerDebug::Brush)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("DebugBrushPlacement: completed"));
+    }
+}
+// Updated ADiggerManager::DebugDrawVoxelAtWorldPosition()
+void ADiggerManager::DebugDrawVoxelAtWorldPositionFast(const FVector& WorldPosition, const FLinearColor& BoxColor, float Duration, float Thickness)
+{
+    FIntVector ChunkCoords;
+    FIntVector VoxelIndex;
+    FVoxelConversion::WorldToChunkAndVoxel(WorldPosition, ChunkCoords, VoxelIndex);
+
+    if (!FVoxelConversion::IsValidVoxelIndex(VoxelIndex))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Invalid voxel index at world position %s: Chunk %s, VoxelIndex %s"),
+            *WorldPosition.ToString(), *ChunkCoords.ToString(), *VoxelIndex.ToString());
+        return;
+    }
+
+    // Get the voxel center in world space
+    FVector VoxelCenter = FVoxelConversion::MinCornerVoxelToWorld(ChunkCoords, VoxelIndex);
+
+    // Draw using fast debug system
+    if (auto* FastDebug = UFastDebugSubsystem::Get(this))
+    {
+        FastDebug->DrawBox(VoxelCenter, FVector(FVoxelConversion::LocalVoxelSize * 0.5f), FRotator::ZeroRotator,
+                          FFastDebugConfig(BoxColor, Duration, Thickness));
+    }
+
+    if (DiggerDebug::Chunks || DiggerDebug::Voxels)
+    {
+        UE_LOG(LogTemp, Log, TEXT("Drew voxel at world position %s: Chunk %s, VoxelIndex %s, Center %s"),
+            *WorldPosition.ToString(), *ChunkCoords.ToString(), *VoxelIndex.ToString(), *VoxelCenter.ToString());
+    }
+}
 
-    // Apply the brush
-    ApplyBrushToAllChunks(BrushStroke);
-}*/
+// Updated ADiggerManager::DrawDiagonalDebugVoxels()
+void ADiggerManager::DrawDiagonalDebugVoxelsFast(FIntVector ChunkCoords)
+{
+    // Get the fast debug subsystem
+    auto* FastDebug = UFastDebugSubsystem::Get(this);
+    if (!FastDebug) return;
 
-void ADiggerManager::ApplyBrushToAllChunksPIE(FBrushStroke& BrushStroke)
+    // Calculate chunk dimensions
+    const int32 VoxelsPerChunk = FVoxelConversion::ChunkSize * FVoxelConversion::Subdivisions;
+    const float DebugDuration = 30.0f;
+    
+    // Get the chunk center using the conversion method
+    FVector ChunkCenter = FVoxelConversion::ChunkToWorld(ChunkCoords);
+    FVector ChunkExtent = FVector(FVoxelConversion::ChunkSize * FVoxelConversion::TerrainGridSize / 2.0f);
+    
+    // Calculate the minimum corner based on the center and extent
+    FVector ChunkMinCorner = ChunkCenter - ChunkExtent;
+    
+    UE_LOG(LogTemp, Warning, TEXT("DrawDiagonalDebugVoxelsFast - ChunkCoords: %s"), *ChunkCoords.ToString());
+    UE_LOG(LogTemp, Warning, TEXT("ChunkCenter: %s, ChunkMinCorner: %s"), 
+           *ChunkCenter.ToString(), *ChunkMinCorner.ToString());
+    UE_LOG(LogTemp, Warning, TEXT("VoxelsPerChunk: %d, LocalVoxelSize: %f"),
+           VoxelsPerChunk, FVoxelConversion::LocalVoxelSize);
+    
+    // Collect diagonal voxel positions for batch rendering
+    TArray<FVector> DiagonalVoxelPositions;
+    DiagonalVoxelPositions.Reserve(VoxelsPerChunk);
+    
+    // Collect diagonal voxels from minimum corner to maximum corner
+    for (int32 i = 0; i < VoxelsPerChunk; i++)
+    {
+        FVector VoxelCenter = ChunkMinCorner + 
+                             FVector(i + 0.5f, i + 0.5f, i + 0.5f) * FVoxelConversion::LocalVoxelSize;
+        DiagonalVoxelPositions.Add(VoxelCenter);
+    }
+    
+    // Batch draw diagonal voxels (green)
+    if (DiagonalVoxelPositions.Num() > 0)
+    {
+        FastDebug->DrawBoxes(DiagonalVoxelPositions, 
+                           FVector(FVoxelConversion::LocalVoxelSize * 0.45f),
+                           FFastDebugConfig(FLinearColor::Green, DebugDuration, 1.5f));
+    }
+    
+    // Collect overflow voxel positions
+    TArray<FVector> OverflowVoxelPositions;
+    FVector overflowOffsets[] = {
+        FVector(-1, -1, -1),  // Corner overflow
+        FVector(-1, 0, 0),    // X-axis overflow
+        FVector(0, -1, 0),    // Y-axis overflow
+        FVector(0, 0, -1)     // Z-axis overflow
+    };
+    
+    for (const FVector& offset : overflowOffsets)
+    {
+        FVector VoxelCenter = ChunkMinCorner + 
+                             (offset + FVector(0.5f)) * FVoxelConversion::LocalVoxelSize;
+        OverflowVoxelPositions.Add(VoxelCenter);
+        
+        UE_LOG(LogTemp, Warning, TEXT("Overflow voxel at local position %s, world position %s"),
+               *offset.ToString(), *VoxelCenter.ToString());
+    }
+    
+    // Batch draw overflow voxels (purple)
+    if (OverflowVoxelPositions.Num() > 0)
+    {
+        FastDebug->DrawBoxes(OverflowVoxelPositions, 
+                           FVector(FVoxelConversion::LocalVoxelSize * 0.45f),
+                           FFastDebugConfig(FLinearColor(0.5f, 0.0f, 1.0f), DebugDuration, 2.0f));
+    }
+    
+    // Draw reference boxes
+    FastDebug->DrawBox(ChunkCenter, ChunkExtent, FRotator::ZeroRotator,
+                      FFastDebugConfig(FLinearColor::Red, DebugDuration, 2.5f));
+    
+    FastDebug->DrawBox(ChunkMinCorner, FVector(FVoxelConversion::LocalVoxelSize * 0.75f), FRotator::ZeroRotator,
+                      FFastDebugConfig(FLinearColor::Yellow, DebugDuration, 3.0f));
+    
+    FVector ChunkMaxCorner = ChunkCenter + ChunkExtent;
+    FastDebug->DrawBox(ChunkMaxCorner, FVector(FVoxelConversion::LocalVoxelSize * 0.75f), FRotator::ZeroRotator,
+                      FFastDebugConfig(FLinearColor::Blue, DebugDuration, 3.0f));
+    
+    FastDebug->DrawBox(FVector::ZeroVector, FVector(FVoxelConversion::LocalVoxelSize * 1.5f), FRotator::ZeroRotator,
+                      FFastDebugConfig(FLinearColor(1.0f, 0.0f, 1.0f), DebugDuration, 3.0f));
+    
+    // Draw overflow regions on the minimum sides
+    const float ChunkWorldSize = FVoxelConversion::ChunkSize * FVoxelConversion::TerrainGridSize;
+    
+    // X-axis overflow region
+    FVector XOverflowCenter = ChunkMinCorner + FVector(-FVoxelConversion::LocalVoxelSize * 0.5f, 
+                                                       ChunkWorldSize * 0.5f, 
+                                                       ChunkWorldSize * 0.5f);
+    FVector XOverflowExtent = FVector(FVoxelConversion::LocalVoxelSize * 0.5f, ChunkExtent.Y, ChunkExtent.Z);
+    
+    FastDebug->DrawBox(XOverflowCenter, XOverflowExtent, FRotator::ZeroRotator,
+                      FFastDebugConfig(FLinearColor(1.0f, 0.5f, 1.0f, 0.25f), DebugDuration, 1.0f));
+    
+    // Y-axis overflow region
+    FVector YOverflowCenter = ChunkMinCorner + FVector(ChunkWorldSize * 0.5f, 
+                                                       -FVoxelConversion::LocalVoxelSize * 0.5f, 
+                                                       ChunkWorldSize * 0.5f);
+    FVector YOverflowExtent = FVector(ChunkExtent.X, FVoxelConversion::LocalVoxelSize * 0.5f, ChunkExtent.Z);
+    
+    FastDebug->DrawBox(YOverflowCenter, YOverflowExtent, FRotator::ZeroRotator,
+                      FFastDebugConfig(FLinearColor(1.0f, 0.5f, 1.0f, 0.25f), DebugDuration, 1.0f));
+    
+    // Z-axis overflow region  
+    FVector ZOverflowCenter = ChunkMinCorner + FVector(ChunkWorldSize * 0.5f, 
+                                                       ChunkWorldSize * 0.5f, 
+                                                       -FVoxelConversion::LocalVoxelSize * 0.5f);
+    FVector ZOverflowExtent = FVector(ChunkExtent.X, ChunkExtent.Y, FVoxelConversion::LocalVoxelSize * 0.5f);
+    
+    FastDebug->DrawBox(ZOverflowCenter, ZOverflowExtent, FRotator::ZeroRotator,
+                      FFastDebugConfig(FLinearColor(1.0f, 0.5f, 1.0f, 0.25f), DebugDuration, 1.0f));
+}
+
+
+UStaticMesh* ADiggerManager::ConvertIslandToStaticMesh(const FIslandData& Island, bool bWorldOrigin, FString AssetName)
 {
-    // Get the hit location from camera first
-    FHitResult HitResult;
-    if (!ActiveBrush->GetCameraHitLocation(HitResult))
+    if (DiggerDebug::Islands)
+        UE_LOG(LogTemp, Warning, TEXT("Converting island %d to static mesh..."));
+
+    // 1. Generate mesh data for the island using Marching Cubes
+    TArray<FVector> Vertices;
+    TArray<int32> Triangles;
+    TArray<FVector> Normals;
+    TArray<FVector2D> UVs;
+    TArray<FColor> Colors;
+    TArray<FProcMeshTangent> Tangents;
+
+/* Single Island Mesh Generation in DiggerManager
+            // You may need to create a temporary SparseVoxelGrid for just this island
+            USparseVoxelGrid* TempGrid = NewObject<USparseVoxelGrid>();
+            
+            //TempGrid->AddVoxels(IslandVoxels);
+
+            // Generate mesh for just this island
+            MarchingCubes->GenerateMeshForIsland(TempGrid, Vertices, Triangles, Normals, UVs, Colors, Tangents);
+
+            // 4. Remove island voxels from the main grid
+            //TempGrid->RemoveVoxels(IslandVoxels);
+    */
+
+    // For demonstration, we'll log and return nullptr if not implemented
+    if (Vertices.Num() == 0 || Triangles.Num() == 0)
     {
-        if (DiggerDebug::Brush)
+        UE_LOG(LogTemp, Error, TEXT("No mesh data generated for island!"));
+        return nullptr;
+    }
+
+    // 2. Create a temporary ProceduralMeshComponent
+    UProceduralMeshComponent* TempProcMesh = NewObject<UProceduralMeshComponent>(this);
+    TempProcMesh->CreateMeshSection(0, Vertices, Triangles, Normals, UVs, Colors, Tangents, true);
+
+    // 3. Convert ProceduralMeshComponent to StaticMesh
+    FString PackageName = FString::Printf(TEXT("/Game/Islands/%s"), *AssetName);
+    UPackage* MeshPackage = CreatePackage(*PackageName);
+
+    UStaticMesh* NewStaticMesh = NewObject<UStaticMesh>(MeshPackage, *AssetName, RF_Public | RF_Standalone);
+    if (!NewStaticMesh)
+    {
+        UE_LOG(LogTemp, Error, TEXT("Failed to create UStaticMesh object!"));
+        return nullptr;
+    }
+
+    // Use the built-in conversion utility (UE 4.23+)
+    bool bSuccess = false;//TempProcMesh->CreateStaticMesh(NewStaticMesh, MeshPackage, AssetName, true);
+    if (!bSuccess)
+    {
+        UE_LOG(LogTemp, Error, TEXT("Failed to convert procedural mesh to static mesh!"));
+        return nullptr;
+    }
+
+    // 4. Register and save the asset
+    FAssetRegistryModule::AssetCreated(NewStaticMesh);
+    NewStaticMesh->MarkPackageDirty();
+
+#if WITH_EDITOR
+    // Notify the content browser
+    TArray<UObject*> ObjectsToSync;
+    ObjectsToSync.Add(NewStaticMesh);
+    GEditor->SyncBrowserToObjects(ObjectsToSync);
+#endif
+
+    UE_LOG(LogTemp, Warning, TEXT("Static mesh asset created: %s"), *PackageName);
+
+    return NewStaticMesh;
+}
+
+void ADiggerManager::UpdateAllDirtyChunks()
+{
+    if (DiggerDebug::Islands)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[DiggerPro] Running ADM::UpdateAllDirtyChunks..."));
+    }
+
+    // Dirty chunks put themselves in MeshQueue, so there's no ChunkMap walk here anymore
+    PumpMeshJobs();
+
+    if (DiggerDebug::Islands)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[DiggerPro] Finished updating dirty chunks."));
+    }
+}
+
+void ADiggerManager::EnqueueDirtyChunk(const FIntVector& ChunkCoords)
+{
+    MeshQueue.MarkDirty(ChunkCoords, FPlatformTime::Seconds());
+
+    if (IsInGameThread())
+    {
+        ScheduleMeshPump();
+        return;
+    }
+
+    // Voxel writes from workers, get the pump going on the game thread
+    TWeakObjectPtr<ADiggerManager> WeakThis(this);
+    AsyncTask(ENamedThreads::GameThread, [WeakThis]()
+    {
+        if (WeakThis.IsValid())
         {
-            UE_LOG(LogTemp, Warning, TEXT("No valid hit found"));
+            WeakThis->ScheduleMeshPump();
         }
+    });
+}
+
+void ADiggerManager::ScheduleMeshPump()
+{
+    UWorld* PumpWorld = GetWorld();
+    if (!PumpWorld)
+    {
         return;
     }
 
-    // Create brush stroke with the hit location and brush settings
-    BrushStroke = ActiveBrush->CreateBrushStroke(HitResult, ActiveBrush->GetDig());
+    FTimerManager& TimerManager = PumpWorld->GetTimerManager();
+    if (!TimerManager.TimerExists(MeshPumpTimerHandle))
+    {
+        MeshPumpTimerHandle = TimerManager.SetTimerForNextTick(this, &ADiggerManager::PumpMeshJobs);
+    }
+}
+
+void ADiggerManager::PumpMeshJobs()
+{
+    check(IsInGameThread());
+
+    UploadCompletedMeshJobs();
+
+    const int32 FreeSlots = MaxConcurrentMeshJobs - InFlightMeshJobs.Num();
+    if (FreeSlots > 0 && MeshQueue.Num() > 0)
+    {
+        const TOptional<FVector> ViewLocation = GetMeshPriorityViewLocation();
+        const float ChunkWorldSize = FMath::Max(FVoxelConversion::ChunkWorldSize, 1.0f);
+
+        TArray<FIntVector> ToDispatch;
+        MeshQueue.PopBest(FreeSlots, FPlatformTime::Seconds(), MeshRecencyWeight, MeshMaxWaitSeconds,
+            [&ViewLocation, ChunkWorldSize](const FIntVector& Coords)
+            {
+                if (!ViewLocation.IsSet())
+                {
+                    return 0.0f;
+                }
+                const FVector Center = FVoxelConversion::ChunkToWorld(Coords);
+                return (float)(FVector::Dist(Center, ViewLocation.GetValue()) / ChunkWorldSize);
+            },
+            // One job per chunk at a time, later dirties wait in the queue and go out as a single follow-up
+            [this](const FIntVector& Coords)
+            {
+                return !InFlightMeshJobs.Contains(Coords);
+            },
+            ToDispatch);
+
+        for (const FIntVector& Coords : ToDispatch)
+        {
+            UVoxelChunk** ChunkPtr = ChunkMap.Find(Coords);
+            // Not dirty anymore means something rebuilt it synchronously in the meantime (ForceUpdate)
+            if (ChunkPtr && IsValid(*ChunkPtr) && (*ChunkPtr)->IsDirty())
+            {
+                DispatchMeshJob(*ChunkPtr);
+            }
+        }
+    }
+
+    if (DiggerDebug::Mesh)
+    {
+        UE_LOG(LogTemp, Verbose, TEXT("[MeshJobs] Queued: %d  In flight: %d  Awaiting upload: %d"),
+            MeshQueue.Num(), InFlightMeshJobs.Num(), CompletedMeshJobs.Num());
+    }
+
+    CookDueChunkCollision();
 
-    if (DiggerDebug::UserConv)
+    // In-flight jobs reschedule the pump themselves when they finish
+    if (MeshQueue.Num() > 0 || CompletedMeshJobs.Num() > 0 || PendingCollisionCooks.Num() > 0)
     {
-        UE_LOG(LogTemp, Warning, TEXT("PIE Brush applied at: %s"), *BrushStroke.BrushPosition.ToString());
+        ScheduleMeshPump();
     }
-    
-    // Apply the brush
-    ApplyBrushToAllChunks(BrushStroke);
 }
 
-void ADiggerManager::ApplyBrushToAllChunks(FBrushStroke& BrushStroke, bool ForceUpdate)
+void ADiggerManager::RequestChunkCollision(const FIntVector& ChunkCoords)
 {
-    ApplyBrushToAllChunks(BrushStroke);
+    // Every new upload pushes the cook back, so a chunk being painted at 20 Hz cooks once the strokes stop
+    PendingCollisionCooks.Add(ChunkCoords, FPlatformTime::Seconds());
+    ScheduleMeshPump();
 }
 
-void ADiggerManager::ApplyBrushToAllChunks(FBrushStroke& BrushStroke)
+void ADiggerManager::GatherPhysicsActorLocations(TArray<FVector>& OutLocations) const
 {
-    const UVoxelBrushShape* ActiveBrushShape = GetActiveBrushShape(BrushStroke.BrushType);
-    if (!ActiveBrushShape)
+    OutLocations.Reset();
+    UWorld* PhysicsWorld = GetWorld();
+    if (!PhysicsWorld)
     {
-        if (DiggerDebug::Brush)
-        {
-            UE_LOG(LogTemp, Error, TEXT("ActiveBrushShape is null for brush type %d"), (int32)BrushStroke.BrushType);
-        }
         return;
     }
 
-    /*UE_LOG(LogTemp, Warning, TEXT("ApplyBrushToAllChunks: === BRUSH STROKE DEBUG ==="));
-    UE_LOG(LogTemp, Warning, TEXT("ApplyBrushToAllChunks: Position: %s"), *BrushStroke.BrushPosition.ToString());
-    UE_LOG(LogTemp, Warning, TEXT("ApplyBrushToAllChunks: Radius: %f"), BrushStroke.BrushRadius);
-    UE_LOG(LogTemp, Warning, TEXT("ApplyBrushToAllChunks: Falloff: %f"), BrushStroke.BrushFalloff);
-    UE_LOG(LogTemp, Warning, TEXT("ApplyBrushToAllChunks: Strength: %f"), BrushStroke.BrushStrength);
-    UE_LOG(LogTemp, Warning, TEXT("ApplyBrushToAllChunks: bDig: %s"), BrushStroke.bDig ? TEXT("true") : TEXT("false"));*/
-    
-    if (FVoxelConversion::LocalVoxelSize <= 0.0f)
+    // Pawns walk on the terrain, simulated islands fall onto it
+    for (TActorIterator<APawn> It(PhysicsWorld); It; ++It)
     {
-        FVoxelConversion::InitFromConfig(8, 4, 100.0f, FVector::ZeroVector);
+        OutLocations.Add(It->GetActorLocation());
     }
-
-    // Handle hole spawn ONCE per brush stroke, before processing chunks
-    if (BrushStroke.bDig)
+    for (const AIslandActor* Island : IslandActors)
     {
-        if(BrushStroke.BrushPosition.Z - BrushStroke.BrushRadius + BrushStroke.BrushFalloff <= GetLandscapeHeightAt(BrushStroke.BrushPosition))
+        if (IsValid(Island))
         {
-            HandleHoleSpawn(BrushStroke);
+            const UPrimitiveComponent* Root = Cast<UPrimitiveComponent>(Island->GetRootComponent());
+            if (Root && Root->IsSimulatingPhysics())
+            {
+                OutLocations.Add(Island->GetActorLocation());
+            }
         }
     }
+}
 
-    float BrushEffectRadius = BrushStroke.BrushRadius + BrushStroke.BrushFalloff;
-    float ChunkWorldSize = FVoxelConversion::ChunkSize * FVoxelConversion::LocalVoxelSize;
-    float ChunkDiagonal = ChunkWorldSize * 1.732f; // sqrt(3) for 3D diagonal
-    float SafetyPadding = BrushEffectRadius + ChunkDiagonal;
+void ADiggerManager::CookDueChunkCollision()
+{
+    if (PendingCollisionCooks.Num() == 0)
+    {
+        return;
+    }
 
-    FVector Min = BrushStroke.BrushPosition - FVector(SafetyPadding);
-    FVector Max = BrushStroke.BrushPosition + FVector(SafetyPadding);
+    TArray<FVector> PhysicsLocations;
+    GatherPhysicsActorLocations(PhysicsLocations);
 
-    FIntVector MinChunk = FVoxelConversion::WorldToChunk(Min);
-    FIntVector MaxChunk = FVoxelConversion::WorldToChunk(Max);
+    struct FDueCook
+    {
+        FIntVector Coords;
+        bool bNearPhysics;
+        double LastUploadTime;
+    };
+    TArray<FDueCook> DueCooks;
 
-    for (int32 X = MinChunk.X; X <= MaxChunk.X; ++X)
+    const double Now = FPlatformTime::Seconds();
+    const float ChunkWorldSize = FVoxelConversion::ChunkWorldSize;
+    for (const TPair<FIntVector, double>& Pair : PendingCollisionCooks)
     {
-        for (int32 Y = MinChunk.Y; Y <= MaxChunk.Y; ++Y)
+        const FBox PriorityBox = FBox::BuildAABB(FVoxelConversion::ChunkToWorld(Pair.Key), FVector(ChunkWorldSize * 0.5f)).ExpandBy(CollisionPriorityRadius);
+
+        bool bNearPhysics = false;
+        for (const FVector& Location : PhysicsLocations)
         {
-            for (int32 Z = MinChunk.Z; Z <= MaxChunk.Z; ++Z)
+            if (PriorityBox.IsInside(Location))
             {
-                FIntVector ChunkCoords(X, Y, Z);
-                
-                // Add this logging
-                if (DiggerDebug::Chunks)
-                {
-                    UE_LOG(LogTemp, Warning, TEXT("Trying to get/create chunk at: %s"), *ChunkCoords.ToString());
-                }
-                
-                if (UVoxelChunk* Chunk = GetOrCreateChunkAtChunk(ChunkCoords))
-                {
-                    if (DiggerDebug::Chunks)
-                    {
-                        UE_LOG(LogTemp, Warning, TEXT("Successfully got chunk at: %s"), *ChunkCoords.ToString());
-                    }
-                    
-                    ENetMode NetMode = GetWorld()->GetNetMode();
-                    if (NetMode == NM_Standalone)
-                    {
-                        // Single player: call the local method directly
-                        Chunk->ApplyBrushStroke(BrushStroke);
-                    }
-                    else
-                    {
-                        // Multiplayer: call the multicast function (from the server)
-                        Chunk->MulticastApplyBrushStroke(BrushStroke);
-                    }
-                }
-                else
-                {
-                    if (DiggerDebug::Chunks)
-                    {
-                        UE_LOG(LogTemp, Error, TEXT("Failed to get/create chunk at: %s"), *ChunkCoords.ToString());
-                    }
-                }
+                bNearPhysics = true;
+                break;
             }
         }
-    }
-}
 
-void ADiggerManager::SetVoxelAtWorldPosition(const FVector& WorldPos, float Value)
-{
-    // Safety checks
-    if (TerrainGridSize <= 0.0f || Subdivisions <= 0)
-    {
-        if (DiggerDebug::Space || DiggerDebug::Chunks)
+        const float Delay = bNearPhysics ? NearPhysicsCollisionDelay : CollisionCookDelay;
+        if (Now - Pair.Value >= Delay)
         {
-            UE_LOG(LogTemp, Error, TEXT("SetVoxelAtWorldPosition: Invalid TerrainGridSize or Subdivisions!"));
+            DueCooks.Add({ Pair.Key, bNearPhysics, Pair.Value });
         }
-        return;
     }
 
-    // Calculate chunk and voxel index
-    FIntVector ChunkCoords = FVoxelConversion::WorldToChunk(WorldPos);
-    FIntVector LocalVoxelIndex = FVoxelConversion::WorldToMinCornerVoxel(WorldPos);
-
-    // Try to get or create the chunk
-    if (UVoxelChunk* Chunk = GetOrCreateChunkAtChunk(ChunkCoords))
+    // Chunks something could be standing on first, then oldest first
+    DueCooks.Sort([](const FDueCook& A, const FDueCook& B)
     {
-        //Chunk->GetSparseVoxelGrid()->SetVoxel(LocalVoxelIndex, Value, true);
-
-        if (DiggerDebug::Space || DiggerDebug::Chunks)
+        if (A.bNearPhysics != B.bNearPhysics)
         {
-            UE_LOG(LogTemp, Display, TEXT("[SetVoxelAtWorldPosition] WorldPos: %s → Chunk: %s, Voxel: %s, Value: %.2f"),
-                   *WorldPos.ToString(), *ChunkCoords.ToString(), *LocalVoxelIndex.ToString(), Value);
+            return A.bNearPhysics;
         }
-    }
-    else
+        return A.LastUploadTime < B.LastUploadTime;
+    });
+
+    const int32 NumToCook = FMath::Min(DueCooks.Num(), MaxCollisionCooksPerFrame);
+    for (int32 i = 0; i < NumToCook; ++i)
     {
-        if (DiggerDebug::Space || DiggerDebug::Chunks)
+        const FIntVector& Coords = DueCooks[i].Coords;
+        PendingCollisionCooks.Remove(Coords);
+
+        UVoxelChunk** ChunkPtr = ChunkMap.Find(Coords);
+        UProceduralMeshComponent* Mesh = ChunkPtr && IsValid(*ChunkPtr) ? (*ChunkPtr)->GetMeshComponent() : nullptr;
+        const FProcMeshSection* Section = IsValid(Mesh) ? Mesh->GetProcMeshSection(0) : nullptr;
+        UProceduralMeshComponent* Collision = Section ? GetOrCreateChunkCollisionComponent(Coords) : nullptr;
+        if (!Collision)
         {
-            UE_LOG(LogTemp, Warning, TEXT("SetVoxelAtWorldPosition: Failed to get or create chunk at %s"), *ChunkCoords.ToString());
+            continue;
         }
-    }
-}
 
-
-// Updated ADiggerManager::DebugBrushPlacement()
-void ADiggerManager::DebugBrushPlacement(const FVector& ClickPosition)
-{
-    if (!IsInGameThread())
-    {
-        if (DiggerDebug::Brush || DiggerDebug::Threads)
+        // Exactly what was uploaded for rendering
+        TArray<FVector> Positions;
+        Positions.SetNumUninitialized(Section->ProcVertexBuffer.Num());
+        for (int32 v = 0; v < Positions.Num(); ++v)
         {
-            UE_LOG(LogTemp, Error, TEXT("DebugBrushPlacement: Not called from game thread!"));
+            Positions[v] = Section->ProcVertexBuffer[v].Position;
         }
-        return;
-    }
+        TArray<int32> Indices;
+        Indices.SetNumUninitialized(Section->ProcIndexBuffer.Num());
+        FMemory::Memcpy(Indices.GetData(), Section->ProcIndexBuffer.GetData(), Indices.Num() * sizeof(int32));
 
-    UWorld* CurrentWorld = GetSafeWorld();
-    if (!CurrentWorld)
-    {
-        if (DiggerDebug::Context)
+        // bUseAsyncCooking: in game worlds the cook runs on a worker into a new body setup, which the component
+        // only swaps in (and recreates its physics state with) once the cook has finished. Until then the
+        // previous body keeps colliding. Editor worlds cook inline.
+        Collision->CreateMeshSection(0, Positions, Indices, TArray<FVector>(), TArray<FVector2D>(), TArray<FColor>(),
+            TArray<FProcMeshTangent>(), true);
+
+        if (DiggerDebug::Mesh)
         {
-            UE_LOG(LogTemp, Error, TEXT("DebugBrushPlacement: GetSafeWorld() returned null!"));
+            UE_LOG(LogTemp, Verbose, TEXT("[Collision] Cooking chunk %s (near physics: %d)"), *Coords.ToString(), DueCooks[i].bNearPhysics);
         }
-        return;
     }
+}
 
-    // Ensure parameters are valid
-    if (TerrainGridSize <= 0.0f || Subdivisions <= 0)
+void ADiggerManager::DispatchMeshJob(UVoxelChunk* Chunk)
+{
+    UMarchingCubes* Generator = Chunk->GetMarchingCubesGenerator();
+    USparseVoxelGrid* Grid = Chunk->GetSparseVoxelGrid();
+    if (!Generator || !Grid)
     {
-        if (DiggerDebug::Brush || DiggerDebug::Space)
-        {
-            UE_LOG(LogTemp, Error, TEXT("DebugBrushPlacement: Invalid TerrainGridSize or Subdivisions!"));
-        }
         return;
     }
 
-    VoxelSize = TerrainGridSize / Subdivisions;
-    float ChunkWorldSize = ChunkSize * TerrainGridSize;
-
-    if (DiggerDebug::Space)
+    Chunk->ClearDirty();
+    if (Grid->VoxelData.IsEmpty())
     {
-        UE_LOG(LogTemp, Display, TEXT("ChunkSize=%d, Subdivisions=%d, VoxelSize=%.2f, ChunkWorldSize=%.2f"),
-               ChunkSize, Subdivisions, VoxelSize, ChunkWorldSize);
+        return;
     }
 
-    // Compute chunk coordinates from world position
-    FIntVector ChunkCoords = FVoxelConversion::WorldToChunk(ClickPosition);
+    Generator->SetDiggerManager(this);
 
-    if (DiggerDebug::Chunks || DiggerDebug::Space || DiggerDebug::Brush)
-    {
-        UE_LOG(LogTemp, Display, TEXT("ClickPos: %s → ChunkCoords: %s"),
-               *ClickPosition.ToString(), *ChunkCoords.ToString());
-    }
+    const FIntVector Coords = Chunk->GetChunkCoordinates();
+    const int32 SectionIndex = Chunk->GetSectionIndex();
+    const FVector Origin = FVoxelConversion::ChunkToWorld(Coords);
+    const float JobVoxelSize = FVoxelConversion::LocalVoxelSize;
+    const int32 LOD = GetChunkMeshLOD(Coords);
+    const FVoxelLODTransitions Transitions = GetChunkLODTransitions(Coords, LOD);
 
-    // Fetch or create the relevant chunk
-    if (UVoxelChunk* Chunk = GetOrCreateChunkAtChunk(ChunkCoords))
+    // Everything the worker touches is snapshotted here, so edits landing while the job runs can't race it.
+    // The height cache is filled now and the job keeps its own reference, the generator's can be dropped meanwhile.
+    TSharedRef<FVoxelDenseSlab, ESPMode::ThreadSafe> Slab = MakeShared<FVoxelDenseSlab, ESPMode::ThreadSafe>();
+    if (LOD > 0)
     {
-        Chunk->GetSparseVoxelGrid()->RenderVoxels();
-        Chunk->GetSparseVoxelGrid()->LogVoxelData();
+        UMarchingCubes::BuildLODMeshingSlab(Grid, LOD, Transitions, *Slab);
     }
     else
     {
-        if (DiggerDebug::Chunks || DiggerDebug::Space)
+        // The +X / +Y / +Z neighbours supply the layer past the high faces, so border normals match theirs
+        USparseVoxelGrid* HighNeighbourGrids[3] = { nullptr, nullptr, nullptr };
+        for (int32 Axis = 0; Axis < 3; ++Axis)
         {
-            UE_LOG(LogTemp, Warning, TEXT("Failed to get or create chunk at %s"), *ChunkCoords.ToString());
+            FIntVector NeighbourCoords = Coords;
+            NeighbourCoords[Axis] += 1;
+            if (UVoxelChunk** Neighbour = ChunkMap.Find(NeighbourCoords))
+            {
+                HighNeighbourGrids[Axis] = *Neighbour ? (*Neighbour)->GetSparseVoxelGrid() : nullptr;
+            }
         }
-        return;
+        UMarchingCubes::BuildMeshingSlab(Grid, *Slab, HighNeighbourGrids);
     }
-
-    // Compute chunk origin and extent
-    FVector ChunkCenter = FVector(ChunkCoords) * ChunkWorldSize;
-    FVector ChunkExtent = FVector(ChunkWorldSize * 0.5f);
-    FVector ChunkOrigin = ChunkCenter - ChunkExtent;
-
-    FVector LocalInChunk = ClickPosition - ChunkOrigin;
-    FIntVector LocalVoxel = FVoxelConversion::WorldToLocalVoxel(ClickPosition);
-    FVector LocalVoxelToWorld = FVoxelConversion::LocalVoxelToWorld(LocalVoxel);
-
-    if (DiggerDebug::Space || DiggerDebug::Voxels || DiggerDebug::Chunks)
+    if (!Generator->IsHeightCacheValid(Origin, JobVoxelSize))
     {
-        UE_LOG(LogTemp, Error, TEXT("LocalInChunk: %s, LocalVoxel: %s, WorldPosition: %s"),
-               *LocalInChunk.ToString(), *LocalVoxel.ToString(), *LocalVoxelToWorld.ToString());
+        Generator->InitializeHeightCache(Origin, JobVoxelSize);
     }
+    const FChunkHeightCachePtr Heights = Generator->GetHeightCache();
 
-    // World-space center of the voxel
-    FVector VoxelCenter = ChunkOrigin + FVector(LocalVoxel) * VoxelSize + FVector(VoxelSize * 0.5f);
+    InFlightMeshJobs.Add(Coords);
+    InFlightMeshGenerators.Add(Generator);
 
-    if (DiggerDebug::Voxels)
-    {
-        UE_LOG(LogTemp, Display, TEXT("VoxelCenter: %s"), *VoxelCenter.ToString());
-    }
-    
-    try
+    TWeakObjectPtr<ADiggerManager> WeakThis(this);
+    TWeakObjectPtr<UMarchingCubes> WeakGenerator(Generator);
+    Async(EAsyncExecution::ThreadPool, [WeakThis, WeakGenerator, Generator, Slab, Heights, Origin, JobVoxelSize, Coords, SectionIndex, LOD, Transitions]()
     {
-        // Get the fast debug subsystem
-        if (auto* FastDebug = UFastDebugSubsystem::Get(this))
-        {
-            // Draw the chunk bounding box (red)
-            FastDebug->DrawBox(ChunkCenter, ChunkExtent, FRotator::ZeroRotator, 
-                              FFastDebugConfig(FLinearColor::Red, 30.0f, 2.0f));
-
-            // Draw chunk center (yellow sphere)
-            FastDebug->DrawSphere(ChunkCenter, 30.0f, 
-                                 FFastDebugConfig(FLinearColor::Yellow, 30.0f, 2.0f));
-
-            // Draw chunk origin (orange sphere)
-            FastDebug->DrawSphere(ChunkOrigin, 20.0f, 
-                                 FFastDebugConfig(FLinearColor(1.0f, 0.5f, 0.0f), 30.0f, 2.0f));
+        FChunkMeshJobResult Result;
+        Result.ChunkCoords = Coords;
+        Result.SectionIndex = SectionIndex;
+        Result.Generator = WeakGenerator;
+        Result.Heights = Heights;
 
-            const int32 ChunkVoxels = ChunkSize * Subdivisions;
-            FVector SelectedVoxelCenter = FVector::ZeroVector;
+        // Without a manager there are no heights, everything counts as above ground like GetCachedHeight's 0
+        const FChunkHeightCache NoHeights;
+        const FChunkHeightCache& JobHeights = Heights.IsValid() ? *Heights : NoHeights;
 
-            // Collect edge voxel positions for batch rendering
-            TArray<FVector> EdgeVoxelPositions;
-            EdgeVoxelPositions.Reserve(ChunkVoxels * ChunkVoxels * 6); // Rough estimate
+        // Generator is kept alive by InFlightMeshGenerators until this result is uploaded
+        if (LOD > 0)
+        {
+            Generator->GenerateLODMeshFromSlab(*Slab, LOD, Transitions, JobHeights, Origin, JobVoxelSize, Result.Vertices, Result.Triangles, Result.Normals);
+        }
+        else
+        {
+            Generator->GenerateMeshFromSlab(*Slab, JobHeights, Origin, JobVoxelSize, Result.Vertices, Result.Triangles, Result.Normals);
+        }
 
-            for (int32 X = 0; X < ChunkVoxels; X++)
+        AsyncTask(ENamedThreads::GameThread, [WeakThis, Result = MoveTemp(Result)]() mutable
+        {
+            if (ADiggerManager* Manager = WeakThis.Get())
             {
-                for (int32 Y = 0; Y < ChunkVoxels; Y++)
-                {
-                    for (int32 Z = 0; Z < ChunkVoxels; Z++)
-                    {
-                        FIntVector VoxelCoord(X, Y, Z);
-                        FVector CurrentVoxelCenter = ChunkOrigin + FVector(VoxelCoord) * VoxelSize + FVector(VoxelSize * 0.5f);
+                Manager->CompletedMeshJobs.Add(MoveTemp(Result));
+                Manager->ScheduleMeshPump();
+            }
+        });
+    });
+}
 
-                        // Collect edge voxels
-                        if (X == 0 || X == ChunkVoxels - 1 ||
-                            Y == 0 || Y == ChunkVoxels - 1 ||
-                            Z == 0 || Z == ChunkVoxels - 1)
-                        {
-                            EdgeVoxelPositions.Add(CurrentVoxelCenter);
-                        }
+void ADiggerManager::UploadCompletedMeshJobs()
+{
+    if (CompletedMeshJobs.Num() == 0)
+    {
+        return;
+    }
+    DIGGER_SCOPE_CYCLE_COUNTER(STAT_DiggerUploadMesh);
 
-                        // Track the selected voxel
-                        if (VoxelCoord == LocalVoxel)
-                        {
-                            SelectedVoxelCenter = CurrentVoxelCenter;
-                        }
-                    }
-                }
-            }
+    const double StartTime = FPlatformTime::Seconds();
+    const double BudgetSeconds = MeshUploadBudgetMs * 0.001;
 
-            // Batch draw edge voxels as points (cyan)
-            if (EdgeVoxelPositions.Num() > 0)
-            {
-                FastDebug->DrawPoints(EdgeVoxelPositions, 5.0f, 
-                                     FFastDebugConfig(FColor::Cyan, 30.0f, 2.0f));
-            }
+    int32 NumUploaded = 0;
+    for (; NumUploaded < CompletedMeshJobs.Num(); ++NumUploaded)
+    {
+        // Always upload at least one so a single huge mesh can't stall the queue
+        if (NumUploaded >= MaxMeshUploadsPerFrame ||
+            (NumUploaded > 0 && FPlatformTime::Seconds() - StartTime > BudgetSeconds))
+        {
+            break;
+        }
 
-            // Draw the selected voxel (magenta box)
-            if (SelectedVoxelCenter != FVector::ZeroVector)
-            {
-                FastDebug->DrawBox(SelectedVoxelCenter, FVector(VoxelSize * 0.5f), FRotator::ZeroRotator,
-                                  FFastDebugConfig(FLinearColor(1.0f, 0.0f, 1.0f), 30.0f, 2.0f));
-            }
+        FChunkMeshJobResult& Result = CompletedMeshJobs[NumUploaded];
+        InFlightMeshJobs.Remove(Result.ChunkCoords);
 
-            // Draw interaction line
-            FastDebug->DrawLine(ClickPosition, SelectedVoxelCenter, 
-                               FFastDebugConfig(FLinearColor::Green, 30.0f, 3.0f));
+        UMarchingCubes* Generator = Result.Generator.Get();
+        if (!Generator)
+        {
+            continue;
+        }
+        InFlightMeshGenerators.RemoveSingleSwap(Generator);
 
-            // Draw interaction points
-            FastDebug->DrawSphere(ClickPosition, 20.0f, 
-                                 FFastDebugConfig(FLinearColor::Blue, 30.0f, 2.0f));
-            FastDebug->DrawSphere(SelectedVoxelCenter, 20.0f, 
-                                 FFastDebugConfig(FLinearColor(1.0f, 0.0f, 1.0f), 30.0f, 2.0f));
+        UVoxelChunk* Chunk = ChunkMap.FindRef(Result.ChunkCoords);
+        if (!Chunk)
+        {
+            continue;
         }
 
-        if (DiggerDebug::Brush)
+        // The landscape under the chunk changed while the job ran, mesh it again against the new heights
+        if (Result.Heights != Generator->GetHeightCache())
         {
-            UE_LOG(LogTemp, Warning, TEXT("DebugBrushPlacement: Debug visuals drawn successfully"));
+            Chunk->RequestRemesh();
+            continue;
+        }
+
+        if (Result.Vertices.Num() > 0 && Result.Triangles.Num() > 0 && Result.Normals.Num() > 0)
+        {
+            Generator->ReconstructMeshSection(Result.ChunkCoords, Result.Vertices, Result.Triangles, Result.Normals);
+        }
+        else if (DiggerDebug::Mesh)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("Empty mesh data for chunk %s"), *Result.ChunkCoords.ToString());
         }
     }
-    catch (...)
+
+    CompletedMeshJobs.RemoveAt(0, NumUploaded, false);
+}
+
+TOptional<FVector> ADiggerManager::GetMeshPriorityViewLocation() const
+{
+    UWorld* ViewWorld = GetWorld();
+    if (ViewWorld && ViewWorld->IsGameWorld())
     {
-        UE_LOG(LogTemp, Error, TEXT("DebugBrushPlacement: Exception drawing debug visuals"));
+        APlayerController* PC = ViewWorld->GetFirstPlayerController();
+        if (PC && PC->PlayerCameraManager)
+        {
+            return PC->PlayerCameraManager->GetCameraLocation();
+        }
+        // No camera yet while the level is still loading, mesh around where the player will appear
+        return ChunkLoadFocus;
     }
 
-    // Diagonal marker boxes
-    DrawDiagonalDebugVoxelsFast(ChunkCoords);
-    // Individual voxels right nearest the click position
-    DebugDrawVoxelAtWorldPositionFast(ClickPosition, FLinearColor::White, 25.0f, 2.0f);
-
-    if (DiggerDebug::Brush)
+#if WITH_EDITOR
+    if (GEditor && GEditor->GetActiveViewport())
     {
-        UE_LOG(LogTemp, Warning, TEXT("DebugBrushPlacement: completed"));
+        FEditorViewportClient* ViewportClient = static_cast<FEditorViewportClient*>(GEditor->GetActiveViewport()->GetClient());
+        if (ViewportClient)
+        {
+            return ViewportClient->GetViewLocation();
+        }
     }
+#endif
+    return TOptional<FVector>();
 }
-// Updated ADiggerManager::DebugDrawVoxelAtWorldPosition()
-void ADiggerManager::DebugDrawVoxelAtWorldPositionFast(const FVector& WorldPosition, const FLinearColor& BoxColor, float Duration, float Thickness)
-{
-    FIntVector ChunkCoords;
-    FIntVector VoxelIndex;
-    FVoxelConversion::WorldToChunkAndVoxel(WorldPosition, ChunkCoords, VoxelIndex);
 
-    if (!FVoxelConversion::IsValidVoxelIndex(VoxelIndex))
+void ADiggerManager::StartMeshLODUpdates()
+{
+    UWorld* LODWorld = GetWorld();
+    if (!LODWorld)
     {
-        UE_LOG(LogTemp, Warning, TEXT("Invalid voxel index at world position %s: Chunk %s, VoxelIndex %s"),
-            *WorldPosition.ToString(), *ChunkCoords.ToString(), *VoxelIndex.ToString());
         return;
     }
 
-    // Get the voxel center in world space
-    FVector VoxelCenter = FVoxelConversion::MinCornerVoxelToWorld(ChunkCoords, VoxelIndex);
-
-    // Draw using fast debug system
-    if (auto* FastDebug = UFastDebugSubsystem::Get(this))
+    FTimerManager& TimerManager = LODWorld->GetTimerManager();
+    if (bEnableMeshLOD)
     {
-        FastDebug->DrawBox(VoxelCenter, FVector(FVoxelConversion::LocalVoxelSize * 0.5f), FRotator::ZeroRotator,
-                          FFastDebugConfig(BoxColor, Duration, Thickness));
+        if (!TimerManager.TimerExists(MeshLODTimerHandle))
+        {
+            TimerManager.SetTimer(MeshLODTimerHandle, this, &ADiggerManager::UpdateChunkMeshLODs,
+                FMath::Max(LODUpdateInterval, 0.05f), true);
+        }
+        return;
     }
 
-    if (DiggerDebug::Chunks || DiggerDebug::Voxels)
+    // Turned off: back to full resolution everywhere
+    TimerManager.ClearTimer(MeshLODTimerHandle);
+    for (const TPair<FIntVector, uint8>& Pair : ChunkMeshLODs)
     {
-        UE_LOG(LogTemp, Log, TEXT("Drew voxel at world position %s: Chunk %s, VoxelIndex %s, Center %s"),
-            *WorldPosition.ToString(), *ChunkCoords.ToString(), *VoxelIndex.ToString(), *VoxelCenter.ToString());
+        UVoxelChunk** ChunkPtr = ChunkMap.Find(Pair.Key);
+        if (Pair.Value > 0 && ChunkPtr && IsValid(*ChunkPtr))
+        {
+            (*ChunkPtr)->RequestRemesh();
+        }
     }
+    ChunkMeshLODs.Reset();
 }
 
-// Updated ADiggerManager::DrawDiagonalDebugVoxels()
-void ADiggerManager::DrawDiagonalDebugVoxelsFast(FIntVector ChunkCoords)
+bool ADiggerManager::GetLODView(FVector& OutLocation, float& OutProjectionScale) const
 {
-    // Get the fast debug subsystem
-    auto* FastDebug = UFastDebugSubsystem::Get(this);
-    if (!FastDebug) return;
+    float FOVDegrees = 0.0f;
+    int32 ViewWidth = 0;
 
-    // Calculate chunk dimensions
-    const int32 VoxelsPerChunk = FVoxelConversion::ChunkSize * FVoxelConversion::Subdivisions;
-    const float DebugDuration = 30.0f;
-    
-    // Get the chunk center using the conversion method
-    FVector ChunkCenter = FVoxelConversion::ChunkToWorld(ChunkCoords);
-    FVector ChunkExtent = FVector(FVoxelConversion::ChunkSize * FVoxelConversion::TerrainGridSize / 2.0f);
-    
-    // Calculate the minimum corner based on the center and extent
-    FVector ChunkMinCorner = ChunkCenter - ChunkExtent;
-    
-    UE_LOG(LogTemp, Warning, TEXT("DrawDiagonalDebugVoxelsFast - ChunkCoords: %s"), *ChunkCoords.ToString());
-    UE_LOG(LogTemp, Warning, TEXT("ChunkCenter: %s, ChunkMinCorner: %s"), 
-           *ChunkCenter.ToString(), *ChunkMinCorner.ToString());
-    UE_LOG(LogTemp, Warning, TEXT("VoxelsPerChunk: %d, LocalVoxelSize: %f"),
-           VoxelsPerChunk, FVoxelConversion::LocalVoxelSize);
-    
-    // Collect diagonal voxel positions for batch rendering
-    TArray<FVector> DiagonalVoxelPositions;
-    DiagonalVoxelPositions.Reserve(VoxelsPerChunk);
-    
-    // Collect diagonal voxels from minimum corner to maximum corner
-    for (int32 i = 0; i < VoxelsPerChunk; i++)
+    UWorld* ViewWorld = GetWorld();
+    if (ViewWorld && ViewWorld->IsGameWorld())
     {
-        FVector VoxelCenter = ChunkMinCorner + 
-                             FVector(i + 0.5f, i + 0.5f, i + 0.5f) * FVoxelConversion::LocalVoxelSize;
-        DiagonalVoxelPositions.Add(VoxelCenter);
+        APlayerController* PC = ViewWorld->GetFirstPlayerController();
+        if (!PC || !PC->PlayerCameraManager)
+        {
+            return false;
+        }
+        int32 ViewHeight = 0;
+        PC->GetViewportSize(ViewWidth, ViewHeight);
+        OutLocation = PC->PlayerCameraManager->GetCameraLocation();
+        FOVDegrees = PC->PlayerCameraManager->GetFOVAngle();
     }
-    
-    // Batch draw diagonal voxels (green)
-    if (DiagonalVoxelPositions.Num() > 0)
+#if WITH_EDITOR
+    else if (GEditor && GEditor->GetActiveViewport())
     {
-        FastDebug->DrawBoxes(DiagonalVoxelPositions, 
-                           FVector(FVoxelConversion::LocalVoxelSize * 0.45f),
-                           FFastDebugConfig(FLinearColor::Green, DebugDuration, 1.5f));
+        FViewport* Viewport = GEditor->GetActiveViewport();
+        FEditorViewportClient* ViewportClient = static_cast<FEditorViewportClient*>(Viewport->GetClient());
+        if (!ViewportClient || ViewportClient->IsOrtho())
+        {
+            return false;
+        }
+        OutLocation = ViewportClient->GetViewLocation();
+        FOVDegrees = ViewportClient->ViewFOV;
+        ViewWidth = Viewport->GetSizeXY().X;
     }
-    
-    // Collect overflow voxel positions
-    TArray<FVector> OverflowVoxelPositions;
-    FVector overflowOffsets[] = {
-        FVector(-1, -1, -1),  // Corner overflow
-        FVector(-1, 0, 0),    // X-axis overflow
-        FVector(0, -1, 0),    // Y-axis overflow
-        FVector(0, 0, -1)     // Z-axis overflow
-    };
-    
-    for (const FVector& offset : overflowOffsets)
+#endif
+
+    // No view (dedicated server, viewport not up yet): leave the LODs alone
+    if (ViewWidth <= 0 || FOVDegrees <= 0.0f)
     {
-        FVector VoxelCenter = ChunkMinCorner + 
-                             (offset + FVector(0.5f)) * FVoxelConversion::LocalVoxelSize;
-        OverflowVoxelPositions.Add(VoxelCenter);
-        
-        UE_LOG(LogTemp, Warning, TEXT("Overflow voxel at local position %s, world position %s"),
-               *offset.ToString(), *VoxelCenter.ToString());
+        return false;
     }
-    
-    // Batch draw overflow voxels (purple)
-    if (OverflowVoxelPositions.Num() > 0)
+    OutProjectionScale = ViewWidth / (2.0f * FMath::Tan(FMath::DegreesToRadians(FOVDegrees) * 0.5f));
+    return true;
+}
+
+int32 ADiggerManager::GetMaxUsableMeshLOD() const
+{
+    // Cells have to tile the chunk, with at least two per side
+    const int32 N = FVoxelConversion::ChunkSize * FVoxelConversion::Subdivisions;
+    int32 LOD = 0;
+    while (LOD < MaxMeshLOD && N % (2 << LOD) == 0 && N / (2 << LOD) >= 2)
     {
-        FastDebug->DrawBoxes(OverflowVoxelPositions, 
-                           FVector(FVoxelConversion::LocalVoxelSize * 0.45f),
-                           FFastDebugConfig(FLinearColor(0.5f, 0.0f, 1.0f), DebugDuration, 2.0f));
+        ++LOD;
     }
-    
-    // Draw reference boxes
-    FastDebug->DrawBox(ChunkCenter, ChunkExtent, FRotator::ZeroRotator,
-                      FFastDebugConfig(FLinearColor::Red, DebugDuration, 2.5f));
-    
-    FastDebug->DrawBox(ChunkMinCorner, FVector(FVoxelConversion::LocalVoxelSize * 0.75f), FRotator::ZeroRotator,
-                      FFastDebugConfig(FLinearColor::Yellow, DebugDuration, 3.0f));
-    
-    FVector ChunkMaxCorner = ChunkCenter + ChunkExtent;
-    FastDebug->DrawBox(ChunkMaxCorner, FVector(FVoxelConversion::LocalVoxelSize * 0.75f), FRotator::ZeroRotator,
-                      FFastDebugConfig(FLinearColor::Blue, DebugDuration, 3.0f));
-    
-    FastDebug->DrawBox(FVector::ZeroVector, FVector(FVoxelConversion::LocalVoxelSize * 1.5f), FRotator::ZeroRotator,
-                      FFastDebugConfig(FLinearColor(1.0f, 0.0f, 1.0f), DebugDuration, 3.0f));
-    
-    // Draw overflow regions on the minimum sides
-    const float ChunkWorldSize = FVoxelConversion::ChunkSize * FVoxelConversion::TerrainGridSize;
-    
-    // X-axis overflow region
-    FVector XOverflowCenter = ChunkMinCorner + FVector(-FVoxelConversion::LocalVoxelSize * 0.5f, 
-                                                       ChunkWorldSize * 0.5f, 
-                                                       ChunkWorldSize * 0.5f);
-    FVector XOverflowExtent = FVector(FVoxelConversion::LocalVoxelSize * 0.5f, ChunkExtent.Y, ChunkExtent.Z);
-    
-    FastDebug->DrawBox(XOverflowCenter, XOverflowExtent, FRotator::ZeroRotator,
-                      FFastDebugConfig(FLinearColor(1.0f, 0.5f, 1.0f, 0.25f), DebugDuration, 1.0f));
-    
-    // Y-axis overflow region
-    FVector YOverflowCenter = ChunkMinCorner + FVector(ChunkWorldSize * 0.5f, 
-                                                       -FVoxelConversion::LocalVoxelSize * 0.5f, 
-                                                       ChunkWorldSize * 0.5f);
-    FVector YOverflowExtent = FVector(ChunkExtent.X, FVoxelConversion::LocalVoxelSize * 0.5f, ChunkExtent.Z);
-    
-    FastDebug->DrawBox(YOverflowCenter, YOverflowExtent, FRotator::ZeroRotator,
-                      FFastDebugConfig(FLinearColor(1.0f, 0.5f, 1.0f, 0.25f), DebugDuration, 1.0f));
-    
-    // Z-axis overflow region  
-    FVector ZOverflowCenter = ChunkMinCorner + FVector(ChunkWorldSize * 0.5f, 
-                                                       ChunkWorldSize * 0.5f, 
-                                                       -FVoxelConversion::LocalVoxelSize * 0.5f);
-    FVector ZOverflowExtent = FVector(ChunkExtent.X, ChunkExtent.Y, FVoxelConversion::LocalVoxelSize * 0.5f);
-    
-    FastDebug->DrawBox(ZOverflowCenter, ZOverflowExtent, FRotator::ZeroRotator,
-                      FFastDebugConfig(FLinearColor(1.0f, 0.5f, 1.0f, 0.25f), DebugDuration, 1.0f));
+    return LOD;
 }
 
-
-UStaticMesh* ADiggerManager::ConvertIslandToStaticMesh(const FIslandData& Island, bool bWorldOrigin, FString AssetName)
+FVoxelLODTransitions ADiggerManager::GetChunkLODTransitions(const FIntVector& ChunkCoords, int32 LOD) const
 {
-    if (DiggerDebug::Islands)
-        UE_LOG(LogTemp, Warning, TEXT("Converting island %d to static mesh..."));
-
-    // 1. Generate mesh data for the island using Marching Cubes
-    TArray<FVector> Vertices;
-    TArray<int32> Triangles;
-    TArray<FVector> Normals;
-    TArray<FVector2D> UVs;
-    TArray<FColor> Colors;
-    TArray<FProcMeshTangent> Tangents;
-
-/* Single Island Mesh Generation in DiggerManager
-            // You may need to create a temporary SparseVoxelGrid for just this island
-            USparseVoxelGrid* TempGrid = NewObject<USparseVoxelGrid>();
-            
-            //TempGrid->AddVoxels(IslandVoxels);
-
-            // Generate mesh for just this island
-            MarchingCubes->GenerateMeshForIsland(TempGrid, Vertices, Triangles, Normals, UVs, Colors, Tangents);
-
-            // 4. Remove island voxels from the main grid
-            //TempGrid->RemoveVoxels(IslandVoxels);
-    */
-
-    // For demonstration, we'll log and return nullptr if not implemented
-    if (Vertices.Num() == 0 || Triangles.Num() == 0)
+    // Faces / edges shared with a finer chunk get transition cells on this side
+    FVoxelLODTransitions Transitions;
+    if (LOD == 0)
     {
-        UE_LOG(LogTemp, Error, TEXT("No mesh data generated for island!"));
-        return nullptr;
+        return Transitions;
     }
 
-    // 2. Create a temporary ProceduralMeshComponent
-    UProceduralMeshComponent* TempProcMesh = NewObject<UProceduralMeshComponent>(this);
-    TempProcMesh->CreateMeshSection(0, Vertices, Triangles, Normals, UVs, Colors, Tangents, true);
-
-    // 3. Convert ProceduralMeshComponent to StaticMesh
-    FString PackageName = FString::Printf(TEXT("/Game/Islands/%s"), *AssetName);
-    UPackage* MeshPackage = CreatePackage(*PackageName);
+    for (int32 Bit = 0; Bit < FVoxelLODTransitions::NumFaces + FVoxelLODTransitions::NumEdges; ++Bit)
+    {
+        const FIntVector NeighbourCoords = ChunkCoords + FVoxelLODTransitions::NeighbourOffset(Bit);
+        if (ChunkMap.Contains(NeighbourCoords) && GetChunkMeshLOD(NeighbourCoords) < LOD)
+        {
+            Transitions.Set(Bit);
+        }
+    }
+    return Transitions;
+}
 
-    UStaticMesh* NewStaticMesh = NewObject<UStaticMesh>(MeshPackage, *AssetName, RF_Public | RF_Standalone);
-    if (!NewStaticMesh)
+void ADiggerManager::UpdateChunkMeshLODs()
+{
+    if (!bEnableMeshLOD || ChunkMap.Num() == 0)
     {
-        UE_LOG(LogTemp, Error, TEXT("Failed to create UStaticMesh object!"));
-        return nullptr;
+        return;
     }
 
-    // Use the built-in conversion utility (UE 4.23+)
-    bool bSuccess = false;//TempProcMesh->CreateStaticMesh(NewStaticMesh, MeshPackage, AssetName, true);
-    if (!bSuccess)
+    FVector ViewLocation;
+    float ProjectionScale = 0.0f;
+    if (!GetLODView(ViewLocation, ProjectionScale))
     {
-        UE_LOG(LogTemp, Error, TEXT("Failed to convert procedural mesh to static mesh!"));
-        return nullptr;
+        return;
     }
 
-    // 4. Register and save the asset
-    FAssetRegistryModule::AssetCreated(NewStaticMesh);
-    NewStaticMesh->MarkPackageDirty();
+    const int32 MaxLOD = GetMaxUsableMeshLOD();
+    const float VoxelSize = FVoxelConversion::LocalVoxelSize;
+    const FVector HalfChunk(FVoxelConversion::ChunkWorldSize * 0.5f);
 
-#if WITH_EDITOR
-    // Notify the content browser
-    TArray<UObject*> ObjectsToSync;
-    ObjectsToSync.Add(NewStaticMesh);
-    GEditor->SyncBrowserToObjects(ObjectsToSync);
-#endif
+    // A chunk only goes coarser once the next level is comfortably under the limit, so chunks right at a
+    // threshold don't flip back and forth as the camera moves
+    constexpr float CoarsenMargin = 0.75f;
+    auto LODError = [VoxelSize](int32 LOD) { return ((1 << LOD) - 1) * VoxelSize; };
 
-    UE_LOG(LogTemp, Warning, TEXT("Static mesh asset created: %s"), *PackageName);
+    TMap<FIntVector, uint8> NewLODs;
+    NewLODs.Reserve(ChunkMap.Num());
+    for (const TPair<FIntVector, UVoxelChunk*>& Pair : ChunkMap)
+    {
+        // The mesh sits centred on ChunkToWorld (see TotalOffset in the mesher)
+        const FBox Bounds = FBox::BuildAABB(FVoxelConversion::ChunkToWorld(Pair.Key), HalfChunk);
+        const float Distance = FMath::Max(FMath::Sqrt(Bounds.ComputeSquaredDistanceToPoint(ViewLocation)), 1.0f);
+        const float AllowedError = LODMaxScreenSpaceError * Distance / ProjectionScale;
 
-    return NewStaticMesh;
-}
+        int32 LOD = FMath::Min<int32>(ChunkMeshLODs.FindRef(Pair.Key), MaxLOD);
+        while (LOD > 0 && LODError(LOD) > AllowedError)
+        {
+            --LOD;
+        }
+        while (LOD < MaxLOD && LODError(LOD + 1) <= AllowedError * CoarsenMargin)
+        {
+            ++LOD;
+        }
+        NewLODs.Add(Pair.Key, (uint8)LOD);
+    }
 
-void ADiggerManager::UpdateAllDirtyChunks()
-{
-    if (DiggerDebug::Islands)
+    // Touching chunks (faces, edges and corners) stay within one level of each other. Levels only ever drop here,
+    // so this settles within MaxLOD passes.
+    for (int32 Pass = 0; Pass <= MaxLOD; ++Pass)
     {
-        UE_LOG(LogTemp, Warning, TEXT("[DiggerPro] Running ADM::UpdateAllDirtyChunks..."));
+        bool bChanged = false;
+        for (TPair<FIntVector, uint8>& Pair : NewLODs)
+        {
+            for (int32 dx = -1; dx <= 1; ++dx)
+            for (int32 dy = -1; dy <= 1; ++dy)
+            for (int32 dz = -1; dz <= 1; ++dz)
+            {
+                const uint8* Neighbour = NewLODs.Find(Pair.Key + FIntVector(dx, dy, dz));
+                if (Neighbour && Pair.Value > *Neighbour + 1)
+                {
+                    Pair.Value = *Neighbour + 1;
+                    bChanged = true;
+                }
+            }
+        }
+        if (!bChanged)
+        {
+            break;
+        }
     }
 
-    for (const auto& ChunkPair : ChunkMap)
+    // A chunk whose level changed remeshes, and so do the chunks around it since their transition cells depend on it
+    TSet<FIntVector> ToRemesh;
+    for (const TPair<FIntVector, uint8>& Pair : NewLODs)
     {
-        UVoxelChunk* Chunk = ChunkPair.Value;
-        if (Chunk)
+        if (ChunkMeshLODs.FindRef(Pair.Key) == Pair.Value)
+        {
+            continue;
+        }
+        for (int32 dx = -1; dx <= 1; ++dx)
+        for (int32 dy = -1; dy <= 1; ++dy)
+        for (int32 dz = -1; dz <= 1; ++dz)
         {
-            Chunk->UpdateIfDirty(); // Only updates if marked dirty
+            ToRemesh.Add(Pair.Key + FIntVector(dx, dy, dz));
         }
     }
+    ChunkMeshLODs = MoveTemp(NewLODs);
 
-    if (DiggerDebug::Islands)
+    for (const FIntVector& Coords : ToRemesh)
     {
-        UE_LOG(LogTemp, Warning, TEXT("[DiggerPro] Finished updating dirty chunks."));
+        UVoxelChunk** ChunkPtr = ChunkMap.Find(Coords);
+        if (ChunkPtr && IsValid(*ChunkPtr))
+        {
+            (*ChunkPtr)->RequestRemesh();
+        }
+    }
+
+    if (DiggerDebug::Mesh && ToRemesh.Num() > 0)
+    {
+        UE_LOG(LogTemp, Verbose, TEXT("[MeshLOD] %d chunks changed level around %s"), ToRemesh.Num(), *ViewLocation.ToString());
     }
 }
 
@@ -2031,7 +3979,7 @@ FIslandMeshData ADiggerManager::ExtractAndGenerateIslandMeshFromData(UVoxelChunk
     
     for (const FIntVector& Pos : IslandData.Voxels)
     {
-        FVoxelData* Data = VoxelGrid->GetVoxelData(Pos);
+        const FVoxelData* Data = VoxelGrid->GetVoxelData(Pos);
         if (Data)
         {
             ExtractedVoxelData.Add(Pos, *Data);
@@ -2066,7 +4014,7 @@ FIslandMeshData ADiggerManager::ExtractAndGenerateIslandMeshFromData(UVoxelChunk
                 BoundaryVoxels.Add(Neighbor);
                 
                 // Check if this neighbor exists in the original grid
-                FVoxelData* NeighborData = VoxelGrid->GetVoxelData(Neighbor);
+                const FVoxelData* NeighborData = VoxelGrid->GetVoxelData(Neighbor);
                 if (NeighborData)
                 {
                     ExtractedVoxelData.Add(Neighbor, *NeighborData);
@@ -2192,8 +4140,12 @@ void ADiggerManager::RecreateIslandFromSaveData(const FIslandSaveData& SaveData)
 void ADiggerManager::PopulateAllCachedLandscapeHeights()
 {
     // Clear caches if needed
-    LandscapeHeightCaches.Empty();
+    {
+        FRWScopeLock WriteLock(LandscapeHeightCachesLock, SLT_Write);
+        LandscapeHeightCaches.Empty();
+    }
     HeightCacheLoadingSet.Empty();
+    PendingHeightRegions.Empty();
 
     // Find all landscapes and start async cache
     for (TActorIterator<ALandscapeProxy> It(GetWorld()); It; ++It)
@@ -2211,6 +4163,16 @@ void ADiggerManager::BeginPlay()
 {
     Super::BeginPlay();
 
+    // Every player needs a controller-owned component to send its strokes to the server with
+    if (HasAuthority())
+    {
+        PostLoginHandle = FGameModeEvents::GameModePostLoginEvent.AddUObject(this, &ADiggerManager::AddStrokeNetComponent);
+        for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+        {
+            AddStrokeNetComponent(nullptr, It->Get());
+        }
+    }
+
     UE_LOG(LogTemp, Warning, TEXT("=== PIE STARTED - CHUNK STATUS ==="));
     UE_LOG(LogTemp, Warning, TEXT("ChunkMap contains %d chunks"), ChunkMap.Num());
 
@@ -2231,6 +4193,9 @@ void ADiggerManager::BeginPlay()
 
     UpdateVoxelSize();
 
+    // PIE world has its own proxies
+    RebuildLandscapeProxyIndex();
+
     StartHeightCaching();
         
     // ensure brushes are ready for PIE usage
@@ -2241,7 +4206,15 @@ void ADiggerManager::BeginPlay()
     ClearProceduralMeshes();
     //ClearAllVoxelData();
     //InitializeTerrainCache(); // or lazy-init fallback
-    LoadAllChunks();
+    if (bEnableChunkStreaming)
+    {
+        StartChunkStreaming();
+    }
+    else
+    {
+        LoadAllChunksAsync(TEXT("Default"));
+    }
+    StartMeshLODUpdates();
     
     // Start the timer to process dirty chunks
    // if (World)
@@ -2275,6 +4248,17 @@ void ADiggerManager::BeginPlay()
     }
 }
 
+void ADiggerManager::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (PostLoginHandle.IsValid())
+    {
+        FGameModeEvents::GameModePostLoginEvent.Remove(PostLoginHandle);
+        PostLoginHandle.Reset();
+    }
+
+    Super::EndPlay(EndPlayReason);
+}
+
 void ADiggerManager::StartHeightCaching()
 {
     // Call your async height caching method here
@@ -2471,6 +4455,24 @@ void ADiggerManager::ClearProceduralMeshes()
         {
             UE_LOG(LogTemp, Warning, TEXT("No ProceduralMesh found to clear."));
         }
+
+        // Per-chunk meshes
+        for (UProceduralMeshComponent* ChunkMesh : ProceduralMeshComponents)
+        {
+            if (IsValid(ChunkMesh))
+            {
+                ChunkMesh->ClearAllMeshSections();
+            }
+        }
+        for (const auto& Pair : ChunkMap)
+        {
+            UProceduralMeshComponent* ChunkCollision = Pair.Value ? Pair.Value->GetCollisionComponent() : nullptr;
+            if (IsValid(ChunkCollision))
+            {
+                ChunkCollision->ClearAllMeshSections();
+            }
+        }
+        PendingCollisionCooks.Reset();
 }
 
 
@@ -2559,19 +4561,102 @@ void ADiggerManager::InitializeSingleChunk(UVoxelChunk* Chunk)
     }
 
     FIntVector Coordinates = Chunk->GetChunkCoordinates();
-    UProceduralMeshComponent* NewMeshComponent = NewObject<UProceduralMeshComponent>(this);
-    if (NewMeshComponent)
+    ChunkMap.Add(Coordinates, Chunk);
+    if (!GetOrCreateChunkMeshComponent(Coordinates))
     {
-        NewMeshComponent->RegisterComponent();
-        NewMeshComponent->AttachToComponent(GetRootComponent(), FAttachmentTransformRules::KeepRelativeTransform);
-        Chunk->InitializeMeshComponent(NewMeshComponent);
-        ChunkMap.Add(Coordinates, Chunk);
-        ProceduralMeshComponents.Add(NewMeshComponent);
+        UE_LOG(LogTemp, Error, TEXT("Failed to create a ProceduralMeshComponent for chunk at coordinates: %s"), *Coordinates.ToString());
     }
-    else
+}
+
+UProceduralMeshComponent* ADiggerManager::GetOrCreateChunkMeshComponent(const FIntVector& ChunkCoords)
+{
+    UVoxelChunk** ChunkPtr = ChunkMap.Find(ChunkCoords);
+    if (!ChunkPtr || !IsValid(*ChunkPtr))
     {
-        UE_LOG(LogTemp, Error, TEXT("Failed to create a ProceduralMeshComponent for chunk at coordinates: %s"), *Coordinates.ToString());
+        return nullptr;
+    }
+
+    UVoxelChunk* Chunk = *ChunkPtr;
+    if (UProceduralMeshComponent* Existing = Chunk->GetMeshComponent())
+    {
+        if (IsValid(Existing))
+        {
+            return Existing;
+        }
+    }
+
+    const FName ComponentName = MakeUniqueObjectName(this, UProceduralMeshComponent::StaticClass(),
+        *FString::Printf(TEXT("ChunkMesh_%d_%d_%d"), ChunkCoords.X, ChunkCoords.Y, ChunkCoords.Z));
+    UProceduralMeshComponent* NewMeshComponent = NewObject<UProceduralMeshComponent>(this, ComponentName);
+    if (!NewMeshComponent)
+    {
+        return nullptr;
+    }
+
+    // Same placement as the old shared component (vertices are in manager space). Render only, the chunk's
+    // collision is on its collision component (GetOrCreateChunkCollisionComponent)
+    NewMeshComponent->SetupAttachment(GetRootComponent());
+    NewMeshComponent->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+    NewMeshComponent->SetCanEverAffectNavigation(false);
+    NewMeshComponent->RegisterComponent();
+    AddInstanceComponent(NewMeshComponent);
+
+    Chunk->InitializeMeshComponent(NewMeshComponent);
+    ProceduralMeshComponents.Add(NewMeshComponent);
+
+    if (DiggerDebug::Chunks || DiggerDebug::Mesh)
+    {
+        UE_LOG(LogTemp, Log, TEXT("Created mesh component %s for chunk %s"), *ComponentName.ToString(), *ChunkCoords.ToString());
+    }
+    return NewMeshComponent;
+}
+
+UProceduralMeshComponent* ADiggerManager::GetOrCreateChunkCollisionComponent(const FIntVector& ChunkCoords)
+{
+    UVoxelChunk** ChunkPtr = ChunkMap.Find(ChunkCoords);
+    if (!ChunkPtr || !IsValid(*ChunkPtr))
+    {
+        return nullptr;
+    }
+
+    UVoxelChunk* Chunk = *ChunkPtr;
+    if (UProceduralMeshComponent* Existing = Chunk->GetCollisionComponent())
+    {
+        if (IsValid(Existing))
+        {
+            return Existing;
+        }
+    }
+
+    const FName ComponentName = MakeUniqueObjectName(this, UProceduralMeshComponent::StaticClass(),
+        *FString::Printf(TEXT("ChunkCollision_%d_%d_%d"), ChunkCoords.X, ChunkCoords.Y, ChunkCoords.Z));
+    UProceduralMeshComponent* NewCollisionComponent = NewObject<UProceduralMeshComponent>(this, ComponentName);
+    if (!NewCollisionComponent)
+    {
+        return nullptr;
+    }
+
+    // Never drawn, it only carries the cooked body. Collision settings are the ones the chunk meshes always had.
+    NewCollisionComponent->SetupAttachment(GetRootComponent());
+    NewCollisionComponent->SetVisibility(false);
+    NewCollisionComponent->SetHiddenInGame(true);
+    NewCollisionComponent->SetCastShadow(false);
+    NewCollisionComponent->bUseComplexAsSimpleCollision = true;
+    NewCollisionComponent->bUseAsyncCooking = true;
+    NewCollisionComponent->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
+    NewCollisionComponent->SetCollisionObjectType(ECC_WorldDynamic);
+    NewCollisionComponent->SetCollisionResponseToAllChannels(ECR_Block);
+    NewCollisionComponent->SetCollisionResponseToChannel(ECC_Pawn, ECR_Block);
+    NewCollisionComponent->RegisterComponent();
+    AddInstanceComponent(NewCollisionComponent);
+
+    Chunk->InitializeCollisionComponent(NewCollisionComponent);
+
+    if (DiggerDebug::Chunks || DiggerDebug::Mesh)
+    {
+        UE_LOG(LogTemp, Log, TEXT("Created collision component %s for chunk %s"), *ComponentName.ToString(), *ChunkCoords.ToString());
     }
+    return NewCollisionComponent;
 }
 
 void ADiggerManager::UpdateLandscapeProxies()
@@ -2587,27 +4672,44 @@ void ADiggerManager::UpdateLandscapeProxies()
             CachedLandscapeProxies.Add(Proxy);
         }
     }
+
+    RebuildLandscapeProxyIndex();
 }
 
-TSharedPtr<TMap<FIntPoint, float>> ADiggerManager::GetOrCreateLandscapeHeightCache(ALandscapeProxy* Landscape)
+FLandscapeHeightfieldPtr ADiggerManager::FindLandscapeHeightfield(ALandscapeProxy* Landscape) const
 {
-    if (!IsValid(Landscape))
+    if (!Landscape)
     {
-        UE_LOG(LogTemp, Warning, TEXT("Invalid LandscapeProxy passed to GetOrCreateLandscapeHeightCache."));
         return nullptr;
     }
 
-    if (!LandscapeHeightCaches.Contains(Landscape))
+    FRWScopeLock ReadLock(LandscapeHeightCachesLock, SLT_ReadOnly);
+    const FLandscapeHeightfieldPtr* Found = LandscapeHeightCaches.Find(Landscape);
+    return Found ? *Found : nullptr;
+}
+
+float ADiggerManager::GetCachedLandscapeHeightAt(const FVector& WorldPos)
+{
+    ALandscapeProxy* LandscapeProxy = GetLandscapeProxyAt(WorldPos);
+    if (const FLandscapeHeightfieldPtr Heightfield = FindLandscapeHeightfield(LandscapeProxy))
     {
-        LandscapeHeightCaches.Add(Landscape, MakeShared<TMap<FIntPoint, float>>());
+        const TOptional<float> Cached = Heightfield->Sample(WorldPos);
+        if (Cached.IsSet())
+        {
+            INC_DWORD_STAT(STAT_DiggerLandscapeSamples);
+            return Cached.GetValue();
+        }
     }
 
-    return LandscapeHeightCaches[Landscape];
+    return GetLandscapeHeightAt(WorldPos);
 }
 
 
 float ADiggerManager::GetLandscapeHeightAt(FVector WorldPosition)
 {
+    DIGGER_SCOPE_CYCLE_COUNTER(STAT_DiggerSampleLandscapeHeight);
+    INC_DWORD_STAT(STAT_DiggerLandscapeSamples);
+
     ALandscapeProxy* LandscapeProxy = nullptr;
 
     // First, try the last used landscape if it's still valid
@@ -2635,19 +4737,16 @@ float ADiggerManager::GetLandscapeHeightAt(FVector WorldPosition)
         return -100000.0f;
     }
 
-    // Try getting height using different sources in order of complexity
+    // Dense heightfield first, only hit the landscape collision when it can't answer (not built yet / dirty region)
     TOptional<float> HeightResult;
-
-    HeightResult = LandscapeProxy->GetHeightAtLocation(WorldPosition, EHeightfieldSource::Simple);
-
-    if (!HeightResult.IsSet())
+    if (const FLandscapeHeightfieldPtr Heightfield = FindLandscapeHeightfield(LandscapeProxy))
     {
-        HeightResult = LandscapeProxy->GetHeightAtLocation(WorldPosition, EHeightfieldSource::Complex);
+        HeightResult = Heightfield->Sample(WorldPosition);
     }
 
-    if (!HeightResult.IsSet() && GIsEditor)
+    if (!HeightResult.IsSet())
     {
-        HeightResult = LandscapeProxy->GetHeightAtLocation(WorldPosition, EHeightfieldSource::Editor);
+        HeightResult = SampleLandscapeHeightDirect(LandscapeProxy, WorldPosition);
     }
 
     if (!HeightResult.IsSet())
@@ -2661,105 +4760,427 @@ float ADiggerManager::GetLandscapeHeightAt(FVector WorldPosition)
     return HeightResult.GetValue();
 }
 
-// Keep your more reliable GetLandscapeProxyAt function
+// Grid lookup instead of walking every proxy in the world (hundreds of them on World Partition maps)
 ALandscapeProxy* ADiggerManager::GetLandscapeProxyAt(const FVector& WorldPos)
 {
+    // Rebuilding iterates the world, so only the game thread does it. Worker threads use the last build.
+    if (bLandscapeProxyIndexDirty && IsInGameThread())
+    {
+        RebuildLandscapeProxyIndex();
+    }
+
+    FRWScopeLock ReadLock(LandscapeProxyIndexLock, SLT_ReadOnly);
+    return LandscapeProxyIndex.Find(WorldPos);
+}
+
+void ADiggerManager::RebuildLandscapeProxyIndex()
+{
+    check(IsInGameThread());
+
+    RegisterLandscapeProxyIndexHandlers();
+
+    TArray<ALandscapeProxy*> Proxies;
     for (TActorIterator<ALandscapeProxy> It(GetSafeWorld()); It; ++It)
     {
         ALandscapeProxy* Proxy = *It;
-        if (Proxy && IsValid(Proxy) && Proxy->GetComponentsBoundingBox().IsInsideXY(WorldPos))
+        if (Proxy && IsValid(Proxy))
         {
-            return Proxy;
+            Proxies.Add(Proxy);
         }
     }
 
-    return nullptr;
+    {
+        FRWScopeLock WriteLock(LandscapeProxyIndexLock, SLT_Write);
+        LandscapeProxyIndex.Build(Proxies);
+    }
+    bLandscapeProxyIndexDirty = false;
+
+    if (DiggerDebug::Landscape)
+    {
+        UE_LOG(LogTemp, Log, TEXT("Rebuilt landscape proxy index with %d proxies"), LandscapeProxyIndex.Num());
+    }
 }
 
-void ADiggerManager::PopulateLandscapeHeightCache(ALandscapeProxy* Landscape)
+void ADiggerManager::RegisterLandscapeProxyIndexHandlers()
 {
-    if (!Landscape) return;
+    UWorld* SafeWorld = GetSafeWorld();
+    if (!SafeWorld || ProxyIndexWorld.Get() == SafeWorld)
+    {
+        return;
+    }
+
+    UnregisterLandscapeProxyIndexHandlers();
+
+    ProxyIndexWorld = SafeWorld;
+    ActorSpawnedHandle = SafeWorld->AddOnActorSpawnedHandler(FOnActorSpawned::FDelegate::CreateUObject(this, &ADiggerManager::OnWorldActorSpawned));
+    ActorDestroyedHandle = SafeWorld->AddOnActorDestroyedHandler(FOnActorDestroyed::FDelegate::CreateUObject(this, &ADiggerManager::OnWorldActorDestroyed));
+    // Level streaming / World Partition cells bring their proxies in and out through these
+    LevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddUObject(this, &ADiggerManager::OnLevelAddedOrRemoved);
+    LevelRemovedHandle = FWorldDelegates::LevelRemovedFromWorld.AddUObject(this, &ADiggerManager::OnLevelAddedOrRemoved);
+}
+
+void ADiggerManager::UnregisterLandscapeProxyIndexHandlers()
+{
+    if (UWorld* OldWorld = ProxyIndexWorld.Get())
+    {
+        OldWorld->RemoveOnActorSpawnedHandler(ActorSpawnedHandle);
+        OldWorld->RemoveOnActorDestroyededHandler(ActorDestroyedHandle);
+    }
+    ActorSpawnedHandle.Reset();
+    ActorDestroyedHandle.Reset();
+
+    FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedHandle);
+    FWorldDelegates::LevelRemovedFromWorld.Remove(LevelRemovedHandle);
+    LevelAddedHandle.Reset();
+    LevelRemovedHandle.Reset();
+
+    ProxyIndexWorld.Reset();
+}
+
+void ADiggerManager::OnWorldActorSpawned(AActor* Actor)
+{
+    if (Actor && Actor->IsA<ALandscapeProxy>())
+    {
+        bLandscapeProxyIndexDirty = true;
+    }
+}
+
+void ADiggerManager::OnWorldActorDestroyed(AActor* Actor)
+{
+    if (Actor && Actor->IsA<ALandscapeProxy>())
+    {
+        bLandscapeProxyIndexDirty = true;
+    }
+}
+
+void ADiggerManager::OnLevelAddedOrRemoved(ULevel* Level, UWorld* InWorld)
+{
+    if (InWorld == ProxyIndexWorld.Get())
+    {
+        bLandscapeProxyIndexDirty = true;
+    }
+}
+
+// Anything bigger gets a coarser spacing rather than eating hundreds of MB (16M samples = 64MB)
+static constexpr int64 MaxLandscapeHeightfieldSamples = 16 * 1024 * 1024;
+
+TOptional<float> ADiggerManager::SampleLandscapeHeightDirect(const ALandscapeProxy* Landscape, const FVector& WorldPos)
+{
+    DIGGER_SCOPE_CYCLE_COUNTER(STAT_DiggerSampleLandscapeHeightPrecise);
+
+    if (!Landscape)
+    {
+        return TOptional<float>();
+    }
+    INC_DWORD_STAT(STAT_DiggerPreciseLandscapeSamples);
+
+    TOptional<float> HeightResult = Landscape->GetHeightAtLocation(WorldPos, EHeightfieldSource::Complex);
+
+    if (!HeightResult.IsSet())
+    {
+        HeightResult = Landscape->GetHeightAtLocation(WorldPos, EHeightfieldSource::Simple);
+    }
+
+#if WITH_EDITOR
+    if (!HeightResult.IsSet() && GIsEditor)
+    {
+        HeightResult = Landscape->GetHeightAtLocation(WorldPos, EHeightfieldSource::Editor);
+    }
+#endif
+
+    return HeightResult;
+}
+
+FLandscapeHeightfieldPtr ADiggerManager::BuildLandscapeHeightfield(const ALandscapeProxy* Landscape, float DesiredSpacing)
+{
+    if (!Landscape)
+    {
+        return nullptr;
+    }
 
-    const float LocalVoxelSize = VoxelSize;
-    FBox Bounds = Landscape->GetComponentsBoundingBox();
+    const FBox Bounds = Landscape->GetComponentsBoundingBox();
+    if (!Bounds.IsValid)
+    {
+        return nullptr;
+    }
 
-    TMap<FIntPoint, float> LocalMap;
+    float Spacing = FMath::Max(DesiredSpacing, 1.0f);
+    int32 SizeX = FMath::FloorToInt((Bounds.Max.X - Bounds.Min.X) / Spacing) + 1;
+    int32 SizeY = FMath::FloorToInt((Bounds.Max.Y - Bounds.Min.Y) / Spacing) + 1;
+    while ((int64)SizeX * SizeY > MaxLandscapeHeightfieldSamples)
+    {
+        Spacing *= 2.0f;
+        SizeX = FMath::FloorToInt((Bounds.Max.X - Bounds.Min.X) / Spacing) + 1;
+        SizeY = FMath::FloorToInt((Bounds.Max.Y - Bounds.Min.Y) / Spacing) + 1;
+    }
 
-    FVector Min = Bounds.Min;
-    FVector Max = Bounds.Max;
+    FLandscapeHeightfieldPtr Heightfield = MakeShared<FLandscapeHeightfield, ESPMode::ThreadSafe>();
+    Heightfield->Init(FVector2D(Bounds.Min.X, Bounds.Min.Y), Spacing, SizeX, SizeY);
 
-    for (float X = Min.X; X < Max.X; X += LocalVoxelSize)
+    // Rows are independent, fill them in parallel straight into the row-major array
+    FLandscapeHeightfield& Field = *Heightfield;
+    ParallelFor(SizeY, [&Field, Landscape, SizeX](int32 Y)
     {
-        for (float Y = Min.Y; Y < Max.Y; Y += LocalVoxelSize)
+        float* Row = &Field.Heights[Y * SizeX];
+        for (int32 X = 0; X < SizeX; ++X)
         {
-            FVector SamplePos(X, Y, 0);
-            TOptional<float> Sampled = SampleLandscapeHeight(Landscape, SamplePos);
+            const FVector2D SampleXY = Field.GetSampleLocation(X, Y);
+            const TOptional<float> Sampled = SampleLandscapeHeightDirect(Landscape, FVector(SampleXY.X, SampleXY.Y, 0.0f));
             if (Sampled.IsSet())
             {
-                int32 GridX = FMath::FloorToInt(X / LocalVoxelSize);
-                int32 GridY = FMath::FloorToInt(Y / LocalVoxelSize);
-                FIntPoint Key(GridX, GridY);
-                LocalMap.Add(Key, Sampled.GetValue());
+                Row[X] = Sampled.GetValue();
             }
         }
+    });
+
+    return Heightfield;
+}
+
+void ADiggerManager::InstallLandscapeHeightfield(ALandscapeProxy* Landscape, FLandscapeHeightfieldPtr Heightfield)
+{
+    {
+        FRWScopeLock WriteLock(LandscapeHeightCachesLock, SLT_Write);
+        if (Heightfield.IsValid() && Heightfield->IsValid())
+        {
+            LandscapeHeightCaches.FindOrAdd(Landscape) = Heightfield;
+        }
+        else
+        {
+            LandscapeHeightCaches.Remove(Landscape);
+        }
     }
 
-    LandscapeHeightCaches.FindOrAdd(Landscape) = MakeShared<TMap<FIntPoint, float>>(LocalMap);
+    // A fresh build already covers whatever was waiting for a resample
+    PendingHeightRegions.Remove(Landscape);
     HeightCacheLoadingSet.Remove(Landscape);
+    InvalidateChunkHeightCaches(Landscape->GetComponentsBoundingBox(), false);
+}
+
+void ADiggerManager::PopulateLandscapeHeightCache(ALandscapeProxy* Landscape)
+{
+    if (!Landscape) return;
 
-    UE_LOG(LogTemp, Warning, TEXT("Synchronous height cache complete for landscape: %s (%d entries)"), *Landscape->GetName(), LocalMap.Num());
+    FLandscapeHeightfieldPtr Heightfield = BuildLandscapeHeightfield(Landscape, Landscape->GetActorScale3D().X);
+    InstallLandscapeHeightfield(Landscape, Heightfield);
+
+    if (DiggerDebug::Landscape && Heightfield.IsValid())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Synchronous heightfield complete for landscape: %s (%dx%d @ %.1f, %.1f KB)"),
+            *Landscape->GetName(), Heightfield->SizeX, Heightfield->SizeY, Heightfield->Spacing, Heightfield->GetAllocatedSize() / 1024.0f);
+    }
 }
 
 void ADiggerManager::PopulateLandscapeHeightCacheAsync(ALandscapeProxy* Landscape)
 {
     if (!Landscape) return;
 
-    const float LocalVoxelSize = VoxelSize;
-    FBox Bounds = Landscape->GetComponentsBoundingBox();
-
-    // Prepare data for async task
-    FVector Min = Bounds.Min;
-    FVector Max = Bounds.Max;
+    const float Spacing = Landscape->GetActorScale3D().X;
     TWeakObjectPtr<ALandscapeProxy> WeakLandscape = Landscape;
     TWeakObjectPtr<ADiggerManager> WeakSelf = this;
 
-    AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [WeakSelf, WeakLandscape, Min, Max, LocalVoxelSize]()
+    AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [WeakSelf, WeakLandscape, Spacing]()
     {
         if (!WeakSelf.IsValid() || !WeakLandscape.IsValid()) return;
 
-        TMap<FIntPoint, float> LocalMap;
+        FLandscapeHeightfieldPtr Heightfield = BuildLandscapeHeightfield(WeakLandscape.Get(), Spacing);
+
+        // Hand over on game thread
+        AsyncTask(ENamedThreads::GameThread, [WeakSelf, WeakLandscape, Heightfield]()
+        {
+            if (!WeakSelf.IsValid() || !WeakLandscape.IsValid()) return;
+
+            WeakSelf->InstallLandscapeHeightfield(WeakLandscape.Get(), Heightfield);
+
+            if (DiggerDebug::Landscape && Heightfield.IsValid())
+            {
+                UE_LOG(LogTemp, Warning, TEXT("Async heightfield complete for landscape: %s (%dx%d @ %.1f, %.1f KB)"),
+                    *WeakLandscape->GetName(), Heightfield->SizeX, Heightfield->SizeY, Heightfield->Spacing, Heightfield->GetAllocatedSize() / 1024.0f);
+            }
+        });
+    });
+}
+
+static bool HeightRectsOverlap(const FIntRect& A, const FIntRect& B)
+{
+    // Inclusive rects
+    return A.Min.X <= B.Max.X && B.Min.X <= A.Max.X && A.Min.Y <= B.Max.Y && B.Min.Y <= A.Max.Y;
+}
+
+void ADiggerManager::InvalidateLandscapeHeightRegion(const FBox& WorldBox)
+{
+    bool bAnyDirty = false;
+    {
+        FRWScopeLock ReadLock(LandscapeHeightCachesLock, SLT_ReadOnly);
+        for (const auto& Pair : LandscapeHeightCaches)
+        {
+            FIntRect SampleRect;
+            if (Pair.Key && Pair.Value.IsValid() && Pair.Value->MarkRegionDirty(WorldBox, SampleRect))
+            {
+                PendingHeightRegions.FindOrAdd(Pair.Key).AddUnique(SampleRect);
+                bAnyDirty = true;
+            }
+        }
+    }
+
+    if (!bAnyDirty)
+    {
+        return;
+    }
+
+    // Chunk height caches sampled before the edit are stale too, until the resample lands they fall back to precise queries
+    InvalidateChunkHeightCaches(WorldBox, false);
+
+    if (DiggerDebug::Landscape)
+    {
+        UE_LOG(LogTemp, Log, TEXT("Invalidated landscape heightfield region %s"), *WorldBox.ToString());
+    }
+
+    // Debounce, sculpting fires this constantly and the collision data lags behind the edit anyway
+    if (UWorld* SafeWorld = GetSafeWorld())
+    {
+        SafeWorld->GetTimerManager().SetTimer(HeightRegionRebuildTimerHandle, this, &ADiggerManager::RebuildDirtyLandscapeHeightRegions, 0.5f, false);
+    }
+}
+
+void ADiggerManager::RebuildDirtyLandscapeHeightRegions()
+{
+    TMap<TWeakObjectPtr<ALandscapeProxy>, TArray<FIntRect>> Regions = MoveTemp(PendingHeightRegions);
+    PendingHeightRegions.Reset();
+
+    TWeakObjectPtr<ADiggerManager> WeakSelf = this;
+
+    for (auto& Pair : Regions)
+    {
+        TWeakObjectPtr<ALandscapeProxy> WeakLandscape = Pair.Key;
+        FLandscapeHeightfieldPtr Heightfield = FindLandscapeHeightfield(WeakLandscape.Get());
+        if (!Heightfield.IsValid())
+        {
+            continue;
+        }
+
+        AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [WeakSelf, WeakLandscape, Heightfield, Rects = MoveTemp(Pair.Value)]()
+        {
+            if (!WeakSelf.IsValid() || !WeakLandscape.IsValid()) return;
+
+            TArray<TArray<float>> RectHeights;
+            RectHeights.SetNum(Rects.Num());
+            for (int32 i = 0; i < Rects.Num(); ++i)
+            {
+                const FIntRect& Rect = Rects[i];
+                TArray<float>& Out = RectHeights[i];
+                Out.Init(NAN, (Rect.Max.X - Rect.Min.X + 1) * (Rect.Max.Y - Rect.Min.Y + 1));
+
+                int32 Index = 0;
+                for (int32 Y = Rect.Min.Y; Y <= Rect.Max.Y; ++Y)
+                {
+                    for (int32 X = Rect.Min.X; X <= Rect.Max.X; ++X, ++Index)
+                    {
+                        const FVector2D SampleXY = Heightfield->GetSampleLocation(X, Y);
+                        const TOptional<float> Sampled = SampleLandscapeHeightDirect(WeakLandscape.Get(), FVector(SampleXY.X, SampleXY.Y, 0.0f));
+                        if (Sampled.IsSet())
+                        {
+                            Out[Index] = Sampled.GetValue();
+                        }
+                    }
+                }
+            }
+
+            AsyncTask(ENamedThreads::GameThread, [WeakSelf, WeakLandscape, Heightfield, Rects, RectHeights = MoveTemp(RectHeights)]()
+            {
+                if (!WeakSelf.IsValid() || !WeakLandscape.IsValid()) return;
+
+                TArray<FIntRect>* StillPending = WeakSelf->PendingHeightRegions.Find(WeakLandscape);
+                FBox WrittenBox(ForceInit);
+                for (int32 i = 0; i < Rects.Num(); ++i)
+                {
+                    // Edited again while we were sampling, leave it dirty and let the next pass redo it
+                    if (StillPending && StillPending->ContainsByPredicate([&](const FIntRect& Pending) { return HeightRectsOverlap(Pending, Rects[i]); }))
+                    {
+                        StillPending->AddUnique(Rects[i]);
+                        continue;
+                    }
+                    Heightfield->WriteRegion(Rects[i], RectHeights[i]);
+
+                    const FVector2D Min = Heightfield->GetSampleLocation(Rects[i].Min.X, Rects[i].Min.Y);
+                    const FVector2D Max = Heightfield->GetSampleLocation(Rects[i].Max.X, Rects[i].Max.Y);
+                    WrittenBox += FBox(FVector(Min.X, Min.Y, -UE_BIG_NUMBER), FVector(Max.X, Max.Y, UE_BIG_NUMBER));
+                }
+
+                // The chunks over the new heights remesh against them
+                if (WrittenBox.IsValid)
+                {
+                    WeakSelf->InvalidateChunkHeightCaches(WrittenBox, true);
+                }
+            });
+        });
+    }
+}
+
+void ADiggerManager::InvalidateChunkHeightCaches(const FBox& WorldBox, bool bRemesh)
+{
+    const float VoxelSize = FVoxelConversion::LocalVoxelSize;
+    const int32 VoxelsPerChunk = FVoxelConversion::ChunkSize * FVoxelConversion::Subdivisions;
 
-        for (float X = Min.X; X < Max.X; X += LocalVoxelSize)
+    int32 NumInvalidated = 0;
+    int32 NumRequeued = 0;
+    for (const auto& Pair : ChunkMap)
+    {
+        UVoxelChunk* Chunk = Pair.Value;
+        UMarchingCubes* Generator = Chunk ? Chunk->GetMarchingCubesGenerator() : nullptr;
+        if (!Generator)
         {
-            for (float Y = Min.Y; Y < Max.Y; Y += LocalVoxelSize)
-            {
-                FVector SamplePos(X, Y, 0);
-                TOptional<float> Sampled = WeakSelf->SampleLandscapeHeight(WeakLandscape.Get(), SamplePos);
-                if (Sampled.IsSet())
-                {
-                    int32 GridX = FMath::FloorToInt(X / LocalVoxelSize);
-                    int32 GridY = FMath::FloorToInt(Y / LocalVoxelSize);
-                    FIntPoint Key(GridX, GridY);
-                    LocalMap.Add(Key, Sampled.GetValue());
-                }
-            }
+            continue;
         }
 
-        // Copy back on game thread
-        AsyncTask(ENamedThreads::GameThread, [WeakSelf, WeakLandscape, LocalMap = MoveTemp(LocalMap)]()
+        // The exact XY range the chunk's cache samples, the other chunks keep theirs
+        const FBox CacheBounds = FChunkHeightCache::GetSampledBounds(FVoxelConversion::ChunkToWorld(Pair.Key), VoxelSize, VoxelsPerChunk);
+        if (!CacheBounds.IntersectXY(WorldBox))
         {
-            if (!WeakSelf.IsValid() || !WeakLandscape.IsValid()) return;
+            continue;
+        }
 
-            WeakSelf->LandscapeHeightCaches.FindOrAdd(WeakLandscape.Get()) = MakeShared<TMap<FIntPoint, float>>(LocalMap);
-            WeakSelf->HeightCacheLoadingSet.Remove(WeakLandscape.Get());
+        // In flight jobs hold their own copy, their results are dropped on upload once this no longer matches
+        Generator->ClearHeightCache();
+        ++NumInvalidated;
 
-            UE_LOG(LogTemp, Warning, TEXT("Async height cache complete for landscape: %s (%d entries)"), *WeakLandscape->GetName(), LocalMap.Num());
-        });
-    });
+        if (bRemesh && Chunk->GetSparseVoxelGrid() && !Chunk->GetSparseVoxelGrid()->VoxelData.IsEmpty())
+        {
+            Chunk->RequestRemesh();
+            ++NumRequeued;
+        }
+    }
+
+    if (DiggerDebug::Landscape && NumInvalidated > 0)
+    {
+        UE_LOG(LogTemp, Log, TEXT("Landscape heights changed under %s, dropped %d chunk height caches, remeshing %d chunks"),
+            *WorldBox.ToString(), NumInvalidated, NumRequeued);
+    }
 }
 
+#if WITH_EDITOR
+void ADiggerManager::OnLandscapeObjectModified(UObject* Object)
+{
+    // Proxy moved / resized in the editor
+    if (Object && Object->IsA<ALandscapeProxy>())
+    {
+        bLandscapeProxyIndexDirty = true;
+        return;
+    }
+
+    if (!Object || !(Object->IsA<ULandscapeComponent>() || Object->IsA<ULandscapeHeightfieldCollisionComponent>()))
+    {
+        return;
+    }
 
+    const UPrimitiveComponent* Component = CastChecked<UPrimitiveComponent>(Object);
+    if (Component->GetWorld() != GetWorld())
+    {
+        return;
+    }
 
+    InvalidateLandscapeHeightRegion(Component->Bounds.GetBox());
+}
+#endif
 
 
 /*ALandscapeProxy* ADiggerManager::GetLandscapeProxyAt(const FVector& WorldPos)
@@ -2778,6 +5199,9 @@ void ADiggerManager::PopulateLandscapeHeightCacheAsync(ALandscapeProxy* Landscap
 
 TOptional<float> ADiggerManager::SampleLandscapeHeight(ALandscapeProxy* Landscape, const FVector& WorldPos, bool bForcePrecise)
 {
+    DIGGER_SCOPE_CYCLE_COUNTER(STAT_DiggerSampleLandscapeHeight);
+    INC_DWORD_STAT(STAT_DiggerLandscapeSamples);
+
     if (!Landscape)
     {
         if (DiggerDebug::Landscape)
@@ -2785,8 +5209,20 @@ TOptional<float> ADiggerManager::SampleLandscapeHeight(ALandscapeProxy* Landscap
         return TOptional<float>(); // Early exit if there's no valid landscape
     }
 
-    // Sample terrain height using Landscape's method
-    TOptional<float> SampledHeight = Landscape->GetHeightAtLocation(WorldPos);
+    // Heightfield unless the caller wants the real collision answer
+    TOptional<float> SampledHeight;
+    if (!bForcePrecise)
+    {
+        if (const FLandscapeHeightfieldPtr Heightfield = FindLandscapeHeightfield(Landscape))
+        {
+            SampledHeight = Heightfield->Sample(WorldPos);
+        }
+    }
+
+    if (!SampledHeight.IsSet())
+    {
+        SampledHeight = SampleLandscapeHeightDirect(Landscape, WorldPos);
+    }
 
     if (SampledHeight.IsSet())
     {
@@ -2871,9 +5307,12 @@ TOptional<float> ADiggerManager::SampleLandscapeHeight(ALandscapeProxy* Landscap
     return TOptional<float>();
 }
 */
-// Currently used precise Height Sampling Method
+// Currently used Height Sampling Method, dense heightfield with a direct fallback
 TOptional<float> ADiggerManager::SampleLandscapeHeight(ALandscapeProxy* Landscape, const FVector& WorldPos)
 {
+    DIGGER_SCOPE_CYCLE_COUNTER(STAT_DiggerSampleLandscapeHeight);
+    INC_DWORD_STAT(STAT_DiggerLandscapeSamples);
+
     // Null check for Landscape
     if (!Landscape || !IsValid(Landscape))
     {
@@ -2881,8 +5320,17 @@ TOptional<float> ADiggerManager::SampleLandscapeHeight(ALandscapeProxy* Landscap
         return TOptional<float>();
     }
 
-    // Always use direct sampling - bypass cache completely
-    TOptional<float> SampledHeight = Landscape->GetHeightAtLocation(WorldPos);
+    if (const FLandscapeHeightfieldPtr Heightfield = FindLandscapeHeightfield(Landscape))
+    {
+        const TOptional<float> Cached = Heightfield->Sample(WorldPos);
+        if (Cached.IsSet())
+        {
+            return Cached;
+        }
+    }
+
+    // Not cached yet / dirty region / hole: go to the landscape directly
+    TOptional<float> SampledHeight = SampleLandscapeHeightDirect(Landscape, WorldPos);
     
     if (SampledHeight.IsSet())
     {
@@ -2928,10 +5376,17 @@ float ADiggerManager::GetSmartLandscapeHeightAt(const FVector& WorldPos, bool bF
 
    // float CachedHeight = GetCachedLandscapeHeightAt(WorldPos);
 
-   // if (bForcePrecise)
-    //{
-        return GetLandscapeHeightAt(WorldPos);
-   /* }
+    if (bForcePrecise)
+    {
+        INC_DWORD_STAT(STAT_DiggerLandscapeSamples);
+        ALandscapeProxy* LandscapeProxy = GetLandscapeProxyAt(WorldPos);
+        const TOptional<float> Precise = SampleLandscapeHeightDirect(LandscapeProxy, WorldPos);
+        return Precise.IsSet() ? Precise.GetValue() : -100000.0f;
+    }
+
+    // GetLandscapeHeightAt goes through the dense heightfield
+    return GetLandscapeHeightAt(WorldPos);
+   /*
 
     // Compare Z difference (height) only, not full vector
     float VerticalDifference = FMath::Abs(WorldPos.Z - CachedHeight);
@@ -2979,20 +5434,12 @@ bool ADiggerManager::GetHeightAtLocation(ALandscapeProxy* LandscapeProxy, const
 
 FVector ADiggerManager::GetLandscapeNormalAt(const FVector& WorldPosition)
 {
-    // Get all landscape actors in the level
-    TArray<AActor*> FoundLandscapes;
-    UGameplayStatics::GetAllActorsOfClass(GetSafeWorld(), ALandscapeProxy::StaticClass(), FoundLandscapes);
-
-    if (FoundLandscapes.Num() == 0)
-    {
-        UE_LOG(LogTemp, Warning, TEXT("No landscape found in level"));
-        return FVector::UpVector;
-    }
-
-    ALandscapeProxy* LandscapeProxy = Cast<ALandscapeProxy>(FoundLandscapes[0]);
+    // Proxy under the point from the spatial index
+    ALandscapeProxy* LandscapeProxy = GetLandscapeProxyAt(WorldPosition);
     if (!LandscapeProxy)
     {
-        UE_LOG(LogTemp, Warning, TEXT("Failed to cast landscape actor"));
+        if (DiggerDebug::Landscape)
+        UE_LOG(LogTemp, Warning, TEXT("No landscape found at %s"), *WorldPosition.ToString());
         return FVector::UpVector;
     }
 
@@ -3274,6 +5721,26 @@ int32 ADiggerManager::GetHitSectionIndex(const FHitResult& HitResult)
     UProceduralMeshComponent* HitProceduralMesh = Cast<UProceduralMeshComponent>(HitResult.GetComponent());
     if (!HitProceduralMesh) return -1;
 
+    // Chunk meshes are one component per chunk, the chunk under the hit owns it
+    if (HitProceduralMesh != ProceduralMesh)
+    {
+        const FIntVector HitChunkCoords = FVoxelConversion::WorldToChunk(HitResult.ImpactPoint);
+        UVoxelChunk** HitChunk = ChunkMap.Find(HitChunkCoords);
+        // Traces hit the collision component, the render one has no collision
+        if (HitChunk && *HitChunk && ((*HitChunk)->GetCollisionComponent() == HitProceduralMesh || (*HitChunk)->GetMeshComponent() == HitProceduralMesh))
+        {
+            return (*HitChunk)->GetSectionIndex();
+        }
+        for (const auto& Entry : ChunkMap)
+        {
+            if (Entry.Value && (Entry.Value->GetCollisionComponent() == HitProceduralMesh || Entry.Value->GetMeshComponent() == HitProceduralMesh))
+            {
+                return Entry.Value->GetSectionIndex();
+            }
+        }
+        return -1;
+    }
+
     const FVector HitLocation = HitResult.ImpactPoint;
 
     for (int32 SectionIndex = 0; SectionIndex < HitProceduralMesh->GetNumSections(); ++SectionIndex)
@@ -3468,12 +5935,16 @@ void ADiggerManager::MarkNearbyChunksDirty(const FVector& CenterPosition, float
     }
 }
 
-TArray<FIslandData> ADiggerManager::DetectUnifiedIslands()
+void ADiggerManager::BuildUnifiedIslandMap(FUnifiedIslandMap& OutMap)
 {
-    // Step 1: Build NON-DEDUPLICATED voxel map with ALL physical instances
-    TMap<FIntVector, FVoxelData> UnifiedVoxelData; // This will be deduplicated for island detection
-    TArray<FVoxelInstance> AllPhysicalVoxelInstances; // This preserves ALL instances including overflow
-    
+    OutMap.ChunkIslandToGlobal.Reset();
+    OutMap.NumIslands = 0;
+
+    const int32 N = FVoxelConversion::ChunkSize * FVoxelConversion::Subdivisions;
+
+    TArray<FIntVector> ChunkCoordsList;
+    TArray<USparseVoxelGrid*> Grids;
+    TMap<FIntVector, int32> ChunkIndex;
     for (const auto& Pair : ChunkMap)
     {
         UVoxelChunk* Chunk = Pair.Value;
@@ -3482,97 +5953,293 @@ TArray<FIslandData> ADiggerManager::DetectUnifiedIslands()
         USparseVoxelGrid* Grid = Chunk->GetSparseVoxelGrid();
         if (!Grid || !Grid->IsValidLowLevel()) continue;
 
-        FIntVector ChunkCoords = Chunk->GetChunkCoordinates();
+        ChunkIndex.Add(Chunk->GetChunkCoordinates(), Grids.Num());
+        ChunkCoordsList.Add(Chunk->GetChunkCoordinates());
+        Grids.Add(Grid);
+    }
+
+    // Step 1: Per-chunk labels. Incremental per grid and every grid has its own lock, so chunks go wide.
+    ParallelFor(Grids.Num(), [&Grids](int32 Index)
+    {
+        TArray<int32> NewIslands;
+        Grids[Index]->UpdateIslandLabels(NewIslands);
+    });
+
+    // Step 2: One union-find node per chunk-local island
+    TArray<int32> NodeOffset;
+    NodeOffset.SetNumUninitialized(Grids.Num());
+    TArray<TMap<int32, int32>> LocalToNode;
+    LocalToNode.SetNum(Grids.Num());
+    int32 NumNodes = 0;
+    for (int32 i = 0; i < Grids.Num(); ++i)
+    {
+        NodeOffset[i] = NumNodes;
+        for (const TPair<int32, int32>& Island : Grids[i]->GetIslandLabels().GetIslandSizes())
+        {
+            LocalToNode[i].Add(Island.Key, NumNodes++);
+        }
+    }
+
+    // Step 3: Stitch across chunk borders. Only voxels within reach of another chunk's storage range
+    // (overflow included) can touch it, so each chunk walks its border layers, not its whole volume.
+    // Read only from here on, chunks in parallel again, node pairs merged afterwards.
+    TArray<TArray<TPair<int32, int32>>> ChunkLinks;
+    ChunkLinks.SetNum(Grids.Num());
+    ParallelFor(Grids.Num(), [&](int32 Index)
+    {
+        const FVoxelIslandLabels& Labels = Grids[Index]->GetIslandLabels();
+        const FIntVector ChunkCoords = ChunkCoordsList[Index];
+        TSet<uint64> Seen;
+        TArray<FIntVector, TInlineAllocator<8>> Candidates;
 
-        for (const auto& VoxelPair : Grid->GetAllVoxels())
+        auto IsBorder = [N](int32 C) { return C <= 1 || C >= N - 3; };
+        auto VisitVoxel = [&](const FIntVector& Local)
         {
-            const FIntVector& LocalIndex = VoxelPair.Key;
-            const FVoxelData& Data = VoxelPair.Value;
+            const int32 Label = Labels.GetLabel(Local);
+            if (Label == INDEX_NONE)
+            {
+                return;
+            }
+            const int32 Node = LocalToNode[Index].FindChecked(Label);
+            const FIntVector Global = FVoxelConversion::ChunkAndLocalToGlobalVoxel_CenterAligned(ChunkCoords, Local);
 
-            FIntVector GlobalIndex = FVoxelConversion::ChunkAndLocalToGlobalVoxel_CenterAligned(ChunkCoords, LocalIndex);
-            
-            // Store for deduplicated island detection
-            UnifiedVoxelData.Add(GlobalIndex, Data);
-            
-            // Store ALL physical instances (including overflow duplicates)
-            FVoxelInstance Instance(GlobalIndex, ChunkCoords, LocalIndex);
-            AllPhysicalVoxelInstances.Add(Instance);
-            
-            // Special logging for negative overflow voxels
-            if (LocalIndex.X == -1 || LocalIndex.Y == -1 || LocalIndex.Z == -1)
+            for (int32 DX = -1; DX <= 1; ++DX)
+            for (int32 DY = -1; DY <= 1; ++DY)
+            for (int32 DZ = -1; DZ <= 1; ++DZ)
             {
-                if (DiggerDebug::Islands)
-                UE_LOG(LogTemp, Warning, 
-                    TEXT("[DiggerPro] NEGATIVE OVERFLOW DETECTED: Global %s -> Chunk %s -> Local %s"),
-                    *GlobalIndex.ToString(), *ChunkCoords.ToString(), *LocalIndex.ToString());
+                const FIntVector Neighbour = Global + FIntVector(DX, DY, DZ);
+                FVoxelConversion::GetStorageChunkCandidates(Neighbour, Candidates);
+                for (const FIntVector& Other : Candidates)
+                {
+                    const int32* OtherIndex = Other != ChunkCoords ? ChunkIndex.Find(Other) : nullptr;
+                    if (!OtherIndex)
+                    {
+                        continue;
+                    }
+                    const FIntVector OtherLocal = Neighbour - Other * N;
+                    const int32 OtherLabel = Grids[*OtherIndex]->GetIslandLabels().GetLabel(OtherLocal);
+                    if (OtherLabel == INDEX_NONE)
+                    {
+                        continue;
+                    }
+                    const int32 OtherNode = LocalToNode[*OtherIndex].FindChecked(OtherLabel);
+                    bool bAlreadySeen = false;
+                    Seen.Add(((uint64)(uint32)Node << 32) | (uint32)OtherNode, &bAlreadySeen);
+                    if (!bAlreadySeen)
+                    {
+                        ChunkLinks[Index].Emplace(Node, OtherNode);
+                    }
+                }
+            }
+        };
+
+        TArray<int32> BorderZ;
+        for (int32 Z = -2; Z <= N; ++Z)
+        {
+            if (IsBorder(Z))
+            {
+                BorderZ.Add(Z);
+            }
+        }
+
+        for (int32 X = -2; X <= N; ++X)
+        for (int32 Y = -2; Y <= N; ++Y)
+        {
+            if (IsBorder(X) || IsBorder(Y))
+            {
+                for (int32 Z = -2; Z <= N; ++Z)
+                {
+                    VisitVoxel(FIntVector(X, Y, Z));
+                }
+            }
+            else
+            {
+                for (const int32 Z : BorderZ)
+                {
+                    VisitVoxel(FIntVector(X, Y, Z));
+                }
+            }
+        }
+    });
+
+    // Step 4: Union-find merge, cost follows the number of border links rather than the voxel count
+    TArray<int32> Parent;
+    Parent.SetNumUninitialized(NumNodes);
+    for (int32 i = 0; i < NumNodes; ++i)
+    {
+        Parent[i] = i;
+    }
+    auto Find = [&Parent](int32 Node)
+    {
+        while (Parent[Node] != Node)
+        {
+            Parent[Node] = Parent[Parent[Node]];
+            Node = Parent[Node];
+        }
+        return Node;
+    };
+    for (const TArray<TPair<int32, int32>>& Links : ChunkLinks)
+    {
+        for (const TPair<int32, int32>& Link : Links)
+        {
+            const int32 A = Find(Link.Key);
+            const int32 B = Find(Link.Value);
+            if (A != B)
+            {
+                Parent[FMath::Max(A, B)] = FMath::Min(A, B);
             }
         }
     }
 
+    TMap<int32, int32> RootToIsland;
+    for (int32 i = 0; i < Grids.Num(); ++i)
+    {
+        TMap<int32, int32>& ChunkIslands = OutMap.ChunkIslandToGlobal.Add(ChunkCoordsList[i]);
+        for (const TPair<int32, int32>& Pair : LocalToNode[i])
+        {
+            const int32 Root = Find(Pair.Value);
+            int32* Island = RootToIsland.Find(Root);
+            if (!Island)
+            {
+                Island = &RootToIsland.Add(Root, OutMap.NumIslands++);
+            }
+            ChunkIslands.Add(Pair.Key, *Island);
+        }
+    }
+
     if (DiggerDebug::Islands)
     {
-        UE_LOG(LogTemp, Warning, TEXT("[DiggerPro] Total physical voxel instances collected: %d"), AllPhysicalVoxelInstances.Num());
-        UE_LOG(LogTemp, Warning, TEXT("[DiggerPro] Deduplicated voxels for island detection: %d"), UnifiedVoxelData.Num());
+        int32 NumLinks = 0;
+        for (const TArray<TPair<int32, int32>>& Links : ChunkLinks)
+        {
+            NumLinks += Links.Num();
+        }
+        UE_LOG(LogTemp, Warning, TEXT("[DiggerPro] Unified islands: %d chunk islands over %d chunks, %d border links -> %d islands"),
+            NumNodes, Grids.Num(), NumLinks, OutMap.NumIslands);
     }
-    
-    // Step 2: Create temporary sparse voxel grid for island detection (using deduplicated data)
-    USparseVoxelGrid* TempGrid = NewObject<USparseVoxelGrid>();
-    TempGrid->SetVoxelData(UnifiedVoxelData);
+}
 
-    // Step 3: Detect islands globally (this gives us deduplicated island boundaries)
-    TArray<FIslandData> DeduplicatedIslands = TempGrid->DetectIslands(0.0f);
+TArray<FIslandData> ADiggerManager::DetectUnifiedIslands()
+{
+    DIGGER_SCOPE_CYCLE_COUNTER(STAT_DiggerDetectIslands);
 
-    // Step 4: For each deduplicated island, collect ALL physical instances that belong to it
-    TArray<FIslandData> FinalIslands;
-    
-    for (const FIslandData& DeduplicatedIsland : DeduplicatedIslands)
+    // Step 1: Per-chunk labels joined across chunk borders
+    FUnifiedIslandMap IslandMap;
+    BuildUnifiedIslandMap(IslandMap);
+
+    const int32 N = FVoxelConversion::ChunkSize * FVoxelConversion::Subdivisions;
+
+    TArray<UVoxelChunk*> Chunks;
+    for (const auto& Pair : ChunkMap)
     {
-        FIslandData EnhancedIsland;
-        
-        // Copy the deduplicated island info for UI reporting
-        EnhancedIsland.Location = DeduplicatedIsland.Location;
-        EnhancedIsland.VoxelCount = DeduplicatedIsland.VoxelCount; // This is the deduplicated count for UI
-        EnhancedIsland.Voxels = DeduplicatedIsland.Voxels; // Deduplicated global voxels for UI
-        EnhancedIsland.ReferenceVoxel = DeduplicatedIsland.ReferenceVoxel;
-        
-        // Now find ALL physical instances that belong to this island
-        TSet<FIntVector> IslandGlobalVoxels(DeduplicatedIsland.Voxels);
-        
-        for (const FVoxelInstance& Instance : AllPhysicalVoxelInstances)
+        if (Pair.Value && Pair.Value->IsValidLowLevel() && IslandMap.ChunkIslandToGlobal.Contains(Pair.Value->GetChunkCoordinates()))
+        {
+            Chunks.Add(Pair.Value);
+        }
+    }
+
+    // Step 2: Collect voxels per island, chunks in parallel. Every physical instance (overflow duplicates
+    // included) goes to VoxelInstances for removal; Voxels gets each global voxel once, from the first chunk
+    // in GetStorageChunkCandidates order that has it solid.
+    struct FChunkIslandVoxels
+    {
+        TArray<FIntVector> Voxels;
+        TArray<FVoxelInstance> Instances;
+        FVector CenterSum = FVector::ZeroVector;
+    };
+    TArray<TMap<int32, FChunkIslandVoxels>> PerChunk;
+    PerChunk.SetNum(Chunks.Num());
+
+    ParallelFor(Chunks.Num(), [&](int32 Index)
+    {
+        const FIntVector ChunkCoords = Chunks[Index]->GetChunkCoordinates();
+        const USparseVoxelGrid* Grid = Chunks[Index]->GetSparseVoxelGrid();
+        TArray<FIntVector, TInlineAllocator<8>> Candidates;
+
+        Grid->GetIslandLabels().ForEachLabel([&](const FIntVector& Local, int32 Label)
         {
-            // If this physical instance belongs to the current island, include it
-            if (IslandGlobalVoxels.Contains(Instance.GlobalVoxel))
+            const int32 Island = IslandMap.Find(ChunkCoords, Label);
+            if (Island == INDEX_NONE)
             {
-                EnhancedIsland.VoxelInstances.Add(Instance);
-                
-                // Special logging for negative overflow voxels being added to islands
-                if (Instance.LocalVoxel.X == -1 || Instance.LocalVoxel.Y == -1 || Instance.LocalVoxel.Z == -1)
+                return;
+            }
+
+            const FIntVector Global = FVoxelConversion::ChunkAndLocalToGlobalVoxel_CenterAligned(ChunkCoords, Local);
+            FChunkIslandVoxels& Out = PerChunk[Index].FindOrAdd(Island);
+            Out.Instances.Emplace(Global, ChunkCoords, Local);
+
+            bool bClaimedElsewhere = false;
+            if (Local.X < 0 || Local.X >= N || Local.Y < 0 || Local.Y >= N || Local.Z < 0 || Local.Z >= N)
+            {
+                FVoxelConversion::GetStorageChunkCandidates(Global, Candidates);
+                for (const FIntVector& Other : Candidates)
                 {
-                    if (DiggerDebug::Islands)
-                    UE_LOG(LogTemp, Warning, 
-                        TEXT("[DiggerPro] NEGATIVE OVERFLOW ADDED TO ISLAND: Global %s -> Chunk %s -> Local %s"),
-                        *Instance.GlobalVoxel.ToString(), *Instance.ChunkCoords.ToString(), *Instance.LocalVoxel.ToString());
+                    if (Other == ChunkCoords)
+                    {
+                        break;
+                    }
+                    const UVoxelChunk* OtherChunk = ChunkMap.FindRef(Other);
+                    const USparseVoxelGrid* OtherGrid = OtherChunk ? OtherChunk->GetSparseVoxelGrid() : nullptr;
+                    if (OtherGrid && OtherGrid->GetIslandLabels().GetLabel(Global - Other * N) != INDEX_NONE)
+                    {
+                        bClaimedElsewhere = true;
+                        break;
+                    }
                 }
             }
-            else if (Instance.LocalVoxel.X == -1 || Instance.LocalVoxel.Y == -1 || Instance.LocalVoxel.Z == -1)
+
+            if (!bClaimedElsewhere)
             {
-                // Log negative overflow voxels that DON'T belong to any island
-                if (DiggerDebug::Islands)
-                UE_LOG(LogTemp, Error, 
-                    TEXT("[DiggerPro] ORPHANED NEGATIVE OVERFLOW: Global %s -> Chunk %s -> Local %s (not in any island)"),
-                    *Instance.GlobalVoxel.ToString(), *Instance.ChunkCoords.ToString(), *Instance.LocalVoxel.ToString());
+                Out.Voxels.Add(Global);
+                Out.CenterSum += FVoxelConversion::GlobalVoxelToWorld_CenterAligned(Global);
+            }
+
+            if (DiggerDebug::Islands && (Local.X == -1 || Local.Y == -1 || Local.Z == -1))
+            {
+                UE_LOG(LogTemp, Warning,
+                    TEXT("[DiggerPro] NEGATIVE OVERFLOW ADDED TO ISLAND: Global %s -> Chunk %s -> Local %s"),
+                    *Global.ToString(), *ChunkCoords.ToString(), *Local.ToString());
             }
+        });
+    });
+
+    // Step 3: Merge the per-chunk pieces
+    TArray<FIslandData> FinalIslands;
+    FinalIslands.SetNum(IslandMap.NumIslands);
+    TArray<FVector> CenterSums;
+    CenterSums.Init(FVector::ZeroVector, IslandMap.NumIslands);
+    for (TMap<int32, FChunkIslandVoxels>& ChunkIslands : PerChunk)
+    {
+        for (TPair<int32, FChunkIslandVoxels>& Pair : ChunkIslands)
+        {
+            FIslandData& Island = FinalIslands[Pair.Key];
+            Island.Voxels.Append(MoveTemp(Pair.Value.Voxels));
+            Island.VoxelInstances.Append(MoveTemp(Pair.Value.Instances));
+            CenterSums[Pair.Key] += Pair.Value.CenterSum;
         }
-        
-        FinalIslands.Add(EnhancedIsland);
+    }
+
+    // Same placement DetectIslands used on the old temporary grid (its default DebugRenderOffset)
+    const FVector RenderOffset(-FVoxelConversion::ChunkWorldSize * 0.5f);
+    for (int32 i = FinalIslands.Num() - 1; i >= 0; --i)
+    {
+        FIslandData& Island = FinalIslands[i];
+        if (Island.Voxels.Num() == 0)
+        {
+            FinalIslands.RemoveAtSwap(i);
+            continue;
+        }
+        Island.VoxelCount = Island.Voxels.Num();
+        Island.ReferenceVoxel = Island.Voxels[0];
+        Island.Location = CenterSums[i] / Island.VoxelCount + RenderOffset;
 
         if (DiggerDebug::Islands)
         UE_LOG(LogTemp, Warning, 
             TEXT("[DiggerPro] Island complete: %d unique voxels (UI) -> %d total physical instances (removal)"),
-            EnhancedIsland.VoxelCount, EnhancedIsland.VoxelInstances.Num());
+            Island.VoxelCount, Island.VoxelInstances.Num());
     }
 
-    // Step 5: Broadcast ONLY the deduplicated islands to UI (clean reporting)
+    // Step 4: Broadcast ONLY the deduplicated islands to UI (clean reporting)
     OnIslandsDetectionStarted.Broadcast();
 
     for (const FIslandData& Island : FinalIslands)
@@ -3590,7 +6257,7 @@ TArray<FIslandData> ADiggerManager::DetectUnifiedIslands()
             *BroadcastIsland.Location.ToString(), BroadcastIsland.VoxelCount);
     }
 
-    // Step 6: Return enhanced islands with ALL physical instances for removal
+    // Step 5: Return enhanced islands with ALL physical instances for removal
     return FinalIslands;
 }
 
@@ -3618,6 +6285,14 @@ UVoxelChunk* ADiggerManager::GetOrCreateChunkAtChunk(const FIntVector& ChunkCoor
         NewChunk->InitializeDiggerManager(this);
         ChunkMap.Add(ChunkCoords, NewChunk);
 
+        // Streamed out earlier (or on its way back in): its saved data has to be in before anything writes to it
+        const bool bStreamedOut = StreamedOutChunks.Remove(ChunkCoords) > 0;
+        const bool bStreamingIn = StreamingInFlight.Remove(ChunkCoords) > 0;
+        if (bStreamedOut || bStreamingIn)
+        {
+            RestoreStreamedOutChunk(NewChunk);
+        }
+
         if (DiggerDebug::Chunks)
         UE_LOG(LogTemp, Log, TEXT("Created a new chunk at position: %s"), *ChunkCoords.ToString());
         return NewChunk;
@@ -3759,73 +6434,56 @@ void ADiggerManager::RemoveUnifiedIslandVoxels(const FIslandData& Island)
         TotalRemoved, ChunksToUpdate.Num());
 }
 
-// New helper method to perform flood fill across chunk boundaries
+// Every global voxel of the island containing StartGlobalVoxel, read off the unified island labels
 TSet<FIntVector> ADiggerManager::PerformCrossChunkFloodFill(const FIntVector& StartGlobalVoxel)
 {
     TSet<FIntVector> VisitedVoxels;
-    TQueue<FIntVector> VoxelsToCheck;
-    
-    // Start the flood fill
-    VoxelsToCheck.Enqueue(StartGlobalVoxel);
-    
-    while (!VoxelsToCheck.IsEmpty())
+
+    FUnifiedIslandMap IslandMap;
+    BuildUnifiedIslandMap(IslandMap);
+
+    const int32 N = FVoxelConversion::ChunkSize * FVoxelConversion::Subdivisions;
+
+    // Island of the start voxel, from whichever chunk stores it solid
+    int32 TargetIsland = INDEX_NONE;
+    for (const FIntVector& ChunkCoords : GetAllPhysicalStorageChunks(StartGlobalVoxel))
     {
-        FIntVector CurrentGlobal;
-        VoxelsToCheck.Dequeue(CurrentGlobal);
-        
-        if (VisitedVoxels.Contains(CurrentGlobal))
-            continue;
-            
-        // Check if this global voxel is solid in any storage chunk
-        bool bFoundSolidVoxel = false;
-        TArray<FIntVector> StorageChunkCoords = GetAllPhysicalStorageChunks(CurrentGlobal);
-        
-        for (const FIntVector& ChunkCoord : StorageChunkCoords)
+        const UVoxelChunk* Chunk = ChunkMap.FindRef(ChunkCoords);
+        const int32 Label = Chunk->GetSparseVoxelGrid()->GetIslandLabels().GetLabel(StartGlobalVoxel - ChunkCoords * N);
+        TargetIsland = IslandMap.Find(ChunkCoords, Label);
+        if (TargetIsland != INDEX_NONE)
         {
-            UVoxelChunk* Chunk = ChunkMap.FindRef(ChunkCoord);
-            if (!Chunk || !Chunk->IsValidLowLevel()) continue;
-            
-            USparseVoxelGrid* Grid = Chunk->GetSparseVoxelGrid();
-            if (!Grid || !Grid->IsValidLowLevel()) continue;
-            
-            // Convert global to local coordinates for this candidate chunk
-            FIntVector LocalVoxel, OutChunkCoord;
-            FVoxelConversion::GlobalVoxelToChunkAndLocal_CenterAligned(
-                CurrentGlobal,
-                OutChunkCoord,
-                LocalVoxel
-            );
-            
-            if (Grid->HasVoxelAt(LocalVoxel) && Grid->IsVoxelSolid(LocalVoxel))
-            {
-                bFoundSolidVoxel = true;
-                break;
-            }
+            break;
         }
-        
-        if (!bFoundSolidVoxel)
-            continue;
-            
-        // Mark as visited and add neighbors
-        VisitedVoxels.Add(CurrentGlobal);
-        
-        // Check all 6 neighboring voxels
-        static const FIntVector Neighbors[6] = {
-            FIntVector(1, 0, 0), FIntVector(-1, 0, 0),
-            FIntVector(0, 1, 0), FIntVector(0, -1, 0),
-            FIntVector(0, 0, 1), FIntVector(0, 0, -1)
-        };
-        
-        for (const FIntVector& Offset : Neighbors)
+    }
+    if (TargetIsland == INDEX_NONE)
+    {
+        return VisitedVoxels;
+    }
+
+    for (const TPair<FIntVector, TMap<int32, int32>>& ChunkIslands : IslandMap.ChunkIslandToGlobal)
+    {
+        const UVoxelChunk* Chunk = ChunkMap.FindRef(ChunkIslands.Key);
+        if (!Chunk || !Chunk->GetSparseVoxelGrid()) continue;
+
+        // Skip chunks holding no part of the island without touching their voxels
+        bool bHasIsland = false;
+        for (const TPair<int32, int32>& Pair : ChunkIslands.Value)
+        {
+            bHasIsland |= Pair.Value == TargetIsland;
+        }
+        if (!bHasIsland) continue;
+
+        Chunk->GetSparseVoxelGrid()->GetIslandLabels().ForEachLabel([&](const FIntVector& Local, int32 Label)
         {
-            FIntVector NeighborGlobal = CurrentGlobal + Offset;
-            if (!VisitedVoxels.Contains(NeighborGlobal))
+            const int32* Island = ChunkIslands.Value.Find(Label);
+            if (Island && *Island == TargetIsland)
             {
-                VoxelsToCheck.Enqueue(NeighborGlobal);
+                VisitedVoxels.Add(FVoxelConversion::ChunkAndLocalToGlobalVoxel_CenterAligned(ChunkIslands.Key, Local));
             }
-        }
+        });
     }
-    
+
     return VisitedVoxels;
 }
 
@@ -3834,64 +6492,38 @@ TSet<FIntVector> ADiggerManager::PerformCrossChunkFloodFill(const FIntVector& St
 TArray<FIntVector> ADiggerManager::GetAllPhysicalStorageChunks(const FIntVector& GlobalVoxel)
 {
     TArray<FIntVector> StorageChunks;
-    
-    // Start with the canonical owning chunk
-    FIntVector CanonicalChunk, LocalVoxelOut;
-    FVoxelConversion::GlobalVoxelToChunkAndLocal_CenterAligned(GlobalVoxel, CanonicalChunk, LocalVoxelOut);
-    
-    // Check all 27 possible chunks (canonical + 26 neighbors) to see which ones actually store this voxel
-    for (int32 dx = -1; dx <= 1; dx++)
+    const int32 N = FVoxelConversion::ChunkSize * FVoxelConversion::Subdivisions;
+
+    // Only chunks whose overflow range reaches this voxel can store it (at most 8, usually 1)
+    TArray<FIntVector, TInlineAllocator<8>> Candidates;
+    FVoxelConversion::GetStorageChunkCandidates(GlobalVoxel, Candidates);
+
+    for (const FIntVector& CandidateChunk : Candidates)
     {
-        for (int32 dy = -1; dy <= 1; dy++)
+        UVoxelChunk* Chunk = ChunkMap.FindRef(CandidateChunk);
+        if (!Chunk || !Chunk->IsValidLowLevel()) continue;
+
+        USparseVoxelGrid* Grid = Chunk->GetSparseVoxelGrid();
+        if (!Grid || !Grid->IsValidLowLevel()) continue;
+
+        const FIntVector LocalVoxel = GlobalVoxel - CandidateChunk * N;
+        if (Grid->HasVoxelAt(LocalVoxel))
         {
-            for (int32 dz = -1; dz <= 1; dz++)
-            {
-                FIntVector CandidateChunk = CanonicalChunk + FIntVector(dx, dy, dz);
-                
-                // Check if this chunk exists and actually contains the voxel
-                UVoxelChunk* Chunk = ChunkMap.FindRef(CandidateChunk);
-                if (!Chunk || !Chunk->IsValidLowLevel()) continue;
-                
-                USparseVoxelGrid* Grid = Chunk->GetSparseVoxelGrid();
-                if (!Grid || !Grid->IsValidLowLevel()) continue;
-                
-                // Convert global to local coordinates for this candidate chunk
-                FIntVector LocalVoxel;
-                FVoxelConversion::GlobalVoxelToChunkAndLocal_CenterAligned(
-                    GlobalVoxel,
-                    CandidateChunk,
-                    LocalVoxel
-                );
-                
-                // If this chunk actually has the voxel, add it to storage list
-                if (Grid->HasVoxelAt(LocalVoxel))
-                {
-                    StorageChunks.AddUnique(CandidateChunk);
+            StorageChunks.Add(CandidateChunk);
 
-                    if (DiggerDebug::Chunks || DiggerDebug::Voxels)
-                    UE_LOG(LogTemp, Warning, 
-                        TEXT("[DiggerPro] Global voxel %s found in chunk %s at local %s"),
-                        *GlobalVoxel.ToString(), *CandidateChunk.ToString(), *LocalVoxel.ToString());
-                }
-                else
-                {
-                    if (DiggerDebug::Chunks || DiggerDebug::Voxels)
-                    // Debug: Log when we don't find expected voxels
-                    UE_LOG(LogTemp, VeryVerbose, 
-                        TEXT("[DiggerPro] Global voxel %s NOT found in chunk %s (would be local %s)"),
-                        *GlobalVoxel.ToString(), *CandidateChunk.ToString(), *LocalVoxel.ToString());
-                }
-            }
+            if (DiggerDebug::Chunks || DiggerDebug::Voxels)
+            UE_LOG(LogTemp, Warning, 
+                TEXT("[DiggerPro] Global voxel %s found in chunk %s at local %s"),
+                *GlobalVoxel.ToString(), *CandidateChunk.ToString(), *LocalVoxel.ToString());
         }
     }
-    
-    // If we didn't find the voxel anywhere, this is a problem!
+
     if (StorageChunks.Num() == 0)
     {
         if (DiggerDebug::Chunks || DiggerDebug::Voxels)
         UE_LOG(LogTemp, Error, 
             TEXT("[DiggerPro] CRITICAL: Global voxel %s was not found in any chunk! Canonical chunk: %s"),
-            *GlobalVoxel.ToString(), *CanonicalChunk.ToString());
+            *GlobalVoxel.ToString(), *Candidates[0].ToString());
     }
     
     return StorageChunks;
@@ -4114,9 +6746,27 @@ void ADiggerManager::RefreshSavedChunkCache()
 bool ADiggerManager::DeleteChunkFile(const FIntVector& ChunkCoords)
 {
     FString FilePath = GetChunkFilePath(ChunkCoords);
+
+    // Drop it from the region pack too; the region file goes away with its last chunk
+    bool bRemovedFromRegion = false;
+    const FString RegionPath = GetRegionFilePath(ChunkCoords, TEXT("Default"));
+    TArray<FVoxelRegionFile::FEntry> Entries;
+    if (FVoxelRegionFile::ReadTable(RegionPath, Entries)
+        && Entries.ContainsByPredicate([&ChunkCoords](const FVoxelRegionFile::FEntry& Entry) { return Entry.ChunkCoords == ChunkCoords; }))
+    {
+        TSet<FIntVector> RemoveChunks;
+        RemoveChunks.Add(ChunkCoords);
+        bRemovedFromRegion = FVoxelRegionFile::WriteChunks(RegionPath, TMap<FIntVector, TArray<uint8>>(), RemoveChunks);
+        InvalidateSavedChunkCache(TEXT("Default"));
+    }
     
     if (!FPaths::FileExists(FilePath))
     {
+        if (bRemovedFromRegion)
+        {
+            return true;
+        }
+
         if (DiggerDebug::IO)
         {
             UE_LOG(LogTemp, Warning, TEXT("Cannot delete chunk file - file does not exist: %s"), *FilePath);
@@ -0,0 +1,22 @@
+#include "DiggerStats.h"
+
+UE_TRACE_CHANNEL_DEFINE(DiggerChannel);
+
+DEFINE_STAT(STAT_DiggerApplyBrushStrokes);
+DEFINE_STAT(STAT_DiggerBuildMeshingSlab);
+DEFINE_STAT(STAT_DiggerGenerateMesh);
+DEFINE_STAT(STAT_DiggerUploadMesh);
+DEFINE_STAT(STAT_DiggerDetectIslands);
+DEFINE_STAT(STAT_DiggerSampleLandscapeHeight);
+DEFINE_STAT(STAT_DiggerSampleLandscapeHeightPrecise);
+DEFINE_STAT(STAT_DiggerSaveChunks);
+DEFINE_STAT(STAT_DiggerLoadChunks);
+DEFINE_STAT(STAT_DiggerDecodeChunks);
+DEFINE_STAT(STAT_DiggerRegionFileIO);
+
+DEFINE_STAT(STAT_DiggerVoxelsWritten);
+DEFINE_STAT(STAT_DiggerChunksRemeshed);
+DEFINE_STAT(STAT_DiggerTrianglesEmitted);
+DEFINE_STAT(STAT_DiggerLandscapeSamples);
+DEFINE_STAT(STAT_DiggerPreciseLandscapeSamples);
+DEFINE_STAT(STAT_DiggerBytesSerialized);
@@ -0,0 +1,49 @@
+// DiggerStrokeNetComponent.cpp
+
+#include "DiggerStrokeNetComponent.h"
+#include "DiggerDebug.h"
+#include "DiggerManager.h"
+#include "EngineUtils.h"
+#include "FBrushStrokeCodec.h"
+#include "GameFramework/PlayerController.h"
+
+UDiggerStrokeNetComponent::UDiggerStrokeNetComponent()
+{
+	PrimaryComponentTick.bCanEverTick = false;
+	SetIsReplicatedByDefault(true);
+}
+
+UDiggerStrokeNetComponent* UDiggerStrokeNetComponent::FindLocal(const UWorld* World)
+{
+	APlayerController* Controller = World ? World->GetFirstPlayerController() : nullptr;
+	return Controller ? Controller->FindComponentByClass<UDiggerStrokeNetComponent>() : nullptr;
+}
+
+bool UDiggerStrokeNetComponent::ServerSendBrushStrokeBatch_Validate(const TArray<uint8>& Payload)
+{
+	// Anything a well behaved client can't produce drops the connection
+	return Payload.Num() > 0 && Payload.Num() <= MaxPayloadBytes && Payload[0] == FBrushStrokeCodec::Version;
+}
+
+void UDiggerStrokeNetComponent::ServerSendBrushStrokeBatch_Implementation(const TArray<uint8>& Payload)
+{
+	// Decode once here too, so a batch that would fail on every machine isn't sent to all of them
+	TArray<FBrushStroke> Strokes;
+	if (!FBrushStrokeCodec::Decode(Payload, Strokes))
+	{
+		if (DiggerDebug::Error)
+		{
+			UE_LOG(LogTemp, Error, TEXT("Server dropped a client brush stroke batch that doesn't decode (%d bytes)"), Payload.Num());
+		}
+		return;
+	}
+
+	for (TActorIterator<ADiggerManager> It(GetWorld()); It; ++It)
+	{
+		if (It->HasAuthority())
+		{
+			It->MulticastApplyBrushStrokeBatch(Payload);
+			return;
+		}
+	}
+}
@@ -1,7 +1,12 @@
 #include "MarchingCubes.h"
 #include "DiggerManager.h"
+#include "DiggerStats.h"
 #include "VoxelChunk.h"
 #include "SparseVoxelGrid.h"
+#include "Voxel/MarchingCubesEdgeCache.h"
+#include "Voxel/MarchingCubesTables.h"
+#include "Voxel/VoxelDenseSlab.h"
+#include "Voxel/VoxelLODContour.h"
 #include "EngineUtils.h"
 #include "StaticMeshOperations.h"
 #include "UDynamicMesh.h"
@@ -24,313 +29,56 @@ FIntVector UMarchingCubes::GetCornerOffset(int32 Index)
 	return Offsets[Index];
 }
 
-const FVector CornerPositions[8] = {
-	FVector(0.0f, 0.0f, 0.0f), // Vertex 0: (0, 0, 0)
-	FVector(1.0f, 0.0f, 0.0f), // Vertex 1: (1, 0, 0)
-	FVector(1.0f, 1.0f, 0.0f), // Vertex 2: (1, 1, 0)
-	FVector(0.0f, 1.0f, 0.0f), // Vertex 3: (0, 1, 0)
-	FVector(0.0f, 0.0f, 1.0f), // Vertex 4: (0, 0, 1)
-	FVector(1.0f, 0.0f, 1.0f), // Vertex 5: (1, 0, 1)
-	FVector(1.0f, 1.0f, 1.0f), // Vertex 6: (1, 1, 1)
-	FVector(0.0f, 1.0f, 1.0f)  // Vertex 7: (0, 1, 1)
-};
-
-
-
-const int EdgeConnection[12][2] = {
-	{0, 1}, // Edge 0
-	{1, 2}, // Edge 1
-	{2, 3}, // Edge 2
-	{3, 0}, // Edge 3
-	{4, 5}, // Edge 4
-	{5, 6}, // Edge 5
-	{6, 7}, // Edge 6
-	{7, 4}, // Edge 7
-	{0, 4}, // Edge 8
-	{1, 5}, // Edge 9
-	{2, 6}, // Edge 10
-	{3, 7}  // Edge 11
-};
-
-
-const float EdgeDirection[12][3] = {
-	{1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}, {-1.0f, 0.0f, 0.0f}, {0.0f, -1.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}, {-1.0f, 0.0f, 0.0f}, {0.0f, -1.0f, 0.0f}, {0.0f, 0.0f, 1.0f}, {0.0f, 0.0f, 1.0f}, {0.0f, 0.0f, 1.0f}, {0.0f, 0.0f, 1.0f}};
-
-const int CubeEdgeFlags[256] = {
-	0x000, 0x109, 0x203, 0x30a, 0x406, 0x50f, 0x605, 0x70c, 0x80c, 0x905, 0xa0f, 0xb06, 0xc0a, 0xd03, 0xe09, 0xf00,
-	0x190, 0x099, 0x393, 0x29a, 0x596, 0x49f, 0x795, 0x69c, 0x99c, 0x895, 0xb9f, 0xa96, 0xd9a, 0xc93, 0xf99, 0xe90,
-	0x230, 0x339, 0x033, 0x13a, 0x636, 0x73f, 0x435, 0x53c, 0xa3c, 0xb35, 0x83f, 0x936, 0xe3a, 0xf33, 0xc39, 0xd30,
-	0x3a0, 0x2a9, 0x1a3, 0x0aa, 0x7a6, 0x6af, 0x5a5, 0x4ac, 0xbac, 0xaa5, 0x9af, 0x8a6, 0xfaa, 0xea3, 0xda9, 0xca0,
-	0x460, 0x569, 0x663, 0x76a, 0x066, 0x16f, 0x265, 0x36c, 0xc6c, 0xd65, 0xe6f, 0xf66, 0x86a, 0x963, 0xa69, 0xb60,
-	0x5f0, 0x4f9, 0x7f3, 0x6fa, 0x1f6, 0x0ff, 0x3f5, 0x2fc, 0xdfc, 0xcf5, 0xfff, 0xef6, 0x9fa, 0x8f3, 0xbf9, 0xaf0,
-	0x650, 0x759, 0x453, 0x55a, 0x256, 0x35f, 0x055, 0x15c, 0xe5c, 0xf55, 0xc5f, 0xd56, 0xa5a, 0xb53, 0x859, 0x950,
-	0x7c0, 0x6c9, 0x5c3, 0x4ca, 0x3c6, 0x2cf, 0x1c5, 0x0cc, 0xfcc, 0xec5, 0xdcf, 0xcc6, 0xbca, 0xac3, 0x9c9, 0x8c0,
-	0x8c0, 0x9c9, 0xac3, 0xbca, 0xcc6, 0xdcf, 0xec5, 0xfcc, 0x0cc, 0x1c5, 0x2cf, 0x3c6, 0x4ca, 0x5c3, 0x6c9, 0x7c0,
-	0x950, 0x859, 0xb53, 0xa5a, 0xd56, 0xc5f, 0xf55, 0xe5c, 0x15c, 0x055, 0x35f, 0x256, 0x55a, 0x453, 0x759, 0x650,
-	0xaf0, 0xbf9, 0x8f3, 0x9fa, 0xef6, 0xfff, 0xcf5, 0xdfc, 0x2fc, 0x3f5, 0x0ff, 0x1f6, 0x6fa, 0x7f3, 0x4f9, 0x5f0,
-	0xb60, 0xa69, 0x963, 0x86a, 0xf66, 0xe6f, 0xd65, 0xc6c, 0x36c, 0x265, 0x16f, 0x066, 0x76a, 0x663, 0x569, 0x460,
-	0xca0, 0xda9, 0xea3, 0xfaa, 0x8a6, 0x9af, 0xaa5, 0xbac, 0x4ac, 0x5a5, 0x6af, 0x7a6, 0x0aa, 0x1a3, 0x2a9, 0x3a0,
-	0xd30, 0xc39, 0xf33, 0xe3a, 0x936, 0x83f, 0xb35, 0xa3c, 0x53c, 0x435, 0x73f, 0x636, 0x13a, 0x033, 0x339, 0x230,
-	0xe90, 0xf99, 0xc93, 0xd9a, 0xa96, 0xb9f, 0x895, 0x99c, 0x69c, 0x795, 0x49f, 0x596, 0x29a, 0x393, 0x099, 0x190,
-	0xf00, 0xe09, 0xd03, 0xc0a, 0xb06, 0xa0f, 0x905, 0x80c, 0x70c, 0x605, 0x50f, 0x406, 0x30a, 0x203, 0x109, 0x000};
-
-const int TriangleConnectionTable[256][16] = {
-	{-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
-	{0, 8, 3, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
-	{0, 1, 9, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
-	{1, 8, 3, 9, 8, 1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
-	{1, 2, 10, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
-	{0, 8, 3, 1, 2, 10, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
-	{9, 2, 10, 0, 2, 9, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
-	{2, 8, 3, 2, 10, 8, 10, 9, 8, -1, -1, -1, -1, -1, -1, -1},
-	{3, 11, 2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
-	{0, 11, 2, 8, 11, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
-	{1, 9, 0, 2, 3, 11, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
-	{1, 11, 2, 1, 9, 11, 9, 8, 11, -1, -1, -1, -1, -1, -1, -1},
-	{3, 10, 1, 11, 10, 3, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
-	{0, 10, 1, 0, 8, 10, 8, 11, 10, -1, -1, -1, -1, -1, -1, -1},
-	{3, 9, 0, 3, 11, 9, 11, 10, 9, -1, -1, -1, -1, -1, -1, -1},
-	{9, 8, 10, 10, 8, 11, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
-	{4, 7, 8, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
-	{4, 3, 0, 7, 3, 4, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
-	{0, 1, 9, 8, 4, 7, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
-	{4, 1, 9, 4, 7, 1, 7, 3, 1, -1, -1, -1, -1, -1, -1, -1},
-	{1, 2, 10, 8, 4, 7, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
-	{3, 4, 7, 3, 0, 4, 1, 2, 10, -1, -1, -1, -1, -1, -1, -1},
-	{9, 2, 10, 9, 0, 2, 8, 4, 7, -1, -1, -1, -1, -1, -1, -1},
-	{2, 10, 9, 2, 9, 7, 2, 7, 3, 7, 9, 4, -1, -1, -1, -1},
-	{8, 4, 7, 3, 11, 2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
-	{11, 4, 7, 11, 2, 4, 2, 0, 4, -1, -1, -1, -1, -1, -1, -1},
-	{9, 0, 1, 8, 4, 7, 2, 3, 11, -1, -1, -1, -1, -1, -1, -1},
-	{4, 7, 11, 9, 4, 11, 9, 11, 2, 9, 2, 1, -1, -1, -1, -1},
-	{3, 10, 1, 3, 11, 10, 7, 8, 4, -1, -1, -1, -1, -1, -1, -1},
-	{1, 11, 10, 1, 4, 11, 1, 0, 4, 7, 11, 4, -1, -1, -1, -1},
-	{4, 7, 8, 9, 0, 11, 9, 11, 10, 11, 0, 3, -1, -1, -1, -1},
-	{4, 7, 11, 4, 11, 9, 9, 11, 10, -1, -1, -1, -1, -1, -1, -1},
-	{9, 5, 4, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
-	{9, 5, 4, 0, 8, 3, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
-	{0, 5, 4, 1, 5, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
-	{8, 5, 4, 8, 3, 5, 3, 1, 5, -1, -1, -1, -1, -1, -1, -1},
-	{1, 2, 10, 9, 5, 4, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
-	{3, 0, 8, 1, 2, 10, 4, 9, 5, -1, -1, -1, -1, -1, -1, -1},
-	{5, 2, 10, 5, 4, 2, 4, 0, 2, -1, -1, -1, -1, -1, -1, -1},
-	{2, 10, 5, 3, 2, 5, 3, 5, 4, 3, 4, 8, -1, -1, -1, -1},
-	{9, 5, 4, 2, 3, 11, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
-	{0, 11, 2, 0, 8, 11, 4, 9, 5, -1, -1, -1, -1, -1, -1, -1},
-	{0, 5, 4, 0, 1, 5, 2, 3, 11, -1, -1, -1, -1, -1, -1, -1},
-	{2, 1, 5, 2, 5, 8, 2, 8, 11, 4, 8, 5, -1, -1, -1, -1},
-	{10, 3, 11, 10, 1, 3, 9, 5, 4, -1, -1, -1, -1, -1, -1, -1},
-	{4, 9, 5, 0, 8, 1, 8, 10, 1, 8, 11, 10, -1, -1, -1, -1},
-	{5, 4, 0, 5, 0, 11, 5, 11, 10, 11, 0, 3, -1, -1, -1, -1},
-	{5, 4, 8, 5, 8, 10, 10, 8, 11, -1, -1, -1, -1, -1, -1, -1},
-	{9, 7, 8, 5, 7, 9, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
-	{9, 3, 0, 9, 5, 3, 5, 7, 3, -1, -1, -1, -1, -1, -1, -1},
-	{0, 7, 8, 0, 1, 7, 1, 5, 7, -1, -1, -1, -1, -1, -1, -1},
-	{1, 5, 3, 3, 5, 7, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
-	{9, 7, 8, 9, 5, 7, 10, 1, 2, -1, -1, -1, -1, -1, -1, -1},
-	{10, 1, 2, 9, 5, 0, 5, 3, 0, 5, 7, 3, -1, -1, -1, -1},
-	{8, 0, 2, 8, 2, 5, 8, 5, 7, 10, 5, 2, -1, -1, -1, -1},
-	{2, 10, 5, 2, 5, 3, 3, 5, 7, -1, -1, -1, -1, -1, -1, -1},
-	{7, 9, 5, 7, 8, 9, 3, 11, 2, -1, -1, -1, -1, -1, -1, -1},
-	{9, 5, 7, 9, 7, 2, 9, 2, 0, 2, 7, 11, -1, -1, -1, -1},
-	{2, 3, 11, 0, 1, 8, 1, 7, 8, 1, 5, 7, -1, -1, -1, -1},
-	{11, 2, 1, 11, 1, 7, 7, 1, 5, -1, -1, -1, -1, -1, -1, -1},
-	{9, 5, 8, 8, 5, 7, 10, 1, 3, 10, 3, 11, -1, -1, -1, -1},
-	{5, 7, 0, 5, 0, 9, 7, 11, 0, 1, 0, 10, 11, 10, 0, -1},
-	{11, 10, 0, 11, 0, 3, 10, 5, 0, 8, 0, 7, 5, 7, 0, -1},
-	{11, 10, 5, 7, 11, 5, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
-	{10, 6, 5, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
-	{0, 8, 3, 5, 10, 6, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
-	{9, 0, 1, 5, 10, 6, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
-	{1, 8, 3, 1, 9, 8, 5, 10, 6, -1, -1, -1, -1, -1, -1, -1},
-	{1, 6, 5, 2, 6, 1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
-	{1, 6, 5, 1, 2, 6, 3, 0, 8, -1, -1, -1, -1, -1, -1, -1},
-	{9, 6, 5, 9, 0, 6, 0, 2, 6, -1, -1, -1, -1, -1, -1, -1},
-	{5, 9, 8, 5, 8, 2, 5, 2, 6, 3, 2, 8, -1, -1, -1, -1},
-	{2, 3, 11, 10, 6, 5, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
-	{11, 0, 8, 11, 2, 0, 10, 6, 5, -1, -1, -1, -1, -1, -1, -1},
-	{0, 1, 9, 2, 3, 11, 5, 10, 6, -1, -1, -1, -1, -1, -1, -1},
-	{5, 10, 6, 1, 9, 2, 9, 11, 2, 9, 8, 11, -1, -1, -1, -1},
-	{6, 3, 11, 6, 5, 3, 5, 1, 3, -1, -1, -1, -1, -1, -1, -1},
-	{0, 8, 11, 0, 11, 5, 0, 5, 1, 5, 11, 6, -1, -1, -1, -1},
-	{3, 11, 6, 0, 3, 6, 0, 6, 5, 0, 5, 9, -1, -1, -1, -1},
-	{6, 5, 9, 6, 9, 11, 11, 9, 8, -1, -1, -1, -1, -1, -1, -1},
-	{5, 10, 6, 4, 7, 8, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
-	{4, 3, 0, 4, 7, 3, 6, 5, 10, -1, -1, -1, -1, -1, -1, -1},
-	{1, 9, 0, 5, 10, 6, 8, 4, 7, -1, -1, -1, -1, -1, -1, -1},
-	{10, 6, 5, 1, 9, 7, 1, 7, 3, 7, 9, 4, -1, -1, -1, -1},
-	{6, 1, 2, 6, 5, 1, 4, 7, 8, -1, -1, -1, -1, -1, -1, -1},
-	{1, 2, 5, 5, 2, 6, 3, 0, 4, 3, 4, 7, -1, -1, -1, -1},
-	{8, 4, 7, 9, 0, 5, 0, 6, 5, 0, 2, 6, -1, -1, -1, -1},
-	{7, 3, 9, 7, 9, 4, 3, 2, 9, 5, 9, 6, 2, 6, 9, -1},
-	{3, 11, 2, 7, 8, 4, 10, 6, 5, -1, -1, -1, -1, -1, -1, -1},
-	{5, 10, 6, 4, 7, 2, 4, 2, 0, 2, 7, 11, -1, -1, -1, -1},
-	{0, 1, 9, 4, 7, 8, 2, 3, 11, 5, 10, 6, -1, -1, -1, -1},
-	{9, 2, 1, 9, 11, 2, 9, 4, 11, 7, 11, 4, 5, 10, 6, -1},
-	{8, 4, 7, 3, 11, 5, 3, 5, 1, 5, 11, 6, -1, -1, -1, -1},
-	{5, 1, 11, 5, 11, 6, 1, 0, 11, 7, 11, 4, 0, 4, 11, -1},
-	{0, 5, 9, 0, 6, 5, 0, 3, 6, 11, 6, 3, 8, 4, 7, -1},
-	{6, 5, 9, 6, 9, 11, 4, 7, 9, 7, 11, 9, -1, -1, -1, -1},
-	{10, 4, 9, 6, 4, 10, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
-	{4, 10, 6, 4, 9, 10, 0, 8, 3, -1, -1, -1, -1, -1, -1, -1},
-	{10, 0, 1, 10, 6, 0, 6, 4, 0, -1, -1, -1, -1, -1, -1, -1},
-	{8, 3, 1, 8, 1, 6, 8, 6, 4, 6, 1, 10, -1, -1, -1, -1},
-	{1, 4, 9, 1, 2, 4, 2, 6, 4, -1, -1, -1, -1, -1, -1, -1},
-	{3, 0, 8, 1, 2, 9, 2, 4, 9, 2, 6, 4, -1, -1, -1, -1},
-	{0, 2, 4, 4, 2, 6, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
-	{8, 3, 2, 8, 2, 4, 4, 2, 6, -1, -1, -1, -1, -1, -1, -1},
-	{10, 4, 9, 10, 6, 4, 11, 2, 3, -1, -1, -1, -1, -1, -1, -1},
-	{0, 8, 2, 2, 8, 11, 4, 9, 10, 4, 10, 6, -1, -1, -1, -1},
-	{3, 11, 2, 0, 1, 6, 0, 6, 4, 6, 1, 10, -1, -1, -1, -1},
-	{6, 4, 1, 6, 1, 10, 4, 8, 1, 2, 1, 11, 8, 11, 1, -1},
-	{9, 6, 4, 9, 3, 6, 9, 1, 3, 11, 6, 3, -1, -1, -1, -1},
-	{8, 11, 1, 8, 1, 0, 11, 6, 1, 9, 1, 4, 6, 4, 1, -1},
-	{3, 11, 6, 3, 6, 0, 0, 6, 4, -1, -1, -1, -1, -1, -1, -1},
-	{6, 4, 8, 11, 6, 8, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
-	{7, 10, 6, 7, 8, 10, 8, 9, 10, -1, -1, -1, -1, -1, -1, -1},
-	{0, 7, 3, 0, 10, 7, 0, 9, 10, 6, 7, 10, -1, -1, -1, -1},
-	{10, 6, 7, 1, 10, 7, 1, 7, 8, 1, 8, 0, -1, -1, -1, -1},
-	{10, 6, 7, 10, 7, 1, 1, 7, 3, -1, -1, -1, -1, -1, -1, -1},
-	{1, 2, 6, 1, 6, 8, 1, 8, 9, 8, 6, 7, -1, -1, -1, -1},
-	{2, 6, 9, 2, 9, 1, 6, 7, 9, 0, 9, 3, 7, 3, 9, -1},
-	{7, 8, 0, 7, 0, 6, 6, 0, 2, -1, -1, -1, -1, -1, -1, -1},
-	{7, 3, 2, 6, 7, 2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
-	{2, 3, 11, 10, 6, 8, 10, 8, 9, 8, 6, 7, -1, -1, -1, -1},
-	{2, 0, 7, 2, 7, 11, 0, 9, 7, 6, 7, 10, 9, 10, 7, -1},
-	{1, 8, 0, 1, 7, 8, 1, 10, 7, 6, 7, 10, 2, 3, 11, -1},
-	{11, 2, 1, 11, 1, 7, 10, 6, 1, 6, 7, 1, -1, -1, -1, -1},
-	{8, 9, 6, 8, 6, 7, 9, 1, 6, 11, 6, 3, 1, 3, 6, -1},
-	{0, 9, 1, 11, 6, 7, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
-	{7, 8, 0, 7, 0, 6, 3, 11, 0, 11, 6, 0, -1, -1, -1, -1},
-	{7, 11, 6, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
-	{7, 6, 11, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
-	{3, 0, 8, 11, 7, 6, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
-	{0, 1, 9, 11, 7, 6, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
-	{8, 1, 9, 8, 3, 1, 11, 7, 6, -1, -1, -1, -1, -1, -1, -1},
-	{10, 1, 2, 6, 11, 7, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
-	{1, 2, 10, 3, 0, 8, 6, 11, 7, -1, -1, -1, -1, -1, -1, -1},
-	{2, 9, 0, 2, 10, 9, 6, 11, 7, -1, -1, -1, -1, -1, -1, -1},
-	{6, 11, 7, 2, 10, 3, 10, 8, 3, 10, 9, 8, -1, -1, -1, -1},
-	{7, 2, 3, 6, 2, 7, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
-	{7, 0, 8, 7, 6, 0, 6, 2, 0, -1, -1, -1, -1, -1, -1, -1},
-	{2, 7, 6, 2, 3, 7, 0, 1, 9, -1, -1, -1, -1, -1, -1, -1},
-	{1, 6, 2, 1, 8, 6, 1, 9, 8, 8, 7, 6, -1, -1, -1, -1},
-	{10, 7, 6, 10, 1, 7, 1, 3, 7, -1, -1, -1, -1, -1, -1, -1},
-	{10, 7, 6, 1, 7, 10, 1, 8, 7, 1, 0, 8, -1, -1, -1, -1},
-	{0, 3, 7, 0, 7, 10, 0, 10, 9, 6, 10, 7, -1, -1, -1, -1},
-	{7, 6, 10, 7, 10, 8, 8, 10, 9, -1, -1, -1, -1, -1, -1, -1},
-	{6, 8, 4, 11, 8, 6, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
-	{3, 6, 11, 3, 0, 6, 0, 4, 6, -1, -1, -1, -1, -1, -1, -1},
-	{8, 6, 11, 8, 4, 6, 9, 0, 1, -1, -1, -1, -1, -1, -1, -1},
-	{9, 4, 6, 9, 6, 3, 9, 3, 1, 11, 3, 6, -1, -1, -1, -1},
-	{6, 8, 4, 6, 11, 8, 2, 10, 1, -1, -1, -1, -1, -1, -1, -1},
-	{1, 2, 10, 3, 0, 11, 0, 6, 11, 0, 4, 6, -1, -1, -1, -1},
-	{4, 11, 8, 4, 6, 11, 0, 2, 9, 2, 10, 9, -1, -1, -1, -1},
-	{10, 9, 3, 10, 3, 2, 9, 4, 3, 11, 3, 6, 4, 6, 3, -1},
-	{8, 2, 3, 8, 4, 2, 4, 6, 2, -1, -1, -1, -1, -1, -1, -1},
-	{0, 4, 2, 4, 6, 2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
-	{1, 9, 0, 2, 3, 4, 2, 4, 6, 4, 3, 8, -1, -1, -1, -1},
-	{1, 9, 4, 1, 4, 2, 2, 4, 6, -1, -1, -1, -1, -1, -1, -1},
-	{8, 1, 3, 8, 6, 1, 8, 4, 6, 6, 10, 1, -1, -1, -1, -1},
-	{10, 1, 0, 10, 0, 6, 6, 0, 4, -1, -1, -1, -1, -1, -1, -1},
-	{4, 6, 3, 4, 3, 8, 6, 10, 3, 0, 3, 9, 10, 9, 3, -1},
-	{10, 9, 4, 6, 10, 4, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
-	{4, 9, 5, 7, 6, 11, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
-	{0, 8, 3, 4, 9, 5, 11, 7, 6, -1, -1, -1, -1, -1, -1, -1},
-	{5, 0, 1, 5, 4, 0, 7, 6, 11, -1, -1, -1, -1, -1, -1, -1},
-	{11, 7, 6, 8, 3, 4, 3, 5, 4, 3, 1, 5, -1, -1, -1, -1},
-	{9, 5, 4, 10, 1, 2, 7, 6, 11, -1, -1, -1, -1, -1, -1, -1},
-	{6, 11, 7, 1, 2, 10, 0, 8, 3, 4, 9, 5, -1, -1, -1, -1},
-	{7, 6, 11, 5, 4, 10, 4, 2, 10, 4, 0, 2, -1, -1, -1, -1},
-	{3, 4, 8, 3, 5, 4, 3, 2, 5, 10, 5, 2, 11, 7, 6, -1},
-	{7, 2, 3, 7, 6, 2, 5, 4, 9, -1, -1, -1, -1, -1, -1, -1},
-	{9, 5, 4, 0, 8, 6, 0, 6, 2, 6, 8, 7, -1, -1, -1, -1},
-	{3, 6, 2, 3, 7, 6, 1, 5, 0, 5, 4, 0, -1, -1, -1, -1},
-	{6, 2, 8, 6, 8, 7, 2, 1, 8, 4, 8, 5, 1, 5, 8, -1},
-	{9, 5, 4, 10, 1, 6, 1, 7, 6, 1, 3, 7, -1, -1, -1, -1},
-	{1, 6, 10, 1, 7, 6, 1, 0, 7, 8, 7, 0, 9, 5, 4, -1},
-	{4, 0, 10, 4, 10, 5, 0, 3, 10, 6, 10, 7, 3, 7, 10, -1},
-	{7, 6, 10, 7, 10, 8, 5, 4, 10, 4, 8, 10, -1, -1, -1, -1},
-	{6, 9, 5, 6, 11, 9, 11, 8, 9, -1, -1, -1, -1, -1, -1, -1},
-	{3, 6, 11, 0, 6, 3, 0, 5, 6, 0, 9, 5, -1, -1, -1, -1},
-	{0, 11, 8, 0, 5, 11, 0, 1, 5, 5, 6, 11, -1, -1, -1, -1},
-	{6, 11, 3, 6, 3, 5, 5, 3, 1, -1, -1, -1, -1, -1, -1, -1},
-	{1, 2, 10, 9, 5, 11, 9, 11, 8, 11, 5, 6, -1, -1, -1, -1},
-	{0, 11, 3, 0, 6, 11, 0, 9, 6, 5, 6, 9, 1, 2, 10, -1},
-	{11, 8, 5, 11, 5, 6, 8, 0, 5, 10, 5, 2, 0, 2, 5, -1},
-	{6, 11, 3, 6, 3, 5, 2, 10, 3, 10, 5, 3, -1, -1, -1, -1},
-	{5, 8, 9, 5, 2, 8, 5, 6, 2, 3, 8, 2, -1, -1, -1, -1},
-	{9, 5, 6, 9, 6, 0, 0, 6, 2, -1, -1, -1, -1, -1, -1, -1},
-	{1, 5, 8, 1, 8, 0, 5, 6, 8, 3, 8, 2, 6, 2, 8, -1},
-	{1, 5, 6, 2, 1, 6, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
-	{1, 3, 6, 1, 6, 10, 3, 8, 6, 5, 6, 9, 8, 9, 6, -1},
-	{10, 1, 0, 10, 0, 6, 9, 5, 0, 5, 6, 0, -1, -1, -1, -1},
-	{0, 3, 8, 5, 6, 10, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
-	{10, 5, 6, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
-	{11, 5, 10, 7, 5, 11, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
-	{11, 5, 10, 11, 7, 5, 8, 3, 0, -1, -1, -1, -1, -1, -1, -1},
-	{5, 11, 7, 5, 10, 11, 1, 9, 0, -1, -1, -1, -1, -1, -1, -1},
-	{10, 7, 5, 10, 11, 7, 9, 8, 1, 8, 3, 1, -1, -1, -1, -1},
-	{11, 1, 2, 11, 7, 1, 7, 5, 1, -1, -1, -1, -1, -1, -1, -1},
-	{0, 8, 3, 1, 2, 7, 1, 7, 5, 7, 2, 11, -1, -1, -1, -1},
-	{9, 7, 5, 9, 2, 7, 9, 0, 2, 2, 11, 7, -1, -1, -1, -1},
-	{7, 5, 2, 7, 2, 11, 5, 9, 2, 3, 2, 8, 9, 8, 2, -1},
-	{2, 5, 10, 2, 3, 5, 3, 7, 5, -1, -1, -1, -1, -1, -1, -1},
-	{8, 2, 0, 8, 5, 2, 8, 7, 5, 10, 2, 5, -1, -1, -1, -1},
-	{9, 0, 1, 5, 10, 3, 5, 3, 7, 3, 10, 2, -1, -1, -1, -1},
-	{9, 8, 2, 9, 2, 1, 8, 7, 2, 10, 2, 5, 7, 5, 2, -1},
-	{1, 3, 5, 3, 7, 5, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
-	{0, 8, 7, 0, 7, 1, 1, 7, 5, -1, -1, -1, -1, -1, -1, -1},
-	{9, 0, 3, 9, 3, 5, 5, 3, 7, -1, -1, -1, -1, -1, -1, -1},
-	{9, 8, 7, 5, 9, 7, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
-	{5, 8, 4, 5, 10, 8, 10, 11, 8, -1, -1, -1, -1, -1, -1, -1},
-	{5, 0, 4, 5, 11, 0, 5, 10, 11, 11, 3, 0, -1, -1, -1, -1},
-	{0, 1, 9, 8, 4, 10, 8, 10, 11, 10, 4, 5, -1, -1, -1, -1},
-	{10, 11, 4, 10, 4, 5, 11, 3, 4, 9, 4, 1, 3, 1, 4, -1},
-	{2, 5, 1, 2, 8, 5, 2, 11, 8, 4, 5, 8, -1, -1, -1, -1},
-	{0, 4, 11, 0, 11, 3, 4, 5, 11, 2, 11, 1, 5, 1, 11, -1},
-	{0, 2, 5, 0, 5, 9, 2, 11, 5, 4, 5, 8, 11, 8, 5, -1},
-	{9, 4, 5, 2, 11, 3, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
-	{2, 5, 10, 3, 5, 2, 3, 4, 5, 3, 8, 4, -1, -1, -1, -1},
-	{5, 10, 2, 5, 2, 4, 4, 2, 0, -1, -1, -1, -1, -1, -1, -1},
-	{3, 10, 2, 3, 5, 10, 3, 8, 5, 4, 5, 8, 0, 1, 9, -1},
-	{5, 10, 2, 5, 2, 4, 1, 9, 2, 9, 4, 2, -1, -1, -1, -1},
-	{8, 4, 5, 8, 5, 3, 3, 5, 1, -1, -1, -1, -1, -1, -1, -1},
-	{0, 4, 5, 1, 0, 5, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
-	{8, 4, 5, 8, 5, 3, 9, 0, 5, 0, 3, 5, -1, -1, -1, -1},
-	{9, 4, 5, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
-	{4, 11, 7, 4, 9, 11, 9, 10, 11, -1, -1, -1, -1, -1, -1, -1},
-	{0, 8, 3, 4, 9, 7, 9, 11, 7, 9, 10, 11, -1, -1, -1, -1},
-	{1, 10, 11, 1, 11, 4, 1, 4, 0, 7, 4, 11, -1, -1, -1, -1},
-	{3, 1, 4, 3, 4, 8, 1, 10, 4, 7, 4, 11, 10, 11, 4, -1},
-	{4, 11, 7, 9, 11, 4, 9, 2, 11, 9, 1, 2, -1, -1, -1, -1},
-	{9, 7, 4, 9, 11, 7, 9, 1, 11, 2, 11, 1, 0, 8, 3, -1},
-	{11, 7, 4, 11, 4, 2, 2, 4, 0, -1, -1, -1, -1, -1, -1, -1},
-	{11, 7, 4, 11, 4, 2, 8, 3, 4, 3, 2, 4, -1, -1, -1, -1},
-	{2, 9, 10, 2, 7, 9, 2, 3, 7, 7, 4, 9, -1, -1, -1, -1},
-	{9, 10, 7, 9, 7, 4, 10, 2, 7, 8, 7, 0, 2, 0, 7, -1},
-	{3, 7, 10, 3, 10, 2, 7, 4, 10, 1, 10, 0, 4, 0, 10, -1},
-	{1, 10, 2, 8, 7, 4, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
-	{4, 9, 1, 4, 1, 7, 7, 1, 3, -1, -1, -1, -1, -1, -1, -1},
-	{4, 9, 1, 4, 1, 7, 0, 8, 1, 8, 7, 1, -1, -1, -1, -1},
-	{4, 0, 3, 7, 4, 3, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
-	{4, 8, 7, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
-	{9, 10, 8, 10, 11, 8, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
-	{3, 0, 9, 3, 9, 11, 11, 9, 10, -1, -1, -1, -1, -1, -1, -1},
-	{0, 1, 10, 0, 10, 8, 8, 10, 11, -1, -1, -1, -1, -1, -1, -1},
-	{3, 1, 10, 11, 3, 10, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
-	{1, 2, 11, 1, 11, 9, 9, 11, 8, -1, -1, -1, -1, -1, -1, -1},
-	{3, 0, 9, 3, 9, 11, 1, 2, 9, 2, 11, 9, -1, -1, -1, -1},
-	{0, 2, 11, 8, 0, 11, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
-	{3, 2, 11, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
-	{2, 3, 8, 2, 8, 10, 10, 8, 9, -1, -1, -1, -1, -1, -1, -1},
-	{9, 10, 2, 0, 9, 2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
-	{2, 3, 8, 2, 8, 10, 0, 1, 8, 1, 10, 8, -1, -1, -1, -1},
-	{1, 10, 2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
-	{1, 3, 8, 9, 1, 8, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
-	{0, 9, 1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
-	{0, 3, 8, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
-	{-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1}};
+// Edge -> edge cache slot, derived once from GetCornerOffset / EdgeConnection
+static const FMarchingCubesEdgeCache::FEdgeSlot (&GetEdgeSlots())[12]
+{
+	static FMarchingCubesEdgeCache::FEdgeSlot Slots[12];
+	static const bool bBuilt = []()
+	{
+		FIntVector Offsets[8];
+		for (int32 i = 0; i < 8; ++i)
+		{
+			Offsets[i] = UMarchingCubes::GetCornerOffset(i);
+		}
+		FMarchingCubesEdgeCache::BuildEdgeSlots(Offsets, EdgeConnection, Slots);
+		return true;
+	}();
+	(void)bBuilt;
+	return Slots;
+}
+
+// SDF gradient at lattice point P by central differences, one sided where P sits on the edge of [Lo, Hi].
+// Points from solid to air, so it's the outward surface normal up to length.
+template <typename SampleType>
+static FVector SDFGradient(const FIntVector& P, int32 Lo, int32 Hi, SampleType&& Sample)
+{
+	FVector Gradient;
+	for (int32 Axis = 0; Axis < 3; ++Axis)
+	{
+		FIntVector Minus = P;
+		FIntVector Plus = P;
+		Minus[Axis] = FMath::Max(P[Axis] - 1, Lo);
+		Plus[Axis] = FMath::Min(P[Axis] + 1, Hi);
+		Gradient[Axis] = (Sample(Plus) - Sample(Minus)) / FMath::Max(Plus[Axis] - Minus[Axis], 1);
+	}
+	return Gradient;
+}
+
+// Normal of a vertex on a crossed edge: the two corner gradients blended with the same weight InterpolateVertex uses
+static FVector EdgeVertexNormal(const FVector& LowGradient, const FVector& HighGradient, float LowValue, float HighValue, int32 EdgeAxis)
+{
+	const float T = FMath::Abs(LowValue - HighValue) < KINDA_SMALL_NUMBER ? 0.5f : LowValue / (LowValue - HighValue);
+	const FVector Normal = FMath::Lerp(LowGradient, HighGradient, T);
+	if (Normal.SizeSquared() > SMALL_NUMBER)
+	{
+		return Normal.GetUnsafeNormal();
+	}
+
+	// Differences can cancel on a one voxel thin feature, the edge itself still knows which way is out
+	FVector Fallback = FVector::ZeroVector;
+	Fallback[EdgeAxis] = HighValue > LowValue ? 1.0f : -1.0f;
+	return Fallback;
+}
 
 // Default constructor
 UMarchingCubes::UMarchingCubes()
@@ -406,9 +154,9 @@ void UMarchingCubes::GenerateMesh(const UVoxelChunk* ChunkPtr)
     GenerateMeshFromGrid(InVoxelGrid, ChunkOrigin , VoxelSize, OutVertices, OutTriangles, OutNormals);
 
     if (OutVertices.Num() > 0 && OutTriangles.Num() > 0 && OutNormals.Num() > 0) {
-        AsyncTask(ENamedThreads::GameThread, [this, SectionIndex, OutVertices, OutTriangles, OutNormals]()
+        AsyncTask(ENamedThreads::GameThread, [this, ChunkCoords, OutVertices, OutTriangles, OutNormals]()
         {
-            ReconstructMeshSection(SectionIndex, OutVertices, OutTriangles, OutNormals);
+            ReconstructMeshSection(ChunkCoords, OutVertices, OutTriangles, OutNormals);
         });
     } else {
         UE_LOG(LogTemp, Warning, TEXT("Empty mesh data in GenerateMesh"));
@@ -458,9 +206,9 @@ void UMarchingCubes::GenerateMeshSyncronous(const UVoxelChunk* ChunkPtr)
 	GenerateMeshFromGridSyncronous(InVoxelGrid, ChunkOrigin , VoxelSize, OutVertices, OutTriangles, OutNormals);
 
 	if (OutVertices.Num() > 0 && OutTriangles.Num() > 0 && OutNormals.Num() > 0) {
-		AsyncTask(ENamedThreads::GameThread, [this, SectionIndex, OutVertices, OutTriangles, OutNormals]()
+		AsyncTask(ENamedThreads::GameThread, [this, ChunkCoords, OutVertices, OutTriangles, OutNormals]()
 		{
-			ReconstructMeshSection(SectionIndex, OutVertices, OutTriangles, OutNormals);
+			ReconstructMeshSection(ChunkCoords, OutVertices, OutTriangles, OutNormals);
 		});
 	} else {
 		UE_LOG(LogTemp, Warning, TEXT("Empty mesh data in GenerateMesh"));
@@ -622,11 +370,55 @@ void UMarchingCubes::GenerateMeshFromGrid(
         return;
     }
 
-    // INITIALIZE HEIGHT CACHE FIRST - This runs on the game thread before any parallel processing
+    FVoxelDenseSlab Slab;
+    BuildMeshingSlab(InVoxelGrid, Slab);
+
     if (!IsHeightCacheValid(Origin, VoxelSize))
     {
         InitializeHeightCache(Origin, VoxelSize);
     }
+    const FChunkHeightCache NoHeights;
+    GenerateMeshFromSlab(Slab, HeightCache.IsValid() ? *HeightCache : NoHeights, Origin, VoxelSize, OutVertices, OutTriangles, OutNormals);
+}
+
+void UMarchingCubes::BuildMeshingSlab(USparseVoxelGrid* InVoxelGrid, FVoxelDenseSlab& OutSlab, USparseVoxelGrid* const* HighNeighbourGrids)
+{
+    // Dense padded copy of the chunk plus its overflow slab (-1..N) and one more layer on the high faces (N + 1).
+    // The mesher reads this instead of going through the sparse storage per corner. Each grid is copied under
+    // its own lock so writers on other threads can't reshape the storage mid-copy.
+    DIGGER_SCOPE_CYCLE_COUNTER(STAT_DiggerBuildMeshingSlab);
+    const int32 N = FVoxelConversion::ChunkSize * FVoxelConversion::Subdivisions;
+    {
+        FScopeLock Lock(&InVoxelGrid->VoxelDataMutex);
+        OutSlab.Build(InVoxelGrid->VoxelData, -1, N + 1);
+    }
+
+    // N + 1 isn't in this chunk's storage, it's voxel 1 of the +X / +Y / +Z neighbour
+    if (!HighNeighbourGrids)
+    {
+        return;
+    }
+    for (int32 Axis = 0; Axis < 3; ++Axis)
+    {
+        if (USparseVoxelGrid* Neighbour = HighNeighbourGrids[Axis])
+        {
+            FScopeLock Lock(&Neighbour->VoxelDataMutex);
+            OutSlab.FillLayerFromNeighbour(Neighbour->VoxelData, Axis, N + 1, N);
+        }
+    }
+}
+
+void UMarchingCubes::GenerateMeshFromSlab(
+    const FVoxelDenseSlab& Slab,
+    const FChunkHeightCache& Heights,
+    const FVector& Origin,
+    float VoxelSize,
+    TArray<FVector>& OutVertices,
+    TArray<int32>& OutTriangles,
+    TArray<FVector>& OutNormals
+)
+{
+    DIGGER_SCOPE_CYCLE_COUNTER(STAT_DiggerGenerateMesh);
 
     // WorldSpaceOffset for proper alignment for center aligned chunk schema.
     FVector TotalOffset = FVector(FVoxelConversion::LocalVoxelSize * 0.25F - FVoxelConversion::ChunkWorldSize * 0.5f);
@@ -647,50 +439,100 @@ void UMarchingCubes::GenerateMeshFromGrid(
         );
     }
 
-    TMap<FVector, int32> VertexCache;
-
-    // Pre-compute height values for the entire chunk using our robust cache
-    TArray<float> HeightValues;
-    HeightValues.SetNumZeroed(N * N);
-    
-    for (int32 x = 0; x < N; ++x) {
-        for (int32 y = 0; y < N; ++y) {
+    // Shared edge vertices, replaces hashing world positions
+    const FMarchingCubesEdgeCache::FEdgeSlot (&EdgeSlots)[12] = GetEdgeSlots();
+    FMarchingCubesEdgeCache EdgeCache;
+    EdgeCache.Init(N);
+
+    // Pre-compute terrain height per corner column using our robust cache (only X/Y matter)
+    const int32 C = N + 1;
+    TArray<float> ColumnHeights;
+    ColumnHeights.SetNumUninitialized(C * C);
+    for (int32 x = 0; x <= N; ++x) {
+        for (int32 y = 0; y <= N; ++y) {
             FVector WorldPos = Origin + FVector(x * VoxelSize, y * VoxelSize, 0);
-            HeightValues[y * N + x] = GetCachedHeight(WorldPos);
+            ColumnHeights[x * C + y] = Heights.Sample(WorldPos);
         }
     }
 
+    // Resolve every corner once: explicit voxel value, otherwise solid below terrain / air above.
+    // (The old per-cell "nearby air" search could only ever pick -1 for unset corners below terrain,
+    // its nearest hit is a whole voxel away, so it's gone.)
+    TArray<float> CornerSDF;
+    CornerSDF.SetNumUninitialized(C * C * C);
+    for (int32 x = 0; x <= N; ++x)
+    for (int32 y = 0; y <= N; ++y)
+    {
+        const float ColumnHeight = ColumnHeights[x * C + y];
+        const int32 SlabRow = Slab.ToIndex(x, y, 0);
+        const float* RESTRICT SlabValues = Slab.Values.GetData() + SlabRow;
+        const uint8* RESTRICT SlabExplicit = Slab.Explicit.GetData() + SlabRow;
+        float* RESTRICT Row = CornerSDF.GetData() + (x * C + y) * C;
+        
+        for (int32 z = 0; z <= N; ++z)
+        {
+            const FVector::FReal CornerZ = Origin.Z + z * VoxelSize;
+            const float Implicit = CornerZ < ColumnHeight ? -1.0f : 1.0f;
+            Row[z] = SlabExplicit[z] ? SlabValues[z] : Implicit;
+        }
+    }
+
+    // Gradients reach one corner further out, into the overflow slab at -1 and the neighbours' layer at N + 1,
+    // resolved by the same rule. Border vertices then get the same central differences the neighbour computes.
+    auto PaddedSDF = [&](const FIntVector& P) -> float
+    {
+        if (P.X >= 0 && P.Y >= 0 && P.Z >= 0 && P.X <= N && P.Y <= N && P.Z <= N) {
+            return CornerSDF[(P.X * C + P.Y) * C + P.Z];
+        }
+        const int32 SlabIndex = Slab.ToIndex(P.X, P.Y, P.Z);
+        if (Slab.Explicit[SlabIndex]) {
+            return Slab.Values[SlabIndex];
+        }
+        const FVector::FReal CornerZ = Origin.Z + P.Z * VoxelSize;
+        return CornerZ < Heights.Sample(Origin + FVector(P.X * VoxelSize, P.Y * VoxelSize, 0)) ? -1.0f : 1.0f;
+    };
+
+    // Normals go out alongside their vertices, no pass over the triangles afterwards
+    OutNormals.SetNum(OutVertices.Num(), false);
+
+    // Flat index deltas from a cell's min corner to its 8 corners, in the slab and in CornerSDF
+    int32 SlabCornerDelta[8];
+    int32 CornerDelta[8];
+    for (int32 i = 0; i < 8; i++) {
+        const FIntVector Offset = GetCornerOffset(i);
+        SlabCornerDelta[i] = Offset.X * Slab.StrideX() + Offset.Y * Slab.StrideY() + Offset.Z;
+        CornerDelta[i] = (Offset.X * C + Offset.Y) * C + Offset.Z;
+    }
+
     // Track cells with explicit voxels for debugging
     TArray<FIntVector> CellsWithExplicitVoxels;
     TArray<FIntVector> BelowTerrainCellsWithAirVoxels;
 
     // First pass: Identify cells with air voxels below terrain
-    TSet<FIntVector> CellsWithAirVoxelsBelowTerrain;
+    TArray<uint8> ExplicitAir;
+    Slab.BuildExplicitAirMask(ExplicitAir);
+    
+    TArray<uint8> CellsWithAirVoxelsBelowTerrain;
+    CellsWithAirVoxelsBelowTerrain.SetNumZeroed(N * N * N);
     
     for (int32 x = 0; x < N; ++x)
     for (int32 y = 0; y < N; ++y)
     {
-        float TerrainHeight = HeightValues[y * N + x];
+        float TerrainHeight = ColumnHeights[x * C + y];
         
         for (int32 z = 0; z < N; ++z)
         {
             float MinZ = Origin.Z + z * VoxelSize;
             float MaxZ = MinZ + VoxelSize;
-            bool bBelowTerrain = MaxZ < TerrainHeight;
+            if (!(MaxZ < TerrainHeight)) continue;
             
-            if (!bBelowTerrain) continue;
-            
-            // Check if this cell has any explicit air voxels below terrain
+            // Any explicit air voxel on this cell's corners
+            const int32 SlabIndex = Slab.ToIndex(x, y, z);
+            uint8 bAir = 0;
             for (int32 i = 0; i < 8; i++) {
-                FIntVector CornerCoords = FIntVector(x, y, z) + GetCornerOffset(i);
-                if (InVoxelGrid->VoxelData.Contains(CornerCoords)) {
-                    float SDFValue = InVoxelGrid->GetVoxel(CornerCoords.X, CornerCoords.Y, CornerCoords.Z);
-                    if (SDFValue > 0) { // Air voxel
-                        CellsWithAirVoxelsBelowTerrain.Add(FIntVector(x, y, z));
-                        break;
-                    }
-                }
+                bAir |= ExplicitAir[SlabIndex + SlabCornerDelta[i]];
             }
+            CellsWithAirVoxelsBelowTerrain[(x * N + y) * N + z] = bAir;
         }
     }
 
@@ -698,8 +540,13 @@ void UMarchingCubes::GenerateMeshFromGrid(
     for (int32 x = 0; x < N; ++x)
     for (int32 y = 0; y < N; ++y)
     {
+        // New X column of cells, slide the edge cache planes along
+        if (y == 0 && x > 0) {
+            EdgeCache.AdvanceX();
+        }
+
         // Get terrain height for this column using our cached value
-        float TerrainHeight = HeightValues[y * N + x];
+        float TerrainHeight = ColumnHeights[x * C + y];
         
         for (int32 z = 0; z < N; ++z)
         {
@@ -709,34 +556,26 @@ void UMarchingCubes::GenerateMeshFromGrid(
             bool bBelowTerrain = MaxZ < TerrainHeight;
             
             // Check if this cell has any explicit voxels
-            bool bHasExplicitVoxels = false;
-            bool bHasAirVoxelsBelowTerrain = false;
-            
-            for (int32 i = 0; i < 8 && !bHasExplicitVoxels; i++) {
-                FIntVector CornerCoords = FIntVector(x, y, z) + GetCornerOffset(i);
-                if (InVoxelGrid->VoxelData.Contains(CornerCoords)) {
-                    bHasExplicitVoxels = true;
-                    
-                    // Check if this is an air voxel below terrain
-                    FVector CornerWorldPos = Origin + FVector(CornerCoords) * VoxelSize;
-                    // Use cached height for this check too
-                    float CornerTerrainHeight = GetCachedHeight(CornerWorldPos);
-                    if (CornerWorldPos.Z < CornerTerrainHeight) {
-                        float SDFValue = InVoxelGrid->GetVoxel(CornerCoords.X, CornerCoords.Y, CornerCoords.Z);
-                        if (SDFValue > 0) { // Air voxel
-                            bHasAirVoxelsBelowTerrain = true;
-                        }
-                    }
-                }
+            const int32 SlabIndex = Slab.ToIndex(x, y, z);
+            uint8 ExplicitCorners = 0;
+            for (int32 i = 0; i < 8; i++) {
+                ExplicitCorners |= Slab.Explicit[SlabIndex + SlabCornerDelta[i]];
             }
+            const bool bHasExplicitVoxels = ExplicitCorners != 0;
             
             // For debugging
-            if (bHasExplicitVoxels) {
+            if (IsDebugging() && bHasExplicitVoxels) {
                 CellsWithExplicitVoxels.Add(FIntVector(x, y, z));
-            }
-            
-            if (bBelowTerrain && bHasAirVoxelsBelowTerrain) {
-                BelowTerrainCellsWithAirVoxels.Add(FIntVector(x, y, z));
+                
+                bool bHasAirVoxelsBelowTerrain = false;
+                for (int32 i = 0; i < 8; i++) {
+                    const FIntVector CornerOffset = GetCornerOffset(i);
+                    const FVector::FReal CornerZ = Origin.Z + (z + CornerOffset.Z) * VoxelSize;
+                    bHasAirVoxelsBelowTerrain |= ExplicitAir[SlabIndex + SlabCornerDelta[i]] && CornerZ < ColumnHeights[(x + CornerOffset.X) * C + y + CornerOffset.Y];
+                }
+                if (bBelowTerrain && bHasAirVoxelsBelowTerrain) {
+                    BelowTerrainCellsWithAirVoxels.Add(FIntVector(x, y, z));
+                }
             }
             
             // Check if we need to process this cell
@@ -759,7 +598,7 @@ void UMarchingCubes::GenerateMeshFromGrid(
                         AdjacentCell.X >= N || AdjacentCell.Y >= N || AdjacentCell.Z >= N)
                         continue;
                         
-                    if (CellsWithAirVoxelsBelowTerrain.Contains(AdjacentCell)) {
+                    if (CellsWithAirVoxelsBelowTerrain[(AdjacentCell.X * N + AdjacentCell.Y) * N + AdjacentCell.Z]) {
                         bShouldProcess = true;
                     }
                 }
@@ -774,11 +613,22 @@ void UMarchingCubes::GenerateMeshFromGrid(
                 continue;
             }
 
+            // Gather the resolved corner values and build the cube index without branches
+            const int32 CornerIndex = (x * C + y) * C + z;
+            float CornerSDFValues[8];
+            int32 CubeIndex = 0;
+            for (int32 i = 0; i < 8; i++) {
+                CornerSDFValues[i] = CornerSDF[CornerIndex + CornerDelta[i]];
+                CubeIndex |= (int32)(CornerSDFValues[i] < 0.0f) << i;
+            }
+
+            if (!IsDebugging() && (CubeIndex == 0 || CubeIndex == 255)) {
+                continue;
+            }
+
             FVector CellOrigin = Origin + FVector(x * VoxelSize, y * VoxelSize, z * VoxelSize);
 
             FVector CornerWSPositions[8];
-            float CornerSDFValues[8];
-
             for (int32 i = 0; i < 8; i++) {
                 FIntVector CornerCoords = FIntVector(x, y, z) + GetCornerOffset(i);
                 CornerWSPositions[i] = Origin + FVector(
@@ -786,83 +636,11 @@ void UMarchingCubes::GenerateMeshFromGrid(
                     CornerCoords.Y * VoxelSize,
                     CornerCoords.Z * VoxelSize
                 );
-                
-                // Handle voxel values
-                if (InVoxelGrid->VoxelData.Contains(CornerCoords))
-                {
-                    // Use the explicit voxel value
-                    CornerSDFValues[i] = InVoxelGrid->GetVoxel(CornerCoords.X, CornerCoords.Y, CornerCoords.Z);
-                }
-                else
-                {
-                    // For uninitialized voxels, check if they're below terrain using cached height
-                    FVector WorldPos = CornerWSPositions[i];
-                    float CornerTerrainHeight = GetCachedHeight(WorldPos);
-                    bool bCornerBelowTerrain = WorldPos.Z < CornerTerrainHeight;
-                    
-                    if (bCornerBelowTerrain)
-                    {
-                        // Default to solid for unset voxels below terrain
-                        CornerSDFValues[i] = -1.0f;
-                        
-                        // Check for nearby explicit air voxels that should create a surface
-                        bool bFoundNearbyAir = false;
-                        float MinDistanceToAir = FLT_MAX;
-                        
-                        // Search in a small radius around this corner
-                        const int32 SearchRadius = 2;
-                        const float MaxInfluenceDistance = SearchRadius * VoxelSize;
-                        
-                        for (int32 dx = -SearchRadius; dx <= SearchRadius; dx++)
-                        for (int32 dy = -SearchRadius; dy <= SearchRadius; dy++)
-                        for (int32 dz = -SearchRadius; dz <= SearchRadius; dz++)
-                        {
-                            if (dx == 0 && dy == 0 && dz == 0) continue;
-                            
-                            FIntVector SearchCoords = CornerCoords + FIntVector(dx, dy, dz);
-                            
-                            if (InVoxelGrid->VoxelData.Contains(SearchCoords))
-                            {
-                                float NearbySDFValue = InVoxelGrid->GetVoxel(SearchCoords.X, SearchCoords.Y, SearchCoords.Z);
-                                
-                                // If we find an explicit air voxel
-                                if (NearbySDFValue > 0)
-                                {
-                                    FVector NearbyWorldPos = Origin + FVector(SearchCoords) * VoxelSize;
-                                    float NearbyTerrainHeight = GetCachedHeight(NearbyWorldPos);
-                                    
-                                    // Check if this air voxel is also below terrain (creating a cavity)
-                                    if (NearbyWorldPos.Z < NearbyTerrainHeight)
-                                    {
-                                        float Distance = FVector(dx, dy, dz).Size() * VoxelSize;
-                                        if (Distance < MinDistanceToAir)
-                                        {
-                                            MinDistanceToAir = Distance;
-                                            bFoundNearbyAir = true;
-                                        }
-                                    }
-                                }
-                            }
-                        }
-                        
-                        // If we found nearby air voxels, create a gradient towards them
-                        if (bFoundNearbyAir && MinDistanceToAir < MaxInfluenceDistance)
-                        {
-                            // Alternative approach: Use a more aggressive transition
-                            CornerSDFValues[i] = (MinDistanceToAir < VoxelSize) ? 0.1f : -1.0f;
-                        }
-                    }
-                    else
-                    {
-                        // Above terrain - default to air
-                        CornerSDFValues[i] = 1.0f;
-                    }
-                }
             }
 
             if (IsDebugging()) {
                 // Only visualize cells with explicit voxels or below-terrain cells with air voxels
-                if (bHasExplicitVoxels || (bBelowTerrain && bHasAirVoxelsBelowTerrain)) {
+                if (bHasExplicitVoxels || (bBelowTerrain && CellsWithAirVoxelsBelowTerrain[(x * N + y) * N + z])) {
                     for (int32 i = 0; i < 8; ++i) {
                         FColor PointColor = CornerSDFValues[i] > 0 ? FColor::Blue : FColor::Red;
                         DrawDebugPoint(
@@ -890,98 +668,176 @@ void UMarchingCubes::GenerateMeshFromGrid(
                 }
             }
 
-            // Calculate marching cubes index
-            TArray<float> SDFValues;
-            SDFValues.Append(CornerSDFValues, 8);
-            int32 CubeIndex = CalculateMarchingCubesIndex(SDFValues);
-
             if (CubeIndex == 0 || CubeIndex == 255) {
                 continue;
             }
 
-            // Generate triangles for this cube
-            for (int32 i = 0; TriangleConnectionTable[CubeIndex][i] != -1; i += 3) {
-                FVector TriangleVertices[3];
+            // Resolve each edge the case crosses once. Each edge vertex is interpolated once (low corner -> high corner,
+            // so neighbours agree bit for bit) and its index reused by every cell sharing the edge.
+            const FMarchingCubesCase& Case = MarchingCubesCases[CubeIndex];
+            int32 CellVertices[12];
+            for (int32 e = 0; e < Case.NumEdges; ++e) {
+                const FMarchingCubesEdgeCache::FEdgeSlot& Slot = EdgeSlots[Case.Edges[e]];
+                int32& VertexIndex = EdgeCache.Get(Slot, y, z);
                 
-                for (int32 j = 0; j < 3; ++j) {
-                    int32 EdgeIndex = TriangleConnectionTable[CubeIndex][i + j];
-                    
+                if (VertexIndex == INDEX_NONE) {
                     FVector InterpolatedVertex = InterpolateVertex(
-                        CornerWSPositions[EdgeConnection[EdgeIndex][0]],
-                        CornerWSPositions[EdgeConnection[EdgeIndex][1]],
-                        CornerSDFValues[EdgeConnection[EdgeIndex][0]],
-                        CornerSDFValues[EdgeConnection[EdgeIndex][1]]
+                        CornerWSPositions[Slot.LowCorner],
+                        CornerWSPositions[Slot.HighCorner],
+                        CornerSDFValues[Slot.LowCorner],
+                        CornerSDFValues[Slot.HighCorner]
                     );
                     
-                    TriangleVertices[j] = ApplyLandscapeTransition(InterpolatedVertex);
+                    // Add vertex to mesh with proper offset
+                    VertexIndex = OutVertices.Add(ApplyLandscapeTransition(InterpolatedVertex) + TotalOffset);
+
+                    // Normal from the SDF itself, so it matches across chunk borders where the faces can't see each other
+                    const FIntVector Cell(x, y, z);
+                    OutNormals.Add(EdgeVertexNormal(
+                        SDFGradient(Cell + GetCornerOffset(Slot.LowCorner), -1, N + 1, PaddedSDF),
+                        SDFGradient(Cell + GetCornerOffset(Slot.HighCorner), -1, N + 1, PaddedSDF),
+                        CornerSDFValues[Slot.LowCorner],
+                        CornerSDFValues[Slot.HighCorner],
+                        Slot.Axis
+                    ));
                 }
+                CellVertices[e] = VertexIndex;
+            }
 
-                // Add vertices to mesh with proper offset
-                for (int32 j = 0; j < 3; ++j) {
-                    FVector FinalVertex = TriangleVertices[j] + TotalOffset;
-                    
-                    int32* CachedIndex = VertexCache.Find(FinalVertex);
-                    if (CachedIndex) {
-                        OutTriangles.Add(*CachedIndex);
-                    } else {
-                        int32 NewVertexIndex = OutVertices.Add(FinalVertex);
-                        VertexCache.Add(FinalVertex, NewVertexIndex);
-                        OutTriangles.Add(NewVertexIndex);
-                    }
-                }
+            // Then the triangles, straight from the packed case
+            const int32 FirstIndex = OutTriangles.AddUninitialized(Case.NumIndices);
+            int32* RESTRICT CellIndices = OutTriangles.GetData() + FirstIndex;
+            for (int32 i = 0; i < Case.NumIndices; ++i) {
+                CellIndices[i] = CellVertices[Case.Indices[i]];
             }
         }
     }
 
-    // CORRECTED SMOOTH NORMAL CALCULATION - FLIPPED FOR PROPER LIGHTING
-    OutNormals.SetNum(OutVertices.Num());
-    for (FVector& Normal : OutNormals) {
-        Normal = FVector::ZeroVector;
+    // Debug output
+    if (IsDebugging()) {
+        UE_LOG(LogTemp, Log, TEXT("Generated mesh: %d vertices, %d triangles, %d cells with explicit voxels, %d Fbelow-terrain cells with air"),
+               OutVertices.Num(), OutTriangles.Num() / 3, CellsWithExplicitVoxels.Num(), BelowTerrainCellsWithAirVoxels.Num());
     }
 
-    // Accumulate face normals to vertices (area-weighted)
-    for (int32 i = 0; i < OutTriangles.Num(); i += 3) {
-        int32 I0 = OutTriangles[i];
-        int32 I1 = OutTriangles[i + 1];
-        int32 I2 = OutTriangles[i + 2];
-        
-        const FVector& V0 = OutVertices[I0];
-        const FVector& V1 = OutVertices[I1];
-        const FVector& V2 = OutVertices[I2];
-
-        // Calculate face normal with proper winding order
-        FVector Edge1 = V1 - V0;
-        FVector Edge2 = V2 - V0;
-        FVector FaceNormal = FVector::CrossProduct(Edge1, Edge2);
-        
-        // The magnitude represents twice the triangle area
-        float DoubleArea = FaceNormal.Size();
-        if (DoubleArea > SMALL_NUMBER)
+    INC_DWORD_STAT(STAT_DiggerChunksRemeshed);
+    INC_DWORD_STAT_BY(STAT_DiggerTrianglesEmitted, OutTriangles.Num() / 3);
+}
+
+
+void UMarchingCubes::BuildLODMeshingSlab(USparseVoxelGrid* InVoxelGrid, int32 LOD, const FVoxelLODTransitions& Transitions, FVoxelDenseSlab& OutSlab)
+{
+    // Every 2^LOD-th voxel, or every half of that when transition faces need the finer neighbour's samples
+    DIGGER_SCOPE_CYCLE_COUNTER(STAT_DiggerBuildMeshingSlab);
+    const int32 N = FVoxelConversion::ChunkSize * FVoxelConversion::Subdivisions;
+    const int32 CellStep = 1 << LOD;
+    const int32 SampleStep = Transitions.IsEmpty() ? CellStep : CellStep / 2;
+    FScopeLock Lock(&InVoxelGrid->VoxelDataMutex);
+    OutSlab.BuildDownsampled(InVoxelGrid->VoxelData, 0, N, SampleStep);
+}
+
+void UMarchingCubes::GenerateLODMeshFromSlab(
+    const FVoxelDenseSlab& Slab,
+    int32 LOD,
+    const FVoxelLODTransitions& Transitions,
+    const FChunkHeightCache& Heights,
+    const FVector& Origin,
+    float VoxelSize,
+    TArray<FVector>& OutVertices,
+    TArray<int32>& OutTriangles,
+    TArray<FVector>& OutNormals
+)
+{
+    DIGGER_SCOPE_CYCLE_COUNTER(STAT_DiggerGenerateMesh);
+
+    const FVector TotalOffset = FVector(FVoxelConversion::LocalVoxelSize * 0.25F - FVoxelConversion::ChunkWorldSize * 0.5f);
+    const int32 N = FVoxelConversion::ChunkSize * FVoxelConversion::Subdivisions;
+
+    // Slab samples are SampleStep voxels apart and a cell is K samples wide (2 when there are transition cells)
+    const int32 SampleStep = Slab.Step;
+    const int32 CellStep = 1 << LOD;
+    const int32 K = CellStep / SampleStep;
+    const int32 D = Slab.Dim;
+    const int32 Max = D - 1;
+    const int32 NumCells = N / CellStep;
+
+    // Resolve every sample once with the full resolution rule (explicit voxel, otherwise solid below terrain / air above),
+    // so a voxel on the border reads the same here as in the neighbouring chunk
+    TArray<float> Resolved;
+    Resolved.SetNumUninitialized(D * D * D);
+    for (int32 x = 0; x < D; ++x)
+    for (int32 y = 0; y < D; ++y)
+    {
+        const float ColumnHeight = Heights.Sample(Origin + FVector((x * SampleStep) * VoxelSize, (y * SampleStep) * VoxelSize, 0));
+        const int32 Row = Slab.ToIndex(x, y, 0);
+        for (int32 z = 0; z < D; ++z)
         {
-            // Normalize to get unit normal, then weight by area
-            FVector UnitNormal = FaceNormal / DoubleArea;
-            FVector WeightedNormal = UnitNormal * DoubleArea;
-            
-            // Accumulate to all three vertices
-            OutNormals[I0] += WeightedNormal;
-            OutNormals[I1] += WeightedNormal;
-            OutNormals[I2] += WeightedNormal;
+            const FVector::FReal SampleZ = Origin.Z + (z * SampleStep) * VoxelSize;
+            Resolved[Row + z] = Slab.Explicit[Row + z] ? Slab.Values[Row + z] : (SampleZ < ColumnHeight ? -1.0f : 1.0f);
         }
     }
 
-    // Normalize all vertex normals and FLIP them for proper lighting
-    for (FVector& Normal : OutNormals) {
-        Normal = Normal.GetSafeNormal();
-        
-        // FLIP normals to point outward for proper lighting
-        Normal = -Normal;
+    auto Sample = [&Resolved, &Slab](const FIntVector& P)
+    {
+        return Resolved[Slab.ToIndex(P.X, P.Y, P.Z)];
+    };
+
+    // One vertex per crossed lattice edge, interpolated low end to high end like the full resolution mesher so
+    // border vertices land where the finer neighbour puts them. Normals from the sample gradient, added with the vertex.
+    TMap<uint64, int32> EdgeVertices;
+    OutNormals.SetNum(OutVertices.Num(), false);
+    auto EdgeVertex = [&](const FIntVector& Low, const FIntVector& High, float LowValue, float HighValue)
+    {
+        const int32 Axis = Low.X != High.X ? 0 : (Low.Y != High.Y ? 1 : 2);
+        const uint64 Key = (uint64)Low.X | ((uint64)Low.Y << 20) | ((uint64)Low.Z << 40) | ((uint64)Axis << 60) |
+            ((uint64)(High[Axis] - Low[Axis] == 1) << 62);
+        if (const int32* Existing = EdgeVertices.Find(Key))
+        {
+            return *Existing;
+        }
+
+        const FVector LowWS = Origin + FVector((Low.X * SampleStep) * VoxelSize, (Low.Y * SampleStep) * VoxelSize, (Low.Z * SampleStep) * VoxelSize);
+        const FVector HighWS = Origin + FVector((High.X * SampleStep) * VoxelSize, (High.Y * SampleStep) * VoxelSize, (High.Z * SampleStep) * VoxelSize);
+        const FVector Vertex = InterpolateVertex(LowWS, HighWS, LowValue, HighValue);
+        const int32 Index = OutVertices.Add(ApplyLandscapeTransition(Vertex) + TotalOffset);
+        OutNormals.Add(EdgeVertexNormal(SDFGradient(Low, 0, Max, Sample), SDFGradient(High, 0, Max, Sample), LowValue, HighValue, Axis));
+        EdgeVertices.Add(Key, Index);
+        return Index;
+    };
+
+    for (int32 cx = 0; cx < NumCells; ++cx)
+    for (int32 cy = 0; cy < NumCells; ++cy)
+    for (int32 cz = 0; cz < NumCells; ++cz)
+    {
+        const FIntVector Base(cx * K, cy * K, cz * K);
+
+        // Skip cells without a sign change. Border cells may have transition samples between their corners.
+        const bool bBorder = K > 1 && (cx == 0 || cy == 0 || cz == 0 || cx == NumCells - 1 || cy == NumCells - 1 || cz == NumCells - 1);
+        const int32 Stride = bBorder ? 1 : K;
+        bool bAnySolid = false;
+        bool bAnyAir = false;
+        for (int32 i = 0; i <= K; i += Stride)
+        for (int32 j = 0; j <= K; j += Stride)
+        for (int32 k = 0; k <= K; k += Stride)
+        {
+            const bool bSolid = Sample(Base + FIntVector(i, j, k)) < 0.0f;
+            bAnySolid |= bSolid;
+            bAnyAir |= !bSolid;
+        }
+        if (!bAnySolid || !bAnyAir)
+        {
+            continue;
+        }
+
+        FVoxelCellPolygonizer::Polygonize(Base, K, Max, Transitions, Sample, EdgeVertex, OutTriangles);
     }
 
-    // Debug output
     if (IsDebugging()) {
-        UE_LOG(LogTemp, Log, TEXT("Generated mesh: %d vertices, %d triangles, %d cells with explicit voxels, %d Fbelow-terrain cells with air"),
-               OutVertices.Num(), OutTriangles.Num() / 3, CellsWithExplicitVoxels.Num(), BelowTerrainCellsWithAirVoxels.Num());
+        UE_LOG(LogTemp, Log, TEXT("Generated LOD %d mesh: %d vertices, %d triangles, transitions 0x%x"),
+               LOD, OutVertices.Num(), OutTriangles.Num() / 3, Transitions.Mask);
     }
+
+    INC_DWORD_STAT(STAT_DiggerChunksRemeshed);
+    INC_DWORD_STAT_BY(STAT_DiggerTrianglesEmitted, OutTriangles.Num() / 3);
 }
 
 
@@ -994,6 +850,8 @@ void UMarchingCubes::GenerateMeshFromGridSyncronous(
     TArray<FVector>& OutNormals
 )
 {
+    DIGGER_SCOPE_CYCLE_COUNTER(STAT_DiggerGenerateMesh);
+
     if (!InVoxelGrid) {
         UE_LOG(LogTemp, Error, TEXT("Invalid VoxelGrid in GenerateMeshFromGrid!"));
         return;
@@ -1018,49 +876,30 @@ void UMarchingCubes::GenerateMeshFromGridSyncronous(
         );
     }
 
+    // Shared edge vertices. Edges touching a terrain-snapped corner differ per cell, those still go by position.
+    const FMarchingCubesEdgeCache::FEdgeSlot (&EdgeSlots)[12] = GetEdgeSlots();
+    FMarchingCubesEdgeCache EdgeCache;
+    EdgeCache.Init(N);
     TMap<FVector, int32> VertexCache;
 
-    // Get the height cache pointer
-    TSharedPtr<TMap<FIntPoint, float>>* HeightCachePtr = nullptr;
+    // Dense copy of the chunk, padded out to the 2-voxel air search radius, so corner lookups skip the sparse storage
+    FVoxelDenseSlab Slab;
+    Slab.Build(InVoxelGrid->VoxelData, -2, N + 2);
 
-    if (DiggerManager)
+    // Same dense height cache as the async path, backed by the landscape heightfield
+    if (!IsHeightCacheValid(Origin, VoxelSize))
     {
-        ALandscapeProxy* Landscape = DiggerManager->GetLandscapeProxyAt(Origin);
-        if (Landscape)
-        {
-            HeightCachePtr = DiggerManager->LandscapeHeightCaches.Find(Landscape);
-        }
+        InitializeHeightCache(Origin, VoxelSize);
     }
-    
-    // Create a lambda for height lookup that properly handles the pointer to shared pointer
-    auto GetCachedHeight = [HeightCachePtr, VoxelSize](const FVector& WorldPos) -> float
-    {
-        // Check if the pointer to shared pointer is valid and the shared pointer itself is valid
-        if (!HeightCachePtr || !(*HeightCachePtr).IsValid())
-            return 0.0f;
-
-        // Calculate grid coordinates
-        int32 GridX = FMath::FloorToInt(WorldPos.X / VoxelSize);
-        int32 GridY = FMath::FloorToInt(WorldPos.Y / VoxelSize);
-        FIntPoint Key(GridX, GridY);
-
-        // Access the map through the shared pointer
-        const TMap<FIntPoint, float>& HeightMap = *(*HeightCachePtr).Get();
-        const float* FoundHeight = HeightMap.Find(Key);
-        
-        return FoundHeight ? *FoundHeight : 0.0f;
-    };
 
     // Pre-compute height values for the entire chunk for better performance
     TArray<float> HeightValues;
     HeightValues.SetNumZeroed(N * N);
     
-    if (HeightCachePtr && (*HeightCachePtr).IsValid()) {
-        for (int32 x = 0; x < N; ++x) {
-            for (int32 y = 0; y < N; ++y) {
-                FVector WorldPos = Origin + FVector(x * VoxelSize, y * VoxelSize, 0);
-                HeightValues[y * N + x] = GetCachedHeight(WorldPos);
-            }
+    for (int32 x = 0; x < N; ++x) {
+        for (int32 y = 0; y < N; ++y) {
+            FVector WorldPos = Origin + FVector(x * VoxelSize, y * VoxelSize, 0);
+            HeightValues[y * N + x] = GetCachedHeight(WorldPos);
         }
     }
 
@@ -1087,8 +926,8 @@ void UMarchingCubes::GenerateMeshFromGridSyncronous(
             // Check if this cell has any explicit air voxels below terrain
             for (int32 i = 0; i < 8; i++) {
                 FIntVector CornerCoords = FIntVector(x, y, z) + GetCornerOffset(i);
-                if (InVoxelGrid->VoxelData.Contains(CornerCoords)) {
-                    float SDFValue = InVoxelGrid->GetVoxel(CornerCoords.X, CornerCoords.Y, CornerCoords.Z);
+                if (Slab.Contains(CornerCoords.X, CornerCoords.Y, CornerCoords.Z)) {
+                    float SDFValue = Slab.GetValue(CornerCoords.X, CornerCoords.Y, CornerCoords.Z);
                     if (SDFValue > 0) { // Air voxel
                         CellsWithAirVoxelsBelowTerrain.Add(FIntVector(x, y, z));
                         break;
@@ -1098,10 +937,38 @@ void UMarchingCubes::GenerateMeshFromGridSyncronous(
         }
     }
 
+    // Gradients sample the unsnapped field: explicit voxel, otherwise solid below terrain / air above, as the slab path
+    auto ResolvedSDF = [&](const FIntVector& P) -> float
+    {
+        if (Slab.Contains(P.X, P.Y, P.Z)) {
+            return Slab.GetValue(P.X, P.Y, P.Z);
+        }
+        const FVector::FReal CornerZ = Origin.Z + P.Z * VoxelSize;
+        return CornerZ < GetCachedHeight(Origin + FVector(P.X * VoxelSize, P.Y * VoxelSize, 0)) ? -1.0f : 1.0f;
+    };
+    auto EdgeNormal = [&](const FIntVector& Cell, const FMarchingCubesEdgeCache::FEdgeSlot& Slot, const float* CornerValues)
+    {
+        return EdgeVertexNormal(
+            SDFGradient(Cell + GetCornerOffset(Slot.LowCorner), -1, N + 1, ResolvedSDF),
+            SDFGradient(Cell + GetCornerOffset(Slot.HighCorner), -1, N + 1, ResolvedSDF),
+            CornerValues[Slot.LowCorner],
+            CornerValues[Slot.HighCorner],
+            Slot.Axis
+        );
+    };
+
+    // Normals go out alongside their vertices, no pass over the triangles afterwards
+    OutNormals.SetNum(OutVertices.Num(), false);
+
     // Second pass: Process all cells and generate mesh
     for (int32 x = 0; x < N; ++x)
     for (int32 y = 0; y < N; ++y)
     {
+        // New X column of cells, slide the edge cache planes along
+        if (y == 0 && x > 0) {
+            EdgeCache.AdvanceX();
+        }
+
         // Get terrain height for this column
         float TerrainHeight = HeightValues[y * N + x];
         
@@ -1118,13 +985,13 @@ void UMarchingCubes::GenerateMeshFromGridSyncronous(
             
             for (int32 i = 0; i < 8 && !bHasExplicitVoxels; i++) {
                 FIntVector CornerCoords = FIntVector(x, y, z) + GetCornerOffset(i);
-                if (InVoxelGrid->VoxelData.Contains(CornerCoords)) {
+                if (Slab.Contains(CornerCoords.X, CornerCoords.Y, CornerCoords.Z)) {
                     bHasExplicitVoxels = true;
                     
                     // Check if this is an air voxel below terrain
                     FVector CornerWorldPos = Origin + FVector(CornerCoords) * VoxelSize;
                     if (CornerWorldPos.Z < TerrainHeight) {
-                        float SDFValue = InVoxelGrid->GetVoxel(CornerCoords.X, CornerCoords.Y, CornerCoords.Z);
+                        float SDFValue = Slab.GetValue(CornerCoords.X, CornerCoords.Y, CornerCoords.Z);
                         if (SDFValue > 0) { // Air voxel
                             bHasAirVoxelsBelowTerrain = true;
                         }
@@ -1180,6 +1047,8 @@ void UMarchingCubes::GenerateMeshFromGridSyncronous(
 
             FVector CornerWSPositions[8];
             float CornerSDFValues[8];
+            // Snapped / surface-forced corners depend on which cell looks at them, so their edges can't be shared
+            bool bCornerAdjusted[8] = {};
 
             for (int32 i = 0; i < 8; i++) {
                 FIntVector CornerCoords = FIntVector(x, y, z) + GetCornerOffset(i);
@@ -1204,6 +1073,7 @@ void UMarchingCubes::GenerateMeshFromGridSyncronous(
                     // If the corner is below terrain by less than one voxel unit, snap it
                     if (DistanceToTerrain > 0 && DistanceToTerrain < VoxelSize) {
                         CornerWSPositions[i].Z = CornerTerrainHeight;
+                        bCornerAdjusted[i] = true;
                         
                         if (IsDebugging()) {
                             // Visualize snapped corners
@@ -1221,10 +1091,10 @@ void UMarchingCubes::GenerateMeshFromGridSyncronous(
                 }
                 
                 // Handle voxel values
-                if (InVoxelGrid->VoxelData.Contains(CornerCoords))
+                if (Slab.Contains(CornerCoords.X, CornerCoords.Y, CornerCoords.Z))
                 {
                     // Use the explicit voxel value
-                    CornerSDFValues[i] = InVoxelGrid->GetVoxel(CornerCoords.X, CornerCoords.Y, CornerCoords.Z);
+                    CornerSDFValues[i] = Slab.GetValue(CornerCoords.X, CornerCoords.Y, CornerCoords.Z);
                 }
                 else
                 {
@@ -1240,6 +1110,7 @@ void UMarchingCubes::GenerateMeshFromGridSyncronous(
                     if (bIsTopCorner && FMath::IsNearlyEqual(WorldPos.Z, LocalTerrainHeight, 0.01f)) {
                         // Set to a small positive value to create a surface at the terrain level
                         CornerSDFValues[i] = 0.01f;
+                        bCornerAdjusted[i] = true;
                     }
                     else if (bCornerBelowTerrain)
                     {
@@ -1262,9 +1133,9 @@ void UMarchingCubes::GenerateMeshFromGridSyncronous(
                             
                             FIntVector SearchCoords = CornerCoords + FIntVector(dx, dy, dz);
                             
-                            if (InVoxelGrid->VoxelData.Contains(SearchCoords))
+                            if (Slab.Contains(SearchCoords.X, SearchCoords.Y, SearchCoords.Z))
                             {
-                                float NearbySDFValue = InVoxelGrid->GetVoxel(SearchCoords.X, SearchCoords.Y, SearchCoords.Z);
+                                float NearbySDFValue = Slab.GetValue(SearchCoords.X, SearchCoords.Y, SearchCoords.Z);
                                 
                                 // If we find an explicit air voxel
                                 if (NearbySDFValue > 0)
@@ -1335,65 +1206,61 @@ void UMarchingCubes::GenerateMeshFromGridSyncronous(
                 }
             }
 
-            TArray<float> SDFValuesArray;
-            SDFValuesArray.Append(CornerSDFValues, 8);
-
-            int32 CubeIndex = CalculateMarchingCubesIndex(SDFValuesArray);
+            int32 CubeIndex = 0;
+            for (int32 i = 0; i < 8; i++) {
+                CubeIndex |= (int32)(CornerSDFValues[i] < 0.0f) << i;
+            }
             if (CubeIndex == 0 || CubeIndex == 255) {
                 continue;
             }
 
-            for (int32 i = 0; TriangleConnectionTable[CubeIndex][i] != -1; i += 3) {
-                FVector Vertices[3];
-
-                for (int32 j = 0; j < 3; ++j) {
-                    int32 EdgeIndex = TriangleConnectionTable[CubeIndex][i + j];
-                    FVector Vertex = InterpolateVertex(
-                        CornerWSPositions[EdgeConnection[EdgeIndex][0]],
-                        CornerWSPositions[EdgeConnection[EdgeIndex][1]],
-                        CornerSDFValues[EdgeConnection[EdgeIndex][0]],
-                        CornerSDFValues[EdgeConnection[EdgeIndex][1]]
-                    );
-                    FVector AdjustedVertex = ApplyLandscapeTransition(Vertex);
-                    Vertices[j] = AdjustedVertex;
+            const FMarchingCubesCase& Case = MarchingCubesCases[CubeIndex];
+            int32 CellVertices[12];
+            for (int32 e = 0; e < Case.NumEdges; ++e) {
+                const int32 EdgeIndex = Case.Edges[e];
+                const FMarchingCubesEdgeCache::FEdgeSlot& Slot = EdgeSlots[EdgeIndex];
+
+                if (!bCornerAdjusted[Slot.LowCorner] && !bCornerAdjusted[Slot.HighCorner]) {
+                    int32& VertexIndex = EdgeCache.Get(Slot, y, z);
+                    if (VertexIndex == INDEX_NONE) {
+                        FVector Vertex = InterpolateVertex(
+                            CornerWSPositions[Slot.LowCorner],
+                            CornerWSPositions[Slot.HighCorner],
+                            CornerSDFValues[Slot.LowCorner],
+                            CornerSDFValues[Slot.HighCorner]
+                        );
+                        // Apply offset to vertex before storing
+                        VertexIndex = OutVertices.Add(ApplyLandscapeTransition(Vertex) + TotalOffset);
+                        OutNormals.Add(EdgeNormal(FIntVector(x, y, z), Slot, CornerSDFValues));
+                    }
+                    CellVertices[e] = VertexIndex;
+                    continue;
                 }
 
-                for (int32 j = 0; j < 3; ++j) {
-                    // Apply offset to vertex before caching/lookup
-                    FVector OffsetVertex = Vertices[j] + TotalOffset;
-                    
-                    int32* CachedIndex = VertexCache.Find(OffsetVertex);
-                    if (CachedIndex) {
-                        OutTriangles.Add(*CachedIndex);
-                    } else {
-                        int32 NewIndex = OutVertices.Add(OffsetVertex);
-                        VertexCache.Add(OffsetVertex, NewIndex);
-                        OutTriangles.Add(NewIndex);
-                    }
+                FVector Vertex = InterpolateVertex(
+                    CornerWSPositions[EdgeConnection[EdgeIndex][0]],
+                    CornerWSPositions[EdgeConnection[EdgeIndex][1]],
+                    CornerSDFValues[EdgeConnection[EdgeIndex][0]],
+                    CornerSDFValues[EdgeConnection[EdgeIndex][1]]
+                );
+                // Apply offset to vertex before caching/lookup
+                FVector OffsetVertex = ApplyLandscapeTransition(Vertex) + TotalOffset;
+                
+                int32* CachedIndex = VertexCache.Find(OffsetVertex);
+                if (CachedIndex) {
+                    CellVertices[e] = *CachedIndex;
+                } else {
+                    int32 NewIndex = OutVertices.Add(OffsetVertex);
+                    OutNormals.Add(EdgeNormal(FIntVector(x, y, z), Slot, CornerSDFValues));
+                    VertexCache.Add(OffsetVertex, NewIndex);
+                    CellVertices[e] = NewIndex;
                 }
             }
-        }
-    }
-
-    // Calculate smooth normals
-    OutNormals.SetNum(OutVertices.Num(), false);
-    for (int32 i = 0; i < OutNormals.Num(); ++i) {
-        OutNormals[i] = FVector::ZeroVector;
-    }
 
-    for (int32 i = 0; i < OutTriangles.Num(); i += 3) {
-        const FVector& A = OutVertices[OutTriangles[i]];
-        const FVector& B = OutVertices[OutTriangles[i + 1]];
-        const FVector& C = OutVertices[OutTriangles[i + 2]];
-        FVector Normal = FVector::CrossProduct(B - A, C - A).GetSafeNormal();
-        Normal = -Normal; // Flip as in original
-        OutNormals[OutTriangles[i]]     += Normal;
-        OutNormals[OutTriangles[i + 1]] += Normal;
-        OutNormals[OutTriangles[i + 2]] += Normal;
-    }
-
-    for (int32 i = 0; i < OutNormals.Num(); ++i) {
-        OutNormals[i].Normalize();
+            for (int32 i = 0; i < Case.NumIndices; ++i) {
+                OutTriangles.Add(CellVertices[Case.Indices[i]]);
+            }
+        }
     }
 
     // Apply world space offset to all vertices after mesh generation is complete
@@ -1426,6 +1293,9 @@ void UMarchingCubes::GenerateMeshFromGridSyncronous(
             );
         }
     }
+
+    INC_DWORD_STAT(STAT_DiggerChunksRemeshed);
+    INC_DWORD_STAT_BY(STAT_DiggerTrianglesEmitted, OutTriangles.Num() / 3);
 }
 
 
@@ -1438,101 +1308,77 @@ void UMarchingCubes::InitializeHeightCache(const FVector& ChunkOrigin, float Vox
 		return;
 	}
 
-	// Clear existing cache
-	HeightCache.Empty();
-    
 	int32 N = FVoxelConversion::ChunkSize * FVoxelConversion::Subdivisions;
     
-	// Add padding around the chunk for smooth interpolation at edges
-	int32 Padding = 3;
-	int32 TotalSize = N + (Padding * 2);
+	// Padding around the chunk for smooth interpolation at edges, FChunkHeightCache::GetSampledBounds is the same range
+	const int32 Padding = FChunkHeightCache::Padding;
+	int32 TotalSize = N + 1 + (Padding * 2);
     
-	// FIXED: Use the same coordinate system as your mesh generation
-	FVector ChunkMin = ChunkOrigin - FVector(N * VoxelSize * 0.5f);
-	FVector SampleStart = ChunkMin - FVector(Padding * VoxelSize);
+	// ChunkOrigin is FVoxelConversion::ChunkToWorld, the mesher samples Origin + [0..N] * VoxelSize
+	const FVector SampleStart = ChunkOrigin - FVector(Padding * VoxelSize);
 
 	if (DiggerDebug::Chunks || DiggerDebug::Landscape)
 	UE_LOG(LogTemp, Log, TEXT("Initializing height cache for chunk at %s with %dx%d samples"), 
 		   *ChunkOrigin.ToString(), TotalSize, TotalSize);
+
+	// Built fresh every time, a mesh job may still be reading the previous one
+	TSharedRef<FChunkHeightCache, ESPMode::ThreadSafe> NewCache = MakeShared<FChunkHeightCache, ESPMode::ThreadSafe>();
+	NewCache->Heights.SetNumUninitialized(TotalSize * TotalSize);
+	NewCache->Start = FVector2D(SampleStart.X, SampleStart.Y);
+	NewCache->VoxelSize = VoxelSize;
+	NewCache->Dim = TotalSize;
+
+	// Most chunks sit inside one landscape proxy, grab its heightfield once and only fall back per sample
+	ALandscapeProxy* ChunkLandscape = DiggerManager->GetLandscapeProxyAt(ChunkOrigin + FVector(N * VoxelSize * 0.5f));
+	const FLandscapeHeightfieldPtr Heightfield = DiggerManager->FindLandscapeHeightfield(ChunkLandscape);
     
 	// Sample heights across the extended grid
-	for (int32 x = 0; x < TotalSize; ++x)
+	for (int32 y = 0; y < TotalSize; ++y)
 	{
-		for (int32 y = 0; y < TotalSize; ++y)
+		for (int32 x = 0; x < TotalSize; ++x)
 		{
-			FVector SamplePos = SampleStart + FVector(x * VoxelSize, y * VoxelSize, 0);
-            
-			// Use your precise terrain sampling method
-			float Height = 0.0f;
-			if (ALandscapeProxy* LandscapeProxy = DiggerManager->GetLandscapeProxyAt(SamplePos))
+			const FVector SamplePos = SampleStart + FVector(x * VoxelSize, y * VoxelSize, 0);
+
+			TOptional<float> SampledHeight;
+			if (Heightfield.IsValid())
 			{
-				TOptional<float> SampledHeight = DiggerManager->GetLandscapeHeightAt(SamplePos);
-				Height = SampledHeight.IsSet() ? SampledHeight.GetValue() : 0.0f;
+				SampledHeight = Heightfield->Sample(SamplePos);
 			}
-            
-			// Store using grid coordinates as key
-			FIntVector GridKey(x, y, 0);
-			HeightCache.Add(GridKey, Height);
+			if (!SampledHeight.IsSet() && DiggerManager->GetLandscapeProxyAt(SamplePos))
+			{
+				SampledHeight = DiggerManager->GetLandscapeHeightAt(SamplePos);
+			}
+
+			NewCache->Heights[y * TotalSize + x] = SampledHeight.IsSet() ? SampledHeight.GetValue() : 0.0f;
 		}
 	}
     
 	// Store cache parameters
+	HeightCache = NewCache;
 	CachedChunkOrigin = ChunkOrigin;
 	CachedVoxelSize = VoxelSize;
 	CachedChunkSize = N;
 	bHeightCacheInitialized = true;
 
 	if (DiggerDebug::Landscape)
-	UE_LOG(LogTemp, Log, TEXT("Height cache initialized with %d entries"), HeightCache.Num());
+	UE_LOG(LogTemp, Log, TEXT("Height cache initialized with %d entries"), NewCache->Heights.Num());
 }
 
 float UMarchingCubes::GetCachedHeight(const FVector& WorldPosition) const
 {
-	if (!bHeightCacheInitialized)
+	if (!bHeightCacheInitialized || !HeightCache.IsValid())
 	{
 		if (DiggerDebug::Landscape)
 		UE_LOG(LogTemp, Warning, TEXT("Height cache not initialized!"));
 		return 0.0f;
 	}
-    
-	// Convert world position to grid coordinates - FIXED ALIGNMENT
-	// Use the same coordinate system as the original mesh generation
-	FVector RelativePos = WorldPosition - CachedChunkOrigin;
-    
-	// Convert to grid space (matching your original VoxelSize scaling)
-	float GridX = RelativePos.X / CachedVoxelSize;
-	float GridY = RelativePos.Y / CachedVoxelSize;
-    
-	// Add the chunk center offset to match your original coordinate system
-	GridX += (CachedChunkSize * 0.5f);
-	GridY += (CachedChunkSize * 0.5f);
-    
-	// Bilinear interpolation for smooth height values
-	int32 X0 = FMath::FloorToInt(GridX);
-	int32 Y0 = FMath::FloorToInt(GridY);
-	int32 X1 = X0 + 1;
-	int32 Y1 = Y0 + 1;
-    
-	float FracX = GridX - X0;
-	float FracY = GridY - Y0;
-    
-	// Get the four corner heights with fallback to 0 if not found
-	float H00 = HeightCache.FindRef(FIntVector(X0, Y0, 0));
-	float H10 = HeightCache.FindRef(FIntVector(X1, Y0, 0));
-	float H01 = HeightCache.FindRef(FIntVector(X0, Y1, 0));
-	float H11 = HeightCache.FindRef(FIntVector(X1, Y1, 0));
-    
-	// Bilinear interpolation
-	float H0 = FMath::Lerp(H00, H10, FracX);
-	float H1 = FMath::Lerp(H01, H11, FracX);
-	float FinalHeight = FMath::Lerp(H0, H1, FracY);
-    
-	return FinalHeight;
+	return HeightCache->Sample(WorldPosition);
 }
 
 void UMarchingCubes::ClearHeightCache()
 {
-    HeightCache.Empty();
+    // Only drops our reference, jobs holding the old cache keep it alive
+    HeightCache.Reset();
     bHeightCacheInitialized = false;
     CachedChunkOrigin = FVector::ZeroVector;
     CachedVoxelSize = 0.0f;
@@ -1541,6 +1387,7 @@ void UMarchingCubes::ClearHeightCache()
 
 bool UMarchingCubes::IsHeightCacheValid(const FVector& ChunkOrigin, float VoxelSize) const
 {
+    // Landscape edits clear the caches of the chunks over them (ADiggerManager::InvalidateChunkHeightCaches)
     return bHeightCacheInitialized && 
            CachedChunkOrigin.Equals(ChunkOrigin, 0.1f) && 
            FMath::IsNearlyEqual(CachedVoxelSize, VoxelSize, 0.001f);
@@ -1575,9 +1422,15 @@ void UMarchingCubes::ClearSectionAndRebuildMesh(int32 SectionIndex, FIntVector C
 {
 	if (!DiggerManager) return;
 
-	// 🔄 Clear mesh section from DiggerManager if it exists
-	if (DiggerManager->ProceduralMesh->GetNumSections() > SectionIndex) {
-		DiggerManager->ProceduralMesh->ClearMeshSection(SectionIndex);
+	// 🔄 Clear the chunk's mesh if it has one
+	UVoxelChunk** Chunk = DiggerManager->ChunkMap.Find(ChunkCoord);
+	UProceduralMeshComponent* Mesh = Chunk && *Chunk ? (*Chunk)->GetMeshComponent() : nullptr;
+	if (Mesh && Mesh->GetNumSections() > 0) {
+		Mesh->ClearMeshSection(0);
+	}
+	UProceduralMeshComponent* Collision = Chunk && *Chunk ? (*Chunk)->GetCollisionComponent() : nullptr;
+	if (Collision && Collision->GetNumSections() > 0) {
+		Collision->ClearMeshSection(0);
 	}
 
 	// 🎲 Rebuild new mesh for chunk
@@ -1642,25 +1495,26 @@ void UMarchingCubes::CreateIslandProceduralMesh(
 
 
 
-void UMarchingCubes::ReconstructMeshSection(int32 SectionIndex, const TArray<FVector>& OutOutVertices, const TArray<int32>& OutTriangles, const TArray<FVector>& Normals) const {
+void UMarchingCubes::ReconstructMeshSection(const FIntVector& ChunkCoords, const TArray<FVector>& OutOutVertices, const TArray<int32>& OutTriangles, const TArray<FVector>& Normals) const {
     // Validate pointers
-    if (!DiggerManager || !DiggerManager->ProceduralMesh) {
+    if (!DiggerManager) {
     	if (DiggerDebug::Manager || DiggerDebug::Mesh)
-        UE_LOG(LogTemp, Error, TEXT("DiggerManager or ProceduralMesh is null in ReconstructMeshSection"));
+        UE_LOG(LogTemp, Error, TEXT("DiggerManager is null in ReconstructMeshSection"));
         return;
     }
 
-    // Validate SectionIndex
-    if (SectionIndex < 0) {
+    // Validate Mesh Data
+    if (OutOutVertices.Num() == 0 || OutTriangles.Num() == 0 || Normals.Num() == 0) {
     	if (DiggerDebug::Manager || DiggerDebug::Mesh)
-        UE_LOG(LogTemp, Error, TEXT("Invalid SectionIndex in ReconstructMeshSection: %d"), SectionIndex);
+        UE_LOG(LogTemp, Error, TEXT("Empty mesh data in ReconstructMeshSection"));
         return;
     }
 
-    // Validate Mesh Data
-    if (OutOutVertices.Num() == 0 || OutTriangles.Num() == 0 || Normals.Num() == 0) {
+    // Each chunk owns its own component, so only this chunk's render and physics state gets rebuilt
+    UProceduralMeshComponent* Mesh = DiggerManager->GetOrCreateChunkMeshComponent(ChunkCoords);
+    if (!Mesh) {
     	if (DiggerDebug::Manager || DiggerDebug::Mesh)
-        UE_LOG(LogTemp, Error, TEXT("Empty mesh data in ReconstructMeshSection"));
+        UE_LOG(LogTemp, Error, TEXT("No mesh component for chunk %s in ReconstructMeshSection"), *ChunkCoords.ToString());
         return;
     }
 
@@ -1668,38 +1522,42 @@ void UMarchingCubes::ReconstructMeshSection(int32 SectionIndex, const TArray<FVe
     TArray<FColor> VertexColors;
     TArray<FProcMeshTangent> Tangents;
 
-    // Clear the mesh section if it exists
-    if (DiggerManager->ProceduralMesh->GetNumSections() > SectionIndex) {
-        DiggerManager->ProceduralMesh->ClearMeshSection(SectionIndex);
-    }
+    // Same topology as last time (e.g. a smoothing pass nudging vertices): update the buffers in place
+    // instead of tearing the section down. CreateMeshSection replaces the section otherwise.
+    FProcMeshSection* Existing = Mesh->GetProcMeshSection(0);
+    const bool bSameTopology = Existing &&
+        Existing->ProcVertexBuffer.Num() == OutOutVertices.Num() &&
+        Existing->ProcIndexBuffer.Num() == OutTriangles.Num() &&
+        FMemory::Memcmp(Existing->ProcIndexBuffer.GetData(), OutTriangles.GetData(), OutTriangles.Num() * sizeof(int32)) == 0;
+
 	if (bIsDebugging)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("Creating Mesh Section %d"), SectionIndex);
+		UE_LOG(LogTemp, Warning, TEXT("%s mesh for chunk %s"), bSameTopology ? TEXT("Updating") : TEXT("Creating"), *ChunkCoords.ToString());
 	}
-    // Create a new mesh section
-    DiggerManager->ProceduralMesh->CreateMeshSection(
-        SectionIndex,
-        OutOutVertices,
-        OutTriangles,
-        Normals,
-        UVs,
-        VertexColors,
-        Tangents,
-        true  // Enable collision
-    );
-
-	UProceduralMeshComponent* Mesh = DiggerManager->ProceduralMesh;
-
-	Mesh->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
-	Mesh->SetCollisionObjectType(ECC_WorldDynamic);
-	Mesh->SetCollisionResponseToAllChannels(ECR_Block);
-	Mesh->SetCollisionResponseToChannel(ECC_Pawn, ECR_Block);
-	Mesh->bUseComplexAsSimpleCollision = true;
-	//Mesh->RecreatePhysicsState();
-
-
-    // Ensure the material is set once
-	DiggerManager->ProceduralMesh->SetMaterial(SectionIndex, DiggerManager->GetTerrainMaterial());
+
+    // Render-only upload. The chunk's collision is on a separate component the manager re-cooks from these
+    // vertices (debounced, async, see RequestChunkCollision), so nothing here may rebuild a body: sections stay
+    // bEnableCollision = false, which keeps UpdateMeshSection off UpdateCollision, and new sections go in through
+    // SetProcMeshSection rather than CreateMeshSection, which always calls it.
+    if (bSameTopology) {
+        Mesh->UpdateMeshSection(0, OutOutVertices, Normals, UVs, VertexColors, Tangents);
+    } else {
+        FProcMeshSection Section;
+        Section.bEnableCollision = false;
+        Section.ProcVertexBuffer.SetNum(OutOutVertices.Num());
+        for (int32 i = 0; i < OutOutVertices.Num(); ++i) {
+            FProcMeshVertex& Vertex = Section.ProcVertexBuffer[i];
+            Vertex.Position = OutOutVertices[i];
+            Vertex.Normal = Normals.IsValidIndex(i) ? Normals[i] : FVector(0, 0, 1);
+            Section.SectionLocalBox += Vertex.Position;
+        }
+        Section.ProcIndexBuffer.SetNumUninitialized(OutTriangles.Num());
+        FMemory::Memcpy(Section.ProcIndexBuffer.GetData(), OutTriangles.GetData(), OutTriangles.Num() * sizeof(int32));
+
+        Mesh->SetProcMeshSection(0, Section);
+        Mesh->SetMaterial(0, DiggerManager->GetTerrainMaterial());
+    }
+    DiggerManager->RequestChunkCollision(ChunkCoords);
 
 	// Send the OnMeshReady Callback
 	if (OnMeshReady.IsBound())
@@ -3,6 +3,7 @@
 #include "DrawDebugHelpers.h"
 #include "C:\Users\serpe\Documents\Unreal Projects\DiggerProUnreal\Source\DiggerProUnreal\Public\Voxel\FVoxelSDFHelper.h"
 #include "DiggerDebug.h"
+#include "DiggerStats.h"
 #include "Editor.h"
 #include "VoxelChunk.h"
 #include "VoxelConversion.h"
@@ -141,14 +142,26 @@ void USparseVoxelGrid::SetVoxel(int32 X, int32 Y, int32 Z, float NewSDFValue, bo
 {
     // Lock the method in the VoxelData Mutex for threadsafe operation.
     FScopeLock Lock(&VoxelDataMutex);
+
+    if (!BlendVoxel_NoLock(FIntVector(X, Y, Z), NewSDFValue, bDig))
+        return;
+    INC_DWORD_STAT(STAT_DiggerVoxelsWritten);
+
+    if (ParentChunk)
+    {
+        ParentChunk->MarkDirty();
+    }
+}
+
+bool USparseVoxelGrid::BlendVoxel_NoLock(const FIntVector& VoxelKey, float NewSDFValue, bool bDig)
+{
     constexpr float SDF_THRESHOLD = 0.001f;
 
     // Ignore negligible changes
     if (FMath::IsNearlyZero(NewSDFValue, SDF_THRESHOLD))
-        return;
+        return false;
 
-    FIntVector VoxelKey(X, Y, Z);
-    FVoxelData* ExistingVoxel = VoxelData.Find(VoxelKey);
+    const FVoxelData* ExistingVoxel = VoxelData.Find(VoxelKey);
 
     if (ExistingVoxel)
     {
@@ -166,18 +179,56 @@ void USparseVoxelGrid::SetVoxel(int32 X, int32 Y, int32 Z, float NewSDFValue, bo
             BlendedValue = FMath::Min(CurrentValue, NewSDFValue);
         }
 
-        ExistingVoxel->SDFValue = BlendedValue;
+        // Unchanged writes leave uniform bricks collapsed
+        if (BlendedValue != CurrentValue)
+        {
+            RecordUndo_NoLock(VoxelKey);
+            VoxelData.Add(VoxelKey, FVoxelData(BlendedValue));
+            IslandLabels.MarkDirty(VoxelKey);
+        }
     }
     else
     {
         // For new voxels, just use the new value directly
+        RecordUndo_NoLock(VoxelKey);
         VoxelData.Add(VoxelKey, FVoxelData(NewSDFValue));
+        IslandLabels.MarkDirty(VoxelKey);
     }
 
-    if (ParentChunk)
+    return true;
+}
+
+int32 USparseVoxelGrid::ApplyWriteBatch(const FVoxelWriteBatch& Batch)
+{
+    return ApplyWriteBatches(MakeArrayView(&Batch, 1));
+}
+
+int32 USparseVoxelGrid::ApplyWriteBatches(TArrayView<const FVoxelWriteBatch> Batches)
+{
+    int32 Written = 0;
+    {
+        // One lock for the whole merge instead of one per voxel
+        FScopeLock Lock(&VoxelDataMutex);
+        for (const FVoxelWriteBatch& Batch : Batches)
+        {
+            for (const FVoxelWrite& Write : Batch.Writes)
+            {
+                Written += BlendVoxel_NoLock(Write.Coords, Write.SDFValue, Write.bDig) ? 1 : 0;
+            }
+        }
+    }
+
+    INC_DWORD_STAT_BY(STAT_DiggerVoxelsWritten, Written);
+    if (Written > 0 && ParentChunk)
     {
         ParentChunk->MarkDirty();
     }
+
+    if (DiggerDebug::Voxels)
+    {
+        UE_LOG(LogTemp, Log, TEXT("ApplyWriteBatches: merged %d batches, %d voxels written"), Batches.Num(), Written);
+    }
+    return Written;
 }
 
 
@@ -201,15 +252,15 @@ bool USparseVoxelGrid::SerializeToArchive(FArchive& Ar)
 
     if (Ar.IsSaving())
     {
-        for (auto& Pair : VoxelData)
+        for (const auto& Pair : VoxelData)
         {
-            FIntVector& Key = Pair.Key;
-            FVoxelData& Voxel = Pair.Value;
+            FIntVector Key = Pair.Key;
+            float SDFValue = Pair.Value.SDFValue;
 
             Ar << Key.X;
             Ar << Key.Y;
             Ar << Key.Z;
-            Ar << Voxel.SDFValue;
+            Ar << SDFValue;
         }
     }
 
@@ -242,20 +293,199 @@ bool USparseVoxelGrid::SerializeFromArchive(FArchive& Ar)
             Ar << X << Y << Z << SDFValue;
             VoxelData.Add(FIntVector(X, Y, Z), FVoxelData{ SDFValue });
         }
+
+        CompactStorage();
+        IslandLabels.Invalidate();
+    }
+
+    return true;
+}
+
+
+// Saved SDF values are clamped to +-QuantizedSDFBand, the surface only ever needs the values near it
+static constexpr float QuantizedSDFBand = 4.0f;
+
+static int16 QuantizeSDF(float Value, float Scale)
+{
+    // Far field clamped to the band edge before the divide, so nothing overflows the int16 range
+    const float Clamped = FMath::Clamp(Value, -QuantizedSDFBand, QuantizedSDFBand);
+    const int32 Quantized = FMath::Clamp(FMath::RoundToInt(Clamped / Scale), -(int32)MAX_int16, (int32)MAX_int16);
+
+    // Solid is < 0, a tiny value rounding to 0 would load back as air and move the surface. Keep its sign.
+    if (Quantized == 0 && Value != 0.0f)
+    {
+        return Value < 0.0f ? -1 : 1;
+    }
+    return (int16)Quantized;
+}
+
+bool USparseVoxelGrid::SerializeQuantizedToArchive(FArchive& Ar)
+{
+    TArray<FIntVector> Keys;
+    TArray<float> Values;
+    {
+        FScopeLock Lock(&VoxelDataMutex);
+        Keys.Reserve(VoxelData.Num());
+        Values.Reserve(VoxelData.Num());
+        for (const auto& Pair : VoxelData)
+        {
+            Keys.Add(Pair.Key);
+        }
+        // Sorted X, Y, Z so consecutive deltas are mostly (0, 0, 1), which zlib squeezes to almost nothing
+        Keys.Sort([](const FIntVector& A, const FIntVector& B)
+        {
+            return A.X != B.X ? A.X < B.X : (A.Y != B.Y ? A.Y < B.Y : A.Z < B.Z);
+        });
+        for (const FIntVector& Key : Keys)
+        {
+            Values.Add(VoxelData.Find(Key)->SDFValue);
+        }
+    }
+
+    // Fixed narrow band, so one far-field value can't coarsen the rest of the chunk. The scale is still written
+    // out, older saves with a per-chunk scale decode the same way.
+    float Scale = QuantizedSDFBand / MAX_int16;
+
+    int32 VoxelCount = Keys.Num();
+    Ar << TerrainGridSize;
+    Ar << Subdivisions;
+    Ar << ChunkSize;
+    Ar << VoxelCount;
+    Ar << Scale;
+
+    // Planar layout (all X deltas, then Y, then Z, then SDF) keeps like bytes together for the compressor
+    TArray<int16> Planes;
+    Planes.SetNumUninitialized(VoxelCount * 4);
+    FIntVector Previous = FIntVector::ZeroValue;
+    for (int32 i = 0; i < VoxelCount; ++i)
+    {
+        const FIntVector Delta = Keys[i] - Previous;
+        if (FMath::Abs(Delta.X) > MAX_int16 || FMath::Abs(Delta.Y) > MAX_int16 || FMath::Abs(Delta.Z) > MAX_int16)
+        {
+            UE_LOG(LogTemp, Error, TEXT("SerializeQuantizedToArchive: voxel %s out of range"), *Keys[i].ToString());
+            return false;
+        }
+        Planes[i] = (int16)Delta.X;
+        Planes[VoxelCount + i] = (int16)Delta.Y;
+        Planes[VoxelCount * 2 + i] = (int16)Delta.Z;
+        Planes[VoxelCount * 3 + i] = QuantizeSDF(Values[i], Scale);
+        Previous = Keys[i];
+    }
+    Ar.Serialize(Planes.GetData(), Planes.Num() * sizeof(int16));
+
+    return !Ar.IsError();
+}
+
+bool USparseVoxelGrid::SerializeQuantizedFromArchive(FArchive& Ar)
+{
+    FVoxelBrickMap Decoded;
+    if (!DecodeQuantizedVoxels(Ar, Decoded))
+    {
+        return false;
+    }
+
+    FScopeLock Lock(&VoxelDataMutex);
+    VoxelData = MoveTemp(Decoded);
+    IslandLabels.Invalidate();
+
+    return true;
+}
+
+bool USparseVoxelGrid::DecodeQuantizedVoxels(FArchive& Ar, FVoxelBrickMap& OutVoxels)
+{
+    // Grid dimensions come from the global settings, the stored copy is only kept for the format
+    int32 StoredGridSize = 0;
+    int32 StoredSubdivisions = 0;
+    int32 StoredChunkSize = 0;
+    int32 VoxelCount = 0;
+    float Scale = 1.0f;
+    Ar << StoredGridSize;
+    Ar << StoredSubdivisions;
+    Ar << StoredChunkSize;
+    Ar << VoxelCount;
+    Ar << Scale;
+
+    if (Ar.IsError() || VoxelCount < 0 || VoxelCount > 100000000) // sanity check
+    {
+        UE_LOG(LogTemp, Error, TEXT("Invalid quantized voxel count: %d"), VoxelCount);
+        return false;
     }
 
+    // Four int16 planes per voxel, a count the archive can't hold is corrupt and mustn't size the allocation
+    const int64 Remaining = Ar.TotalSize() - Ar.Tell();
+    if (Ar.TotalSize() >= 0 && (int64)VoxelCount * 4 * sizeof(int16) > Remaining)
+    {
+        UE_LOG(LogTemp, Error, TEXT("Quantized voxel count %d is more than the %lld bytes left"), VoxelCount, Remaining);
+        return false;
+    }
+
+    TArray<int16> Planes;
+    Planes.SetNumUninitialized(VoxelCount * 4);
+    Ar.Serialize(Planes.GetData(), Planes.Num() * sizeof(int16));
+    if (Ar.IsError())
+    {
+        return false;
+    }
+
+    OutVoxels.Empty();
+    FIntVector Current = FIntVector::ZeroValue;
+    for (int32 i = 0; i < VoxelCount; ++i)
+    {
+        Current += FIntVector(Planes[i], Planes[VoxelCount + i], Planes[VoxelCount * 2 + i]);
+        OutVoxels.Add(Current, FVoxelData(Planes[VoxelCount * 3 + i] * Scale));
+    }
+    OutVoxels.Compact();
+
     return true;
 }
 
+bool USparseVoxelGrid::DecodeVoxels(FArchive& Ar, FVoxelBrickMap& OutVoxels)
+{
+    // Same layout as SerializeToArchive
+    int32 StoredGridSize = 0;
+    int32 StoredSubdivisions = 0;
+    int32 StoredChunkSize = 0;
+    int32 VoxelCount = 0;
+    Ar << StoredGridSize;
+    Ar << StoredSubdivisions;
+    Ar << StoredChunkSize;
+    Ar << VoxelCount;
+
+    if (Ar.IsError() || VoxelCount < 0 || VoxelCount > 100000000) // sanity check
+    {
+        UE_LOG(LogTemp, Error, TEXT("Invalid voxel count: %d"), VoxelCount);
+        return false;
+    }
+
+    OutVoxels.Empty();
+    for (int32 i = 0; i < VoxelCount && !Ar.IsError(); ++i)
+    {
+        int32 X, Y, Z;
+        float SDFValue;
+        Ar << X << Y << Z << SDFValue;
+        OutVoxels.Add(FIntVector(X, Y, Z), FVoxelData{ SDFValue });
+    }
+    OutVoxels.Compact();
+
+    return !Ar.IsError();
+}
 
 const FVoxelData* USparseVoxelGrid::GetVoxelData(const FIntVector& Voxel) const
 {
     return VoxelData.Find(Voxel);
 }
 
-FVoxelData* USparseVoxelGrid::GetVoxelData(const FIntVector& Voxel)
+int32 USparseVoxelGrid::CompactStorage()
 {
-    return VoxelData.Find(Voxel);
+    FScopeLock Lock(&VoxelDataMutex);
+    const int32 Collapsed = VoxelData.Compact();
+
+    if (DiggerDebug::Voxels && Collapsed > 0)
+    {
+        UE_LOG(LogTemp, Log, TEXT("CompactStorage: collapsed %d bricks (%d/%d uniform, %d voxels, ~%llu bytes)"),
+            Collapsed, VoxelData.NumUniformBricks(), VoxelData.NumBricks(), VoxelData.Num(), (uint64)VoxelData.GetAllocatedSize());
+    }
+    return Collapsed;
 }
 
 
@@ -282,7 +512,7 @@ bool USparseVoxelGrid::IsVoxelSolid(const FIntVector& VoxelIndex) const
 float USparseVoxelGrid::GetVoxel(int32 X, int32 Y, int32 Z)
 {
     FIntVector VoxelKey(X, Y, Z);
-    FVoxelData* ExistingVoxel = VoxelData.Find(VoxelKey);
+    const FVoxelData* ExistingVoxel = GetVoxelData(VoxelKey);
 
     if (ExistingVoxel)
     {
@@ -422,6 +652,7 @@ bool USparseVoxelGrid::HasVoxelAt(int32 X, int32 Y, int32 Z) const
 TMap<FIntVector, float> USparseVoxelGrid::GetAllVoxels() const
 {
     TMap<FIntVector, float> Voxels;
+    Voxels.Reserve(VoxelData.Num());
     for (const auto& VoxelPair : VoxelData)
     {
         Voxels.Add(FIntVector(VoxelPair.Key), VoxelPair.Value.SDFValue);
@@ -478,7 +709,9 @@ void USparseVoxelGrid::RemoveVoxels(const TArray<FIntVector>& VoxelsToRemove)
                 });
             }
             
+            RecordUndo_NoLock(Voxel);
             VoxelData.Remove(Voxel);
+            IslandLabels.MarkDirty(Voxel);
         }
     }
 
@@ -829,7 +1062,9 @@ bool USparseVoxelGrid::ExtractIslandAtPosition(const FVector& WorldPosition, USp
     // Optional: Encapsulate this in `RemoveVoxels()` for safety
     for (const FIntVector& Voxel : AllConnectedVoxels)
     {
+        RecordUndo_NoLock(Voxel);
         VoxelData.Remove(Voxel);
+        IslandLabels.MarkDirty(Voxel);
     }
 
     if (ParentChunk)
@@ -922,6 +1157,8 @@ FIslandData USparseVoxelGrid::DetectIsland(float SDFThreshold, const FIntVector&
 
 TArray<FIslandData> USparseVoxelGrid::DetectIslands(float SDFThreshold)
 {
+    DIGGER_SCOPE_CYCLE_COUNTER(STAT_DiggerDetectIslands);
+
     TArray<FIslandData> Islands;
     TSet<FIntVector> Visited;
 
@@ -1014,6 +1251,90 @@ TArray<FIslandData> USparseVoxelGrid::DetectIslands(float SDFThreshold)
 }
 
 
+int32 USparseVoxelGrid::UpdateIslandLabels(TArray<int32>& OutNewIslands)
+{
+    FScopeLock Lock(&VoxelDataMutex);
+
+    // Same solidity rule as DetectIslands(0)
+    IslandLabels.Update(VoxelData, [this](const FIntVector& Voxel)
+    {
+        const FVoxelData* Data = VoxelData.Find(Voxel);
+        return Data && Data->SDFValue < 0.0f;
+    }, OutNewIslands);
+
+    return IslandLabels.NumIslands();
+}
+
+void USparseVoxelGrid::InvalidateIslandLabels()
+{
+    FScopeLock Lock(&VoxelDataMutex);
+    IslandLabels.Invalidate();
+}
+
+void USparseVoxelGrid::RecordUndo_NoLock(const FIntVector& Voxel)
+{
+    // First write to a voxel inside an undo group wins, later writes in the same group keep the original value
+    if (!DiggerManager || !DiggerManager->IsRecordingUndo() || UndoCapture.Contains(Voxel))
+    {
+        return;
+    }
+    if (UndoCapture.Num() == 0)
+    {
+        DiggerManager->RegisterUndoGrid(this);
+    }
+    const FVoxelData* Existing = VoxelData.Find(Voxel);
+    UndoCapture.Add(Voxel, Existing ? Existing->SDFValue : FVoxelChunkDelta::Absent());
+}
+
+bool USparseVoxelGrid::HasUndoCapture()
+{
+    FScopeLock Lock(&VoxelDataMutex);
+    return UndoCapture.Num() > 0;
+}
+
+bool USparseVoxelGrid::TakeUndoCapture(FVoxelChunkDelta& OutDelta)
+{
+    FScopeLock Lock(&VoxelDataMutex);
+    for (const TPair<FIntVector, float>& Pair : UndoCapture)
+    {
+        const FVoxelData* Current = VoxelData.Find(Pair.Key);
+        const float After = Current ? Current->SDFValue : FVoxelChunkDelta::Absent();
+
+        // Written and then written back (or dug twice to the same value): nothing to undo
+        const bool bBeforeAbsent = FVoxelChunkDelta::IsAbsent(Pair.Value);
+        if (bBeforeAbsent == FVoxelChunkDelta::IsAbsent(After) && (bBeforeAbsent || Pair.Value == After))
+        {
+            continue;
+        }
+        OutDelta.Add(Pair.Key, Pair.Value, After);
+    }
+    UndoCapture.Reset();
+    return OutDelta.Num() > 0;
+}
+
+void USparseVoxelGrid::RestoreVoxels(const FVoxelChunkDelta& Delta, bool bRestoreBefore)
+{
+    {
+        FScopeLock Lock(&VoxelDataMutex);
+        const TArray<float>& Values = bRestoreBefore ? Delta.Before : Delta.After;
+        for (int32 Index = 0; Index < Delta.Num(); ++Index)
+        {
+            const FIntVector Voxel = Delta.GetVoxel(Index);
+            if (FVoxelChunkDelta::IsAbsent(Values[Index]))
+            {
+                VoxelData.Remove(Voxel);
+            }
+            else
+            {
+                VoxelData.Add(Voxel, FVoxelData(Values[Index]));
+            }
+            IslandLabels.MarkDirty(Voxel);
+        }
+    }
+    INC_DWORD_STAT_BY(STAT_DiggerVoxelsWritten, Delta.Num());
+    CompactStorage();
+}
+
 void USparseVoxelGrid::RemoveSpecifiedVoxels(const TArray<FIntVector>& LocalVoxels)
 {
     FScopeLock Lock(&VoxelDataMutex);
@@ -1030,7 +1351,9 @@ void USparseVoxelGrid::RemoveSpecifiedVoxels(const TArray<FIntVector>& LocalVoxe
             });
         }
         
+        RecordUndo_NoLock(Voxel);
         VoxelData.Remove(Voxel);
+        IslandLabels.MarkDirty(Voxel);
     }
 }
 
@@ -1049,6 +1372,8 @@ bool USparseVoxelGrid::RemoveVoxel(const FIntVector& LocalVoxel)
         });
     }
     
+    RecordUndo_NoLock(LocalVoxel);
+    IslandLabels.MarkDirty(LocalVoxel);
     return VoxelData.Remove(LocalVoxel) > 0;
 }
 
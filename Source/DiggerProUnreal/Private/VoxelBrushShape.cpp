@@ -2,6 +2,7 @@
 
 #include "DiggerDebug.h"
 #include "DiggerManager.h"
+#include "Voxel/BrushShapes/BrushSDFKernels.h"
 #include "EngineUtils.h"
 #include "Landscape.h"
 #include "DrawDebugHelpers.h"
@@ -437,6 +438,26 @@ void UVoxelBrushShape::DebugDrawLineIfEnabled(FVector& Start, FVector& End, FCol
 }
 
 
+void UVoxelBrushShape::CalculateSDFBatch(const FBrushStroke& Stroke, FBrushSDFBatch& Batch) const
+{
+    for (int32 Index = 0; Index < Batch.Num; ++Index)
+    {
+        Batch.SDF[Index] = CalculateSDF(Batch.GetWorldPos(Index), Stroke, Batch.TerrainHeight[Index]);
+    }
+}
+
+bool UVoxelBrushShape::HasNativeSDFBatch() const
+{
+    if (!HasSDFBatchKernel())
+    {
+        return false;
+    }
+
+    // A Blueprint override of CalculateSDF shows up as a script function in place of the native one
+    const UFunction* Function = GetClass()->FindFunctionByName(GET_FUNCTION_NAME_CHECKED(UVoxelBrushShape, CalculateSDF));
+    return Function && Function->HasAnyFunctionFlags(FUNC_Native);
+}
+
 bool UVoxelBrushShape::IsWithinBounds(const FVector& WorldPos, const FBrushStroke& Stroke) const
 {
     return true;
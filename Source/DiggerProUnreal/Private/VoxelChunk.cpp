@@ -2,6 +2,8 @@
 
 #include "DiggerDebug.h"
 #include "DiggerManager.h"
+#include "DiggerStats.h"
+#include "FChunkLoadQueue.h"
 #include "Editor.h"
 #include "EngineUtils.h"
 #include "HLSLTypeAliases.h"
@@ -19,6 +21,10 @@
 #include "Misc/FileHelper.h"
 #include "Misc/OutputDeviceNull.h"
 #include "Serialization/BufferArchive.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Voxel/BrushShapes/BrushBounds.h"
+#include "Voxel/BrushShapes/BrushSDFKernels.h"
 #include "Voxel/BrushShapes/CapsuleBrushShape.h"
 #include "Voxel/BrushShapes/ConeBrushShape.h"
 #include "Voxel/BrushShapes/CubeBrushShape.h"
@@ -133,6 +139,11 @@ void UVoxelChunk::InitializeChunk(const FIntVector& InChunkCoordinates, ADiggerM
 	if (DiggerDebug::Chunks)
 	UE_LOG(LogTemp, Warning, TEXT("Chunk added to ChunkMap at position: X=%d Y=%d Z=%d"), ChunkCoordinates.X, ChunkCoordinates.Y, ChunkCoordinates.Z);
 
+	// Dirtied before we had a manager to queue with
+	if (bIsDirty)
+	{
+		DiggerManager->EnqueueDirtyChunk(ChunkCoordinates);
+	}
 }
 
 void UVoxelChunk::InitializeMeshComponent(UProceduralMeshComponent* MeshComponent)
@@ -140,6 +151,11 @@ void UVoxelChunk::InitializeMeshComponent(UProceduralMeshComponent* MeshComponen
 	ProceduralMeshComponent = MeshComponent;
 }
 
+void UVoxelChunk::InitializeCollisionComponent(UProceduralMeshComponent* CollisionComponent)
+{
+	CollisionMeshComponent = CollisionComponent;
+}
+
 
 void UVoxelChunk::InitializeDiggerManager(ADiggerManager* InDiggerManager)
 {
@@ -250,6 +266,7 @@ void UVoxelChunk::SpawnHoleFromData(const FSpawnedHoleData& HoleData)
 void UVoxelChunk::SaveHoleData(const FVector& Location, const FRotator& Rotation, const FVector& Scale)
 {
 	HoleDataArray.Add(FSpawnedHoleData(Location, Rotation, Scale));
+	bHasUnsavedChanges = true;
 }
 
 
@@ -290,7 +307,20 @@ void UVoxelChunk::DebugPrintVoxelData() const
 
 void UVoxelChunk::MarkDirty()
 {
+	bHasUnsavedChanges = true;
+	RequestRemesh();
+}
+
+void UVoxelChunk::RequestRemesh()
+{
+	const bool bWasDirty = bIsDirty;
 	bIsDirty = true; // Set the dirty flag
+
+	// Only the clean -> dirty edge goes to the manager's mesh queue, repeat dirties are already covered
+	if (!bWasDirty && DiggerManager)
+	{
+		DiggerManager->EnqueueDirtyChunk(ChunkCoordinates);
+	}
 }
 
 void UVoxelChunk::UpdateIfDirty()
@@ -339,7 +369,7 @@ void UVoxelChunk::RefreshSectionMesh()
 	}
 
 	// Mark self dirty and force rebuild when mesh is ready
-	bIsDirty = true;
+	MarkDirty();
 }
 
 void UVoxelChunk::OnMeshReady(FIntVector Coord, int32 SectionIdx)
@@ -366,18 +396,20 @@ void UVoxelChunk::GenerateMeshSyncronous() const
     UE_LOG(LogTemp, Warning, TEXT("GenerateMeshSyncronous - Starting mesh generation"));
 
     // --- Island Detection ---
-    TArray<FIslandData> Islands = SparseVoxelGrid->DetectIslands(0.0f);
-    if (Islands.Num() > 0)
+    // Incremental: only the region written since the last remesh gets re-flooded
+    TArray<int32> NewIslands;
+    const int32 IslandCount = SparseVoxelGrid->UpdateIslandLabels(NewIslands);
+    if (NewIslands.Num() > 0)
     {
         if (DiggerDebug::Islands)
         {
-            UE_LOG(LogTemp, Warning, TEXT("Island detection: %d islands found!"), Islands.Num());
+            UE_LOG(LogTemp, Warning, TEXT("Island detection: %d new islands (%d total)"), NewIslands.Num(), IslandCount);
         }
-        for (int32 i = 0; i < Islands.Num(); ++i)
+        for (const int32 Island : NewIslands)
         {
             if (DiggerDebug::Islands)
             {
-                UE_LOG(LogTemp, Warning, TEXT("  Island %d: %d voxels"), i, Islands[i].VoxelCount);
+                UE_LOG(LogTemp, Warning, TEXT("  Island %d: %d voxels"), Island, SparseVoxelGrid->GetIslandLabels().GetIslandSize(Island));
             }
         }
     }
@@ -429,6 +461,7 @@ bool UVoxelChunk::SaveChunkData(const FString& FilePath)
 	}
 
 	// Save all to file
+	INC_DWORD_STAT_BY(STAT_DiggerBytesSerialized, ToBinary.Num());
 	if (FFileHelper::SaveArrayToFile(ToBinary, *FilePath))
 	{
 		ToBinary.FlushCache();
@@ -460,6 +493,7 @@ bool UVoxelChunk::LoadChunkData(const FString& FilePath, bool bOverwrite)
 		return false;
 	}
 
+	INC_DWORD_STAT_BY(STAT_DiggerBytesSerialized, BinaryArray.Num());
 	FMemoryReader FromBinary = FMemoryReader(BinaryArray, true);
 	FromBinary.Seek(0);
 
@@ -496,7 +530,9 @@ bool UVoxelChunk::LoadChunkData(const FString& FilePath, bool bOverwrite)
 		{
 			SparseVoxelGrid->VoxelData.Add(Pair.Key, Pair.Value); // Merge into existing
 		}
+		SparseVoxelGrid->CompactStorage();
 	}
+	SparseVoxelGrid->InvalidateIslandLabels();
 
 	// --- Deserialize hole data ---
 	int32 HoleCount = 0;
@@ -519,6 +555,133 @@ bool UVoxelChunk::LoadChunkData(const FString& FilePath, bool bOverwrite)
 }
 
 
+bool UVoxelChunk::SaveChunkPayload(TArray<uint8>& OutPayload)
+{
+	OutPayload.Reset();
+	FMemoryWriter ToBinary(OutPayload, true);
+
+	if (!SparseVoxelGrid || !SparseVoxelGrid->SerializeQuantizedToArchive(ToBinary))
+	{
+		if (DiggerDebug::Chunks || DiggerDebug::Voxels)
+		UE_LOG(LogTemp, Error, TEXT("Failed to serialize voxel grid for chunk %s"), *ChunkCoordinates.ToString());
+		return false;
+	}
+
+	int32 HoleCount = HoleDataArray.Num();
+	ToBinary << HoleCount;
+	for (FSpawnedHoleData& Hole : HoleDataArray)
+	{
+		ToBinary << Hole;
+	}
+
+	INC_DWORD_STAT_BY(STAT_DiggerBytesSerialized, OutPayload.Num());
+	return !ToBinary.IsError();
+}
+
+bool UVoxelChunk::LoadChunkPayload(const TArray<uint8>& Payload, bool bOverwrite)
+{
+	if (!SparseVoxelGrid)
+	{
+		if (DiggerDebug::Voxels || DiggerDebug::IO)
+		{
+			UE_LOG(LogTemp, Error, TEXT("SparseVoxelGrid is null during load"));
+		}
+		return false;
+	}
+
+	FDecodedChunkPayload Decoded;
+	if (!DecodeChunkPayload(Payload, Decoded))
+	{
+		if (DiggerDebug::IO)
+		{
+			UE_LOG(LogTemp, Error, TEXT("Failed to deserialize quantized voxel grid for chunk %s"), *ChunkCoordinates.ToString());
+		}
+		return false;
+	}
+
+	ApplyDecodedPayload(MoveTemp(Decoded), bOverwrite);
+	return true;
+}
+
+bool UVoxelChunk::DecodeChunkPayload(const TArray<uint8>& Payload, FDecodedChunkPayload& OutDecoded)
+{
+	DIGGER_SCOPE_CYCLE_COUNTER(STAT_DiggerDecodeChunks);
+	INC_DWORD_STAT_BY(STAT_DiggerBytesSerialized, Payload.Num());
+
+	FMemoryReader FromBinary(Payload, true);
+	if (!USparseVoxelGrid::DecodeQuantizedVoxels(FromBinary, OutDecoded.Voxels))
+	{
+		return false;
+	}
+
+	int32 HoleCount = 0;
+	FromBinary << HoleCount;
+	for (int32 i = 0; i < HoleCount && !FromBinary.IsError(); ++i)
+	{
+		FromBinary << OutDecoded.Holes.AddDefaulted_GetRef();
+	}
+	return !FromBinary.IsError();
+}
+
+bool UVoxelChunk::DecodeLegacyChunkFile(const TArray<uint8>& FileData, FDecodedChunkPayload& OutDecoded)
+{
+	DIGGER_SCOPE_CYCLE_COUNTER(STAT_DiggerDecodeChunks);
+	INC_DWORD_STAT_BY(STAT_DiggerBytesSerialized, FileData.Num());
+
+	// Same layout LoadChunkData reads
+	FMemoryReader FromBinary(FileData, true);
+	if (!USparseVoxelGrid::DecodeVoxels(FromBinary, OutDecoded.Voxels))
+	{
+		return false;
+	}
+
+	int32 HoleCount = 0;
+	FromBinary << HoleCount;
+	for (int32 i = 0; i < HoleCount && !FromBinary.IsError(); ++i)
+	{
+		FromBinary << OutDecoded.Holes.AddDefaulted_GetRef();
+	}
+	// Older saves wrote a hole count that didn't match the hole data, keep whatever decoded cleanly
+	if (FromBinary.IsError())
+	{
+		OutDecoded.Holes.Reset();
+	}
+	return true;
+}
+
+void UVoxelChunk::ApplyDecodedPayload(FDecodedChunkPayload&& Decoded, bool bOverwrite)
+{
+	check(IsInGameThread());
+
+	// Same merge rules as LoadChunkData
+	if (bOverwrite)
+	{
+		SparseVoxelGrid->VoxelData = MoveTemp(Decoded.Voxels);
+		ClearSpawnedHoles();
+		HoleDataArray.Empty();
+	}
+	else if (SparseVoxelGrid->VoxelData.Num() == 0)
+	{
+		SparseVoxelGrid->VoxelData = MoveTemp(Decoded.Voxels);
+	}
+	else
+	{
+		for (const auto& Pair : Decoded.Voxels)
+		{
+			SparseVoxelGrid->VoxelData.Add(Pair.Key, Pair.Value);
+		}
+		SparseVoxelGrid->CompactStorage();
+	}
+	SparseVoxelGrid->InvalidateIslandLabels();
+
+	for (const FSpawnedHoleData& Hole : Decoded.Holes)
+	{
+		HoleDataArray.Add(Hole);
+		SpawnHoleFromData(Hole);
+	}
+}
+
+
 void UVoxelChunk::ClearSpawnedHoles()
 {
 	for (AActor* HoleActor : SpawnedHoleInstances)
@@ -701,6 +864,7 @@ void UVoxelChunk::SpawnHole(TSubclassOf<AActor> HoleBPClass, FVector Location, F
 		HoleData.Shape = Shape;
 
 		HoleDataArray.Add(HoleData);
+		bHasUnsavedChanges = true;
 
 
 		if (DiggerDebug::Holes || DiggerDebug::Chunks)
@@ -752,6 +916,7 @@ bool UVoxelChunk::RemoveNearestHole(FVector Location, float MaxDistance)
 		if (HoleDataArray.IsValidIndex(NearestIndex))
 		{
 			HoleDataArray.RemoveAt(NearestIndex);
+			bHasUnsavedChanges = true;
 		}
 
 		SpawnedHoleInstances.RemoveAt(NearestIndex);
@@ -842,10 +1007,6 @@ UVoxelBrushShape* UVoxelChunk::GetBrushShapeForType(EVoxelBrushType BrushType)
 	return CachedBrushShapes[EVoxelBrushType::Sphere];
 }
 
-void UVoxelChunk::MulticastApplyBrushStroke_Implementation(const FBrushStroke& Stroke)
-{
-	ApplyBrushStroke(Stroke);
-}
 /*
 void UVoxelChunk::ApplyBrushStroke(const FBrushStroke& Stroke)
 {
@@ -1031,16 +1192,144 @@ void UVoxelChunk::ApplyBrushStroke(const FBrushStroke& Stroke)
 
 void UVoxelChunk::ApplyBrushStroke(const FBrushStroke& Stroke)
 {
-    // Get the specific brush shape for this stroke type
-    UVoxelBrushShape* BrushShape = GetBrushShapeForType(Stroke.BrushType);
+    ApplyBrushStrokes(MakeArrayView(&Stroke, 1));
+}
 
-    if (!DiggerManager || !BrushShape || !SparseVoxelGrid)
+// The voxel box a stamp covers in a chunk's domain INCLUDING the overflow slab (-1 to VoxelsPerChunk), false if it misses
+static bool GetStampVoxelBox(const FIntVector& ChunkCoords, const FBrushStroke& Stroke, FIntVector& OutMin, FIntVector& OutMax)
+{
+    const FVector ChunkOrigin = FVoxelConversion::ChunkToWorld(ChunkCoords);
+    const float VoxelSize = FVoxelConversion::LocalVoxelSize;
+    const int32 VoxelsPerChunk = FVoxelConversion::ChunkSize * FVoxelConversion::Subdivisions;
+    const float HalfChunkSize = (VoxelsPerChunk * VoxelSize) * 0.5f;
+
+    const FBox BrushBox = FBrushBounds::FromStroke(Stroke).GetWorldBox();
+    const FVector LocalMin = (BrushBox.Min - ChunkOrigin + HalfChunkSize) / VoxelSize;
+    const FVector LocalMax = (BrushBox.Max - ChunkOrigin + HalfChunkSize) / VoxelSize;
+
+    OutMin = FIntVector(
+        FMath::Max(-1, FMath::FloorToInt(LocalMin.X)),
+        FMath::Max(-1, FMath::FloorToInt(LocalMin.Y)),
+        FMath::Max(-1, FMath::FloorToInt(LocalMin.Z)));
+    OutMax = FIntVector(
+        FMath::Min(VoxelsPerChunk, FMath::CeilToInt(LocalMax.X)),
+        FMath::Min(VoxelsPerChunk, FMath::CeilToInt(LocalMax.Y)),
+        FMath::Min(VoxelsPerChunk, FMath::CeilToInt(LocalMax.Z)));
+    return OutMax.X >= OutMin.X && OutMax.Y >= OutMin.Y && OutMax.Z >= OutMin.Z;
+}
+
+// Whether a stamp writes a voxel with this SDF. Only the SDF decides, no distance override.
+static bool IsBrushWrite(const FBrushStroke& Stroke, float SDF, FVector::FReal WorldZ)
+{
+    if (Stroke.bDig)
+    {
+        // Air inside the shape, with depth validation to prevent far-off subterranean voxels
+        return SDF > 0.1f && FMath::Abs(WorldZ - Stroke.BrushPosition.Z) <= Stroke.BrushRadius * 1.5f;
+    }
+    // Solid inside the shape
+    return SDF < -0.1f;
+}
+
+bool UVoxelChunk::WouldBrushStrokesWrite(const FIntVector& ChunkCoords, TArrayView<const FBrushStroke> Strokes, ADiggerManager* Manager)
+{
+    if (!Manager)
+    {
+        return true;
+    }
+
+    const FVector ChunkOrigin = FVoxelConversion::ChunkToWorld(ChunkCoords);
+    const float VoxelSize = FVoxelConversion::LocalVoxelSize;
+    const int32 VoxelsPerChunk = FVoxelConversion::ChunkSize * FVoxelConversion::Subdivisions;
+    const float HalfChunkSize = (VoxelsPerChunk * VoxelSize) * 0.5f;
+    const float HalfVoxelSize = VoxelSize * 0.5f;
+
+    FBrushSDFBatch SDFBatch;
+    for (const FBrushStroke& Stroke : Strokes)
+    {
+        // Can't tell without the shape, let the real pass decide
+        const UVoxelBrushShape* Shape = Manager->GetActiveBrushShape(Stroke.BrushType);
+        if (!Shape)
+        {
+            return true;
+        }
+
+        FIntVector Min, Max;
+        if (!GetStampVoxelBox(ChunkCoords, Stroke, Min, Max))
+        {
+            continue;
+        }
+
+        // Same voxels, heights and SDF as ApplyBrushStrokes, in batches, stopping at the first voxel it would write
+        auto AnyWrite = [&SDFBatch, &Shape, &Stroke]()
+        {
+            Shape->CalculateSDFBatch(Stroke, SDFBatch);
+            for (int32 Index = 0; Index < SDFBatch.Num; ++Index)
+            {
+                if (IsBrushWrite(Stroke, SDFBatch.SDF[Index], SDFBatch.WorldZ[Index]))
+                {
+                    return true;
+                }
+            }
+            return false;
+        };
+
+        SDFBatch.Begin(Stroke);
+        for (int32 X = Min.X; X <= Max.X; ++X)
+        for (int32 Y = Min.Y; Y <= Max.Y; ++Y)
+        for (int32 Z = Min.Z; Z <= Max.Z; ++Z)
+        {
+            const FVector WorldPos = ChunkOrigin + FVector(
+                (X * VoxelSize) - HalfChunkSize + HalfVoxelSize,
+                (Y * VoxelSize) - HalfChunkSize + HalfVoxelSize,
+                (Z * VoxelSize) - HalfChunkSize + HalfVoxelSize
+            );
+            if (!Shape->IsWithinBounds(WorldPos, Stroke))
+            {
+                continue;
+            }
+
+            const TOptional<float> Height = Manager->SampleLandscapeHeight(Manager->GetLandscapeProxyAt(WorldPos), WorldPos);
+            SDFBatch.Add(WorldPos, Height.IsSet() ? Height.GetValue() : -10000000.f);
+            if (SDFBatch.IsFull())
+            {
+                if (AnyWrite())
+                {
+                    return true;
+                }
+                SDFBatch.Begin(Stroke);
+            }
+        }
+        if (SDFBatch.Num > 0 && AnyWrite())
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void UVoxelChunk::ApplyBrushStrokes(TArrayView<const FBrushStroke> Strokes)
+{
+    // Stamps are tracked per voxel in a 64 bit mask, longer runs go through in slices
+    if (Strokes.Num() > MaxStrokesPerPass)
+    {
+        for (int32 First = 0; First < Strokes.Num(); First += MaxStrokesPerPass)
+        {
+            ApplyBrushStrokes(Strokes.Slice(First, FMath::Min(MaxStrokesPerPass, Strokes.Num() - First)));
+        }
+        return;
+    }
+    if (Strokes.Num() == 0)
+    {
+        return;
+    }
+    DIGGER_SCOPE_CYCLE_COUNTER(STAT_DiggerApplyBrushStrokes);
+
+    if (!DiggerManager || !SparseVoxelGrid)
     {
         if (DiggerDebug::Brush || DiggerDebug::Manager || DiggerDebug::Voxels || DiggerDebug::Error)
         {
-            UE_LOG(LogTemp, Error, TEXT("Null pointer in UVoxelChunk::ApplyBrushStroke - DiggerManager: %s, BrushShape: %s, SparseVoxelGrid: %s"), 
+            UE_LOG(LogTemp, Error, TEXT("Null pointer in UVoxelChunk::ApplyBrushStrokes - DiggerManager: %s, SparseVoxelGrid: %s"), 
                    DiggerManager ? TEXT("Valid") : TEXT("NULL"),
-                   BrushShape ? TEXT("Valid") : TEXT("NULL"), 
                    SparseVoxelGrid ? TEXT("Valid") : TEXT("NULL"));
         }
         return;
@@ -1057,65 +1346,70 @@ void UVoxelChunk::ApplyBrushStroke(const FBrushStroke& Stroke)
     const float HalfChunkSize = (VoxelsPerChunk * CachedVoxelSize) * 0.5f;
     const float HalfVoxelSize = CachedVoxelSize * 0.5f;
 
-    // Get brush-specific bounds from the brush shape itself
-    FVector BrushBounds = CalculateBrushBounds(Stroke);
-
-    // Convert brush bounds to voxel space
-    const float VoxelSpaceBoundsX = BrushBounds.X / CachedVoxelSize;
-    const float VoxelSpaceBoundsY = BrushBounds.Y / CachedVoxelSize;
-    const float VoxelSpaceBoundsZ = BrushBounds.Z / CachedVoxelSize;
+    // Per stamp: its shape and the voxel box it covers in THIS chunk's domain INCLUDING the overflow slab
+    // (-1 to VoxelsPerChunk). Stamps that miss the chunk or have no shape are left out.
+    struct FStampInfo
+    {
+        const FBrushStroke* Stroke;
+        UVoxelBrushShape* Shape;
+        bool bNativeSDF;
+        FIntVector Min;
+        FIntVector Max;
+    };
+    TArray<FStampInfo, TInlineAllocator<8>> Stamps;
+    FIntVector UnionMin(MAX_int32);
+    FIntVector UnionMax(MIN_int32);
 
-    // Convert brush position to local voxel coordinates
-    const FVector LocalBrushPos = Stroke.BrushPosition - ChunkOrigin;
-    const FIntVector VoxelCenter = FIntVector(
-        FMath::FloorToInt((LocalBrushPos.X + HalfChunkSize) / CachedVoxelSize),
-        FMath::FloorToInt((LocalBrushPos.Y + HalfChunkSize) / CachedVoxelSize),
-        FMath::FloorToInt((LocalBrushPos.Z + HalfChunkSize) / CachedVoxelSize)
-    );
+    for (const FBrushStroke& Stroke : Strokes)
+    {
+        // Get the specific brush shape for this stroke type
+        UVoxelBrushShape* BrushShape = GetBrushShapeForType(Stroke.BrushType);
+        if (!BrushShape)
+        {
+            if (DiggerDebug::Brush || DiggerDebug::Error)
+            {
+                UE_LOG(LogTemp, Error, TEXT("ApplyBrushStrokes: no brush shape for type %d"), (int32)Stroke.BrushType);
+            }
+            continue;
+        }
 
-    // Calculate bounding box for THIS chunk's domain INCLUDING overflow slab (-1 to VoxelsPerChunk)
-    // This chunk is responsible for voxels from -1 to VoxelsPerChunk in each dimension
-    const int32 MinX = FMath::Max(-1, FMath::FloorToInt(VoxelCenter.X - VoxelSpaceBoundsX));
-    const int32 MaxX = FMath::Min(VoxelsPerChunk, FMath::CeilToInt(VoxelCenter.X + VoxelSpaceBoundsX));
-    const int32 MinY = FMath::Max(-1, FMath::FloorToInt(VoxelCenter.Y - VoxelSpaceBoundsY));
-    const int32 MaxY = FMath::Min(VoxelsPerChunk, FMath::CeilToInt(VoxelCenter.Y + VoxelSpaceBoundsY));
-    const int32 MinZ = FMath::Max(-1, FMath::FloorToInt(VoxelCenter.Z - VoxelSpaceBoundsZ));
-    const int32 MaxZ = FMath::Min(VoxelsPerChunk, FMath::CeilToInt(VoxelCenter.Z + VoxelSpaceBoundsZ));
+        // Brush-specific bounds in this chunk's voxel space, checked before any allocation or work
+        FIntVector Min, Max;
+        if (!GetStampVoxelBox(ChunkCoordinates, Stroke, Min, Max))
+        {
+            continue;
+        }
 
-    // Calculate sizes for each dimension
-    const int32 SizeX = MaxX - MinX + 1;
-    const int32 SizeY = MaxY - MinY + 1;
-    const int32 SizeZ = MaxZ - MinZ + 1;
+        Stamps.Add({ &Stroke, BrushShape, BrushShape->HasNativeSDFBatch(), Min, Max });
+        UnionMin = FIntVector(FMath::Min(UnionMin.X, Min.X), FMath::Min(UnionMin.Y, Min.Y), FMath::Min(UnionMin.Z, Min.Z));
+        UnionMax = FIntVector(FMath::Max(UnionMax.X, Max.X), FMath::Max(UnionMax.Y, Max.Y), FMath::Max(UnionMax.Z, Max.Z));
+    }
 
-    // Check for valid sizes before any allocation or work
-    if (SizeX <= 0 || SizeY <= 0 || SizeZ <= 0)
+    if (Stamps.Num() == 0)
     {
-        if (DiggerDebug::Error)
-        {
-            UE_LOG(LogTemp, Warning, TEXT("ApplyBrushStroke: Invalid brush bounds: SizeX=%d SizeY=%d SizeZ=%d (MinX=%d MaxX=%d MinY=%d MaxY=%d MinZ=%d MaxZ=%d)"), 
-                SizeX, SizeY, SizeZ, MinX, MaxX, MinY, MaxY, MinZ, MaxZ);
-        }
         return;
     }
 
-    // Thread-safe array for air voxels below terrain
+    // Air voxels below terrain, gathered from the worker contexts after the parallel pass
     TArray<FIntVector> AirVoxelsBelowTerrain;
 
-    // Pre-filter voxels and compute terrain heights on game thread using precise queries
+    // Pre-filter voxels and compute terrain heights on game thread using precise queries.
+    // Each voxel is visited once however many stamps overlap it, StampMask says which ones do.
     struct FVoxelInfo
     {
         FIntVector Coords;
         FVector WorldPos;
         float TerrainHeight;
+        uint64 StampMask;
     };
     
     TArray<FVoxelInfo> ValidVoxels;
     
-    for (int32 X = MinX; X <= MaxX; ++X)
+    for (int32 X = UnionMin.X; X <= UnionMax.X; ++X)
     {
-        for (int32 Y = MinY; Y <= MaxY; ++Y)
+        for (int32 Y = UnionMin.Y; Y <= UnionMax.Y; ++Y)
         {
-            for (int32 Z = MinZ; Z <= MaxZ; ++Z)
+            for (int32 Z = UnionMin.Z; Z <= UnionMax.Z; ++Z)
             {
                 // Convert voxel coordinates to center-aligned world position
                 const FVector WorldPos = ChunkOrigin + FVector(
@@ -1124,9 +1418,18 @@ void UVoxelChunk::ApplyBrushStroke(const FBrushStroke& Stroke)
                     (Z * CachedVoxelSize) - HalfChunkSize + HalfVoxelSize
                 );
 
-                // Let the brush shape itself determine if this voxel is relevant
-                // Use the brush shape's bounds checking method
-                if (!BrushShape->IsWithinBounds(WorldPos, Stroke))
+                // Let the brush shapes themselves determine if this voxel is relevant
+                uint64 StampMask = 0;
+                for (int32 StampIndex = 0; StampIndex < Stamps.Num(); ++StampIndex)
+                {
+                    const FStampInfo& Stamp = Stamps[StampIndex];
+                    if (X >= Stamp.Min.X && X <= Stamp.Max.X && Y >= Stamp.Min.Y && Y <= Stamp.Max.Y && Z >= Stamp.Min.Z && Z <= Stamp.Max.Z
+                        && Stamp.Shape->IsWithinBounds(WorldPos, *Stamp.Stroke))
+                    {
+                        StampMask |= 1ull << StampIndex;
+                    }
+                }
+                if (StampMask == 0)
                 {
                     continue;
                 }
@@ -1140,59 +1443,138 @@ void UVoxelChunk::ApplyBrushStroke(const FBrushStroke& Stroke)
                 VoxelInfo.Coords = FIntVector(X, Y, Z);
                 VoxelInfo.WorldPos = WorldPos;
                 VoxelInfo.TerrainHeight = TerrainHeight;
+                VoxelInfo.StampMask = StampMask;
                 
                 ValidVoxels.Add(VoxelInfo);
             }
         }
     }
 
-    // Process valid voxels in parallel - Let brush shape determine everything
-    ParallelFor(ValidVoxels.Num(), [&](int32 VoxelIndex)
+    // Per-worker state: each task fills its own write batch so workers never contend on the grid lock
+    struct FBrushWorkerContext
     {
-        const FVoxelInfo& VoxelInfo = ValidVoxels[VoxelIndex];
-        const FIntVector& Coords = VoxelInfo.Coords;
-        const FVector& WorldPos = VoxelInfo.WorldPos;
-        const float TerrainHeight = VoxelInfo.TerrainHeight;
-        const bool bAboveTerrain = WorldPos.Z >= TerrainHeight;
+        FVoxelWriteBatch Batch;
+        TArray<FIntVector> AirVoxelsBelowTerrain;
+    };
+    TArray<FBrushWorkerContext> WorkerContexts;
 
-        // Calculate SDF value using the specific brush shape with precise terrain height
-        const float SDF = BrushShape->CalculateSDF(WorldPos, Stroke, TerrainHeight);
+    // Blocks of voxels: built-in shapes evaluate a whole block through their native kernel, Blueprint / custom
+    // shapes go through CalculateSDF per voxel. Overlapping stamps are unioned, the strongest value wins.
+    const int32 NumBlocks = FMath::DivideAndRoundUp(ValidVoxels.Num(), FBrushSDFBatch::MaxSize);
+    ParallelForWithTaskContext(WorkerContexts, NumBlocks, [&](FBrushWorkerContext& Context, int32 BlockIndex)
+    {
+        const int32 First = BlockIndex * FBrushSDFBatch::MaxSize;
+        const int32 Count = FMath::Min(FBrushSDFBatch::MaxSize, ValidVoxels.Num() - First);
 
-        // Let the brush shape's SDF completely determine voxel creation
-        if (Stroke.bDig)
+        uint64 BlockMask = 0;
+        for (int32 Index = 0; Index < Count; ++Index)
         {
-            // Create air where SDF indicates we're inside the shape
-            if (SDF > 0.1f) // Only use SDF threshold, no distance override
+            BlockMask |= ValidVoxels[First + Index].StampMask;
+        }
+
+        float BestSDF[FBrushSDFBatch::MaxSize];
+        bool bHasWrite[FBrushSDFBatch::MaxSize] = {};
+        bool bWriteIsDig[FBrushSDFBatch::MaxSize];
+        FBrushSDFBatch SDFBatch;
+
+        for (int32 StampIndex = 0; StampIndex < Stamps.Num(); ++StampIndex)
+        {
+            const uint64 StampBit = 1ull << StampIndex;
+            if (!(BlockMask & StampBit))
             {
-                // Add depth validation to prevent far-off subterranean voxels
-                const float MaxDepthBelowBrush = Stroke.BrushRadius * 1.5f;
-                const float VerticalDistanceFromBrush = FMath::Abs(WorldPos.Z - Stroke.BrushPosition.Z);
-                
-                if (VerticalDistanceFromBrush <= MaxDepthBelowBrush)
+                continue;
+            }
+            const FStampInfo& Stamp = Stamps[StampIndex];
+            const FBrushStroke& Stroke = *Stamp.Stroke;
+
+            if (Stamp.bNativeSDF)
+            {
+                SDFBatch.Begin(Stroke);
+                for (int32 Index = 0; Index < Count; ++Index)
+                {
+                    SDFBatch.Add(ValidVoxels[First + Index].WorldPos, ValidVoxels[First + Index].TerrainHeight);
+                }
+                Stamp.Shape->CalculateSDFBatch(Stroke, SDFBatch);
+            }
+
+            for (int32 Index = 0; Index < Count; ++Index)
+            {
+                const FVoxelInfo& VoxelInfo = ValidVoxels[First + Index];
+                if (!(VoxelInfo.StampMask & StampBit))
+                {
+                    continue;
+                }
+
+                // Calculate SDF value using the specific brush shape with precise terrain height
+                const float SDF = Stamp.bNativeSDF
+                    ? SDFBatch.SDF[Index]
+                    : Stamp.Shape->CalculateSDF(VoxelInfo.WorldPos, Stroke, VoxelInfo.TerrainHeight);
+
+                // Let the brush shape's SDF completely determine voxel creation
+                if (!IsBrushWrite(Stroke, SDF, VoxelInfo.WorldPos.Z))
+                {
+                    continue;
+                }
+                if (Stroke.bDig)
+                {
+                    if (!bHasWrite[Index] || SDF > BestSDF[Index])
+                    {
+                        BestSDF[Index] = SDF;
+                        bHasWrite[Index] = true;
+                        bWriteIsDig[Index] = true;
+                    }
+                }
+                else
                 {
-                    SparseVoxelGrid->SetVoxel(Coords.X, Coords.Y, Coords.Z, SDF, true); // true = EXPLICIT AIR
-                    VoxelsDugCounter.Increment();
-                    
-                    // Track air voxels below terrain for solid shell creation
-                    if (!bAboveTerrain)
+                    if (!bHasWrite[Index] || SDF < BestSDF[Index])
                     {
-                        FScopeLock Lock(&BrushStrokeMutex);
-                        AirVoxelsBelowTerrain.Add(Coords);
+                        BestSDF[Index] = SDF;
+                        bHasWrite[Index] = true;
+                        bWriteIsDig[Index] = false;
                     }
                 }
             }
         }
-        else
+
+        for (int32 Index = 0; Index < Count; ++Index)
         {
-            // Create solid where SDF indicates
-            if (SDF < -0.1f) // Only use SDF threshold, no distance override
+            if (!bHasWrite[Index])
             {
-                SparseVoxelGrid->SetVoxel(Coords.X, Coords.Y, Coords.Z, SDF, false); // false = solid
+                continue;
+            }
+            const FVoxelInfo& VoxelInfo = ValidVoxels[First + Index];
+            if (bWriteIsDig[Index])
+            {
+                Context.Batch.Add(VoxelInfo.Coords, BestSDF[Index], true); // true = EXPLICIT AIR
+                VoxelsDugCounter.Increment();
+
+                // Track air voxels below terrain for solid shell creation
+                if (VoxelInfo.WorldPos.Z < VoxelInfo.TerrainHeight)
+                {
+                    Context.AirVoxelsBelowTerrain.Add(VoxelInfo.Coords);
+                }
+            }
+            else
+            {
+                Context.Batch.Add(VoxelInfo.Coords, BestSDF[Index], false); // false = solid
                 VoxelsAddedCounter.Increment();
             }
         }
     });
 
+    // Shell settings and the modification report follow the newest stamp
+    const FBrushStroke& Stroke = *Stamps.Last().Stroke;
+
+    // Merge every worker's writes under one lock with a single dirty notification
+    TArray<FVoxelWriteBatch> Batches;
+    Batches.Reserve(WorkerContexts.Num());
+    for (FBrushWorkerContext& Context : WorkerContexts)
+    {
+        Batches.Add(MoveTemp(Context.Batch));
+        AirVoxelsBelowTerrain.Append(Context.AirVoxelsBelowTerrain);
+    }
+    SparseVoxelGrid->ApplyWriteBatches(Batches);
+
     // Track shell voxels separately if needed
     int32 ShellVoxelsAdded = 0;
     
@@ -1203,6 +1585,12 @@ void UVoxelChunk::ApplyBrushStroke(const FBrushStroke& Stroke)
     	CreateSolidShellAroundAirVoxels(AirVoxelsBelowTerrain, Stroke.bHiddenSeam);
     }
 
+    // Collapse any bricks this stroke left entirely air or entirely solid
+    if (VoxelsDugCounter.GetValue() > 0 || VoxelsAddedCounter.GetValue() > 0)
+    {
+        SparseVoxelGrid->CompactStorage();
+    }
+
     // Get final counts
     const int32 FinalVoxelsDug = VoxelsDugCounter.GetValue();
     const int32 FinalVoxelsAdded = VoxelsAddedCounter.GetValue();
@@ -1602,85 +1990,10 @@ void UVoxelChunk::BakeToStaticMesh(bool bEnableCollision, bool bEnableNanite, fl
 
 
 
-FVector UVoxelChunk::CalculateBrushBounds(const FBrushStroke& Stroke) const
+FBox UVoxelChunk::CalculateBrushBounds(const FBrushStroke& Stroke) const
 {
-	auto CalculateRotatedBounds = [](const FVector& HalfExtents, const FRotator& Rotation, float Falloff) -> FVector
-	{
-		static constexpr float EPSILON = 0.01f;
-
-		if (Rotation.IsNearlyZero())
-		{
-			return HalfExtents + Falloff + FVector(EPSILON);
-		}
-
-		TArray<FVector> Corners = {
-			FVector(-1, -1, -1), FVector(-1, -1, 1),
-			FVector(-1,  1, -1), FVector(-1,  1, 1),
-			FVector( 1, -1, -1), FVector( 1, -1, 1),
-			FVector( 1,  1, -1), FVector( 1,  1, 1)
-		};
-
-		FBox RotatedBox(EForceInit::ForceInit);
-		for (const FVector& Corner : Corners)
-		{
-			RotatedBox += Rotation.RotateVector(Corner * HalfExtents);
-		}
-
-		return RotatedBox.GetExtent() + Falloff + FVector(EPSILON);
-	};
-
-
-	switch (Stroke.BrushType)
-	{
-	case EVoxelBrushType::Sphere:
-	case EVoxelBrushType::Icosphere:
-	case EVoxelBrushType::Smooth:
-	case EVoxelBrushType::Noise:
-		// Rotation doesn't matter for true spherical brushes
-		return FVector(Stroke.BrushRadius + Stroke.BrushFalloff);
-
-	case EVoxelBrushType::Cube:
-		{
-			const FVector HalfExtents = Stroke.bUseAdvancedCubeBrush
-				? FVector(
-					Stroke.AdvancedCubeHalfExtentX,
-					Stroke.AdvancedCubeHalfExtentY,
-					Stroke.AdvancedCubeHalfExtentZ)
-				: FVector(Stroke.BrushRadius);
-
-			return CalculateRotatedBounds(HalfExtents, Stroke.BrushRotation, Stroke.BrushFalloff);
-		}
-
-	case EVoxelBrushType::Cylinder:
-	case EVoxelBrushType::Capsule:
-		{
-			const FVector HalfExtents = FVector(
-				Stroke.BrushRadius,
-				Stroke.BrushRadius,
-				Stroke.BrushLength * 0.5f
-			);
-			return CalculateRotatedBounds(HalfExtents, Stroke.BrushRotation, Stroke.BrushFalloff);
-		}
-
-	case EVoxelBrushType::Cone:
-	case EVoxelBrushType::Pyramid:
-		{
-			const float AngleRad = FMath::DegreesToRadians(Stroke.BrushAngle);
-			const float RadiusAtBase = Stroke.BrushLength * FMath::Tan(AngleRad);
-			const FVector HalfExtents = FVector(RadiusAtBase, RadiusAtBase, Stroke.BrushLength * 0.5f);
-			return CalculateRotatedBounds(HalfExtents, Stroke.BrushRotation, Stroke.BrushFalloff);
-		}
-
-	case EVoxelBrushType::Torus:
-		{
-			const float OuterRadius = Stroke.BrushRadius + Stroke.TorusInnerRadius;
-			const FVector HalfExtents = FVector(OuterRadius, OuterRadius, Stroke.BrushRadius);
-			return CalculateRotatedBounds(HalfExtents, Stroke.BrushRotation, Stroke.BrushFalloff);
-		}
-
-	default:
-		return FVector(Stroke.BrushRadius + Stroke.BrushFalloff);
-	}
+	// World box of everything the stroke can write, the same one the manager picks chunks with
+	return FBrushBounds::FromStroke(Stroke).GetWorldBox();
 }
 
 
@@ -1830,15 +2143,17 @@ void UVoxelChunk::GenerateMesh() const
 
 	
 	// --- Island Detection ---
-	TArray<FIslandData> Islands = SparseVoxelGrid->DetectIslands(0.0f);
-	if (Islands.Num() > 0)
+	// Incremental: only the region written since the last remesh gets re-flooded
+	TArray<int32> NewIslands;
+	const int32 IslandCount = SparseVoxelGrid->UpdateIslandLabels(NewIslands);
+	if (NewIslands.Num() > 0)
 	{
 		if (DiggerDebug::Islands)
-		{UE_LOG(LogTemp, Warning, TEXT("Island detection: %d islands found!"), Islands.Num());}
-	    for (int32 i = 0; i < Islands.Num(); ++i)
+		{UE_LOG(LogTemp, Warning, TEXT("Island detection: %d new islands (%d total)"), NewIslands.Num(), IslandCount);}
+	    for (const int32 Island : NewIslands)
 	    {
 	        if (DiggerDebug::Islands)
-	        {UE_LOG(LogTemp, Warning, TEXT("  Island %d: %d voxels"), i, Islands[i].VoxelCount);}
+	        {UE_LOG(LogTemp, Warning, TEXT("  Island %d: %d voxels"), Island, SparseVoxelGrid->GetIslandLabels().GetIslandSize(Island));}
 	    }
 	}
 
@@ -0,0 +1,290 @@
+#include "VoxelRegionFile.h"
+#include "DiggerDebug.h"
+#include "DiggerStats.h"
+#include "Async/ParallelFor.h"
+#include "HAL/FileManager.h"
+#include "Misc/Compression.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+const TCHAR* FVoxelRegionFile::Extension = TEXT(".VoxelRegion");
+
+namespace
+{
+	constexpr uint32 RegionMagic = 0x47524744; // "DGRG"
+	constexpr uint32 RegionVersion = 1;
+
+	// Magic, version, entry count
+	constexpr int64 HeaderSize = sizeof(uint32) + sizeof(uint32) + sizeof(int32);
+	// Coords, offset, stored size, raw size, compression
+	constexpr int64 EntrySize = 3 * sizeof(int32) + sizeof(int64) + 2 * sizeof(int32) + sizeof(uint8);
+
+	void SerializeEntry(FArchive& Ar, FVoxelRegionFile::FEntry& Entry)
+	{
+		uint8 Compression = (uint8)Entry.Compression;
+		Ar << Entry.ChunkCoords.X << Entry.ChunkCoords.Y << Entry.ChunkCoords.Z;
+		Ar << Entry.Offset << Entry.StoredSize << Entry.RawSize << Compression;
+		Entry.Compression = (FVoxelRegionFile::ECompression)Compression;
+	}
+
+	bool ReadTableFrom(FArchive& Ar, TArray<FVoxelRegionFile::FEntry>& OutEntries)
+	{
+		uint32 Magic = 0;
+		uint32 Version = 0;
+		int32 EntryCount = 0;
+		Ar << Magic << Version << EntryCount;
+
+		const int64 MaxEntries = (int64)FVoxelRegionFile::RegionSize * FVoxelRegionFile::RegionSize * FVoxelRegionFile::RegionSize;
+		if (Ar.IsError() || Magic != RegionMagic || Version != RegionVersion || EntryCount < 0 || EntryCount > MaxEntries)
+		{
+			return false;
+		}
+
+		OutEntries.SetNum(EntryCount);
+		for (FVoxelRegionFile::FEntry& Entry : OutEntries)
+		{
+			SerializeEntry(Ar, Entry);
+		}
+		return !Ar.IsError();
+	}
+
+	// The table comes straight off disk, check an entry before allocating or seeking for it
+	bool IsEntryInFile(const FVoxelRegionFile::FEntry& Entry, int64 FileSize)
+	{
+		return Entry.StoredSize >= 0 && Entry.RawSize >= 0 && Entry.Offset >= 0 && Entry.Offset + Entry.StoredSize <= FileSize;
+	}
+
+	bool DecodeBlob(const FVoxelRegionFile::FEntry& Entry, const uint8* Stored, TArray<uint8>& OutPayload)
+	{
+		if (Entry.StoredSize < 0 || Entry.RawSize < 0)
+		{
+			return false;
+		}
+		OutPayload.SetNumUninitialized(Entry.RawSize);
+		if (Entry.Compression == FVoxelRegionFile::ECompression::None)
+		{
+			if (Entry.StoredSize != Entry.RawSize)
+			{
+				return false;
+			}
+			FMemory::Memcpy(OutPayload.GetData(), Stored, Entry.RawSize);
+			return true;
+		}
+		return FCompression::UncompressMemory(NAME_Zlib, OutPayload.GetData(), Entry.RawSize, Stored, Entry.StoredSize);
+	}
+}
+
+FIntVector FVoxelRegionFile::ChunkToRegion(const FIntVector& ChunkCoords)
+{
+	return FIntVector(
+		FMath::FloorToInt((float)ChunkCoords.X / RegionSize),
+		FMath::FloorToInt((float)ChunkCoords.Y / RegionSize),
+		FMath::FloorToInt((float)ChunkCoords.Z / RegionSize));
+}
+
+FString FVoxelRegionFile::GetRegionFilePath(const FString& SaveDirectory, const FIntVector& RegionCoords)
+{
+	return SaveDirectory / FString::Printf(TEXT("Region_%d_%d_%d%s"), RegionCoords.X, RegionCoords.Y, RegionCoords.Z, Extension);
+}
+
+bool FVoxelRegionFile::ParseRegionFileName(const FString& FileName, FIntVector& OutRegionCoords)
+{
+	// Expected format: Region_X_Y_Z
+	TArray<FString> Parts;
+	FPaths::GetBaseFilename(FileName).ParseIntoArray(Parts, TEXT("_"), true);
+	if (Parts.Num() != 4 || Parts[0] != TEXT("Region"))
+	{
+		return false;
+	}
+	OutRegionCoords = FIntVector(FCString::Atoi(*Parts[1]), FCString::Atoi(*Parts[2]), FCString::Atoi(*Parts[3]));
+	return true;
+}
+
+bool FVoxelRegionFile::ReadTable(const FString& FilePath, TArray<FEntry>& OutEntries)
+{
+	DIGGER_SCOPE_CYCLE_COUNTER(STAT_DiggerRegionFileIO);
+
+	OutEntries.Reset();
+	TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*FilePath));
+	if (!Reader)
+	{
+		return false;
+	}
+	return ReadTableFrom(*Reader, OutEntries);
+}
+
+bool FVoxelRegionFile::ReadChunk(const FString& FilePath, const FIntVector& ChunkCoords, TArray<uint8>& OutPayload)
+{
+	DIGGER_SCOPE_CYCLE_COUNTER(STAT_DiggerRegionFileIO);
+
+	TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*FilePath));
+	TArray<FEntry> Entries;
+	if (!Reader || !ReadTableFrom(*Reader, Entries))
+	{
+		return false;
+	}
+
+	const FEntry* Entry = Entries.FindByPredicate([&ChunkCoords](const FEntry& E) { return E.ChunkCoords == ChunkCoords; });
+	if (!Entry || !IsEntryInFile(*Entry, Reader->TotalSize()))
+	{
+		return false;
+	}
+
+	TArray<uint8> Stored;
+	Stored.SetNumUninitialized(Entry->StoredSize);
+	Reader->Seek(Entry->Offset);
+	Reader->Serialize(Stored.GetData(), Entry->StoredSize);
+	if (Reader->IsError())
+	{
+		return false;
+	}
+	return DecodeBlob(*Entry, Stored.GetData(), OutPayload);
+}
+
+bool FVoxelRegionFile::ReadAllChunks(const FString& FilePath, TMap<FIntVector, TArray<uint8>>& OutPayloads)
+{
+	DIGGER_SCOPE_CYCLE_COUNTER(STAT_DiggerRegionFileIO);
+
+	TArray<uint8> FileData;
+	if (!FFileHelper::LoadFileToArray(FileData, *FilePath))
+	{
+		return false;
+	}
+
+	FMemoryReader Reader(FileData, true);
+	TArray<FEntry> Entries;
+	if (!ReadTableFrom(Reader, Entries))
+	{
+		return false;
+	}
+
+	bool bAllDecoded = true;
+	for (const FEntry& Entry : Entries)
+	{
+		if (!IsEntryInFile(Entry, FileData.Num())
+			|| !DecodeBlob(Entry, FileData.GetData() + Entry.Offset, OutPayloads.Add(Entry.ChunkCoords)))
+		{
+			OutPayloads.Remove(Entry.ChunkCoords);
+			bAllDecoded = false;
+		}
+	}
+	return bAllDecoded;
+}
+
+bool FVoxelRegionFile::WriteChunks(const FString& FilePath, const TMap<FIntVector, TArray<uint8>>& Payloads, const TSet<FIntVector>& RemoveChunks)
+{
+	DIGGER_SCOPE_CYCLE_COUNTER(STAT_DiggerRegionFileIO);
+
+	struct FBlob
+	{
+		FEntry Entry;
+		TArray<uint8> Stored;
+	};
+	TArray<FBlob> Blobs;
+
+	// Chunks already in the file that this write leaves alone: carry their stored bytes over as is
+	{
+		TArray<uint8> Existing;
+		TArray<FEntry> Entries;
+		if (IFileManager::Get().FileExists(*FilePath) && FFileHelper::LoadFileToArray(Existing, *FilePath))
+		{
+			FMemoryReader Reader(Existing, true);
+			if (ReadTableFrom(Reader, Entries))
+			{
+				for (const FEntry& Entry : Entries)
+				{
+					if (Payloads.Contains(Entry.ChunkCoords) || RemoveChunks.Contains(Entry.ChunkCoords)
+						|| !IsEntryInFile(Entry, Existing.Num()))
+					{
+						continue;
+					}
+					FBlob& Blob = Blobs.AddDefaulted_GetRef();
+					Blob.Entry = Entry;
+					Blob.Stored.Append(Existing.GetData() + Entry.Offset, Entry.StoredSize);
+				}
+			}
+		}
+	}
+
+	// New payloads, compressed in parallel
+	TArray<const TPair<FIntVector, TArray<uint8>>*> NewPayloads;
+	for (const TPair<FIntVector, TArray<uint8>>& Pair : Payloads)
+	{
+		NewPayloads.Add(&Pair);
+	}
+	const int32 FirstNew = Blobs.Num();
+	Blobs.SetNum(FirstNew + NewPayloads.Num());
+
+	ParallelFor(NewPayloads.Num(), [&](int32 Index)
+	{
+		const TArray<uint8>& Raw = NewPayloads[Index]->Value;
+		FBlob& Blob = Blobs[FirstNew + Index];
+		Blob.Entry.ChunkCoords = NewPayloads[Index]->Key;
+		Blob.Entry.RawSize = Raw.Num();
+
+		int32 CompressedSize = FCompression::CompressMemoryBound(NAME_Zlib, Raw.Num());
+		Blob.Stored.SetNumUninitialized(CompressedSize);
+		if (Raw.Num() > 0 && FCompression::CompressMemory(NAME_Zlib, Blob.Stored.GetData(), CompressedSize, Raw.GetData(), Raw.Num())
+			&& CompressedSize < Raw.Num())
+		{
+			Blob.Stored.SetNum(CompressedSize, false);
+			Blob.Entry.Compression = ECompression::Zlib;
+		}
+		else
+		{
+			Blob.Stored = Raw;
+			Blob.Entry.Compression = ECompression::None;
+		}
+		Blob.Entry.StoredSize = Blob.Stored.Num();
+	});
+
+	if (Blobs.Num() == 0)
+	{
+		// Nothing left in this region
+		return !IFileManager::Get().FileExists(*FilePath) || IFileManager::Get().Delete(*FilePath);
+	}
+
+	// Offsets follow the table
+	int64 Offset = HeaderSize + EntrySize * Blobs.Num();
+	for (FBlob& Blob : Blobs)
+	{
+		Blob.Entry.Offset = Offset;
+		Offset += Blob.Entry.StoredSize;
+	}
+
+	TArray<uint8> FileData;
+	FileData.Reserve(Offset);
+	FMemoryWriter Writer(FileData, true);
+	uint32 Magic = RegionMagic;
+	uint32 Version = RegionVersion;
+	int32 EntryCount = Blobs.Num();
+	Writer << Magic << Version << EntryCount;
+	for (FBlob& Blob : Blobs)
+	{
+		SerializeEntry(Writer, Blob.Entry);
+	}
+	for (FBlob& Blob : Blobs)
+	{
+		Writer.Serialize(Blob.Stored.GetData(), Blob.Stored.Num());
+	}
+
+	// Write beside the old file and swap, a failed save never leaves a half written region behind
+	const FString TempPath = FilePath + TEXT(".tmp");
+	if (!FFileHelper::SaveArrayToFile(FileData, *TempPath) || !IFileManager::Get().Move(*FilePath, *TempPath, true, true))
+	{
+		if (DiggerDebug::IO)
+		{
+			UE_LOG(LogTemp, Error, TEXT("FVoxelRegionFile: failed to write %s"), *FilePath);
+		}
+		IFileManager::Get().Delete(*TempPath);
+		return false;
+	}
+
+	if (DiggerDebug::IO)
+	{
+		UE_LOG(LogTemp, Log, TEXT("FVoxelRegionFile: wrote %s (%d chunks, %lld bytes)"), *FilePath, Blobs.Num(), Offset);
+	}
+	return true;
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+// One timed benchmark case
+struct FDiggerBenchmarkResult
+{
+	FString Name;
+	int32 Iterations = 0;
+	int64 ItemsPerIteration = 0;
+	double TotalSeconds = 0.0;
+	double MinSeconds = 0.0;
+	double MaxSeconds = 0.0;
+
+	// Extra numbers worth tracking next to the timing (vertex counts, bytes written...)
+	TMap<FString, double> Counters;
+
+	void AddIteration(double Seconds)
+	{
+		MinSeconds = Iterations == 0 ? Seconds : FMath::Min(MinSeconds, Seconds);
+		MaxSeconds = Iterations == 0 ? Seconds : FMath::Max(MaxSeconds, Seconds);
+		TotalSeconds += Seconds;
+		++Iterations;
+	}
+
+	double GetMillisecondsPerIteration() const { return Iterations > 0 ? (TotalSeconds * 1000.0) / Iterations : 0.0; }
+	double GetItemsPerSecond() const { return TotalSeconds > 0.0 ? (double(ItemsPerIteration) * Iterations) / TotalSeconds : 0.0; }
+};
+
+/**
+ * Micro benchmarks for the voxel pipeline. Safe to run headless: nothing here needs a world or a landscape.
+ */
+class DIGGERPROUNREAL_API FDiggerBenchmark
+{
+public:
+	// Compares per-voxel locked SetVoxel writes against batched ApplyWriteBatches over a VoxelsPerSide^3 block
+	static void RunVoxelWriteComparison(int32 VoxelsPerSide, int32 Iterations, TArray<FDiggerBenchmarkResult>& OutResults);
+
+	// Marching cubes cells per second on a dense random field (nearly every cell crosses the surface):
+	// the -1 terminated triangle table walk with a normal flip pass against the packed case table
+	static void RunMarchingCubesCellComparison(int32 CellsPerSide, int32 Iterations, TArray<FDiggerBenchmarkResult>& OutResults);
+
+	static void LogResults(const TArray<FDiggerBenchmarkResult>& Results);
+
+	// Machine readable form for CI / regression tracking: { "meta": {...}, "results": [ {...}, ... ] }
+	static FString ResultsToJson(const TArray<FDiggerBenchmarkResult>& Results, const TMap<FString, FString>& Meta);
+};
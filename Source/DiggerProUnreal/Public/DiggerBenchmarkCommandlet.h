@@ -0,0 +1,26 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "DiggerBenchmarkCommandlet.generated.h"
+
+/**
+ * Headless run of the voxel pipeline for CI / regression tracking:
+ *   UnrealEditor-Cmd.exe <Project>.uproject -run=DiggerBenchmark -nullrhi -unattended
+ *     [-Chunks=4] [-Strokes=64] [-Iterations=3] [-MCCells=64] [-Output=<path.json>]
+ *
+ * Builds a grid of chunks holding a synthetic rolling heightfield, digs a scripted brush path through
+ * ApplyBrushToAllChunks, then times meshing, island detection and a save/load round trip, plus the marching cubes
+ * cell loop on its own over an MCCells^3 random field.
+ * Results go to the log and to a JSON file (Saved/DiggerBenchmark.json by default).
+ */
+UCLASS()
+class DIGGERPROUNREAL_API UDiggerBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UDiggerBenchmarkCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
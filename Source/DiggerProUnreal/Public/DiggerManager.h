@@ -1,7 +1,6 @@
 #pragma once
 
 #include <mutex>
-#include <queue>
 
 #include "CoreMinimal.h"
 #if WITH_EDITOR
@@ -13,6 +12,10 @@
 #include "Engine/StaticMeshActor.h"
 #include "GameFramework/Actor.h"
 #include "FBrushStroke.h"
+#include "FChunkMeshQueue.h"
+#include "FVoxelUndoJournal.h"
+#include "FLandscapeHeightfield.h"
+#include "FLandscapeProxyIndex.h"
 #include "HoleShapeLibrary.h"
 
 #include "AssetToolsModule.h"
@@ -30,7 +33,17 @@
 #include "DiggerManager.generated.h"
 
 
+class AGameModeBase;
 class AIslandActor;
+class APlayerController;
+class USocketIOLobbyManager;
+struct FChunkLoadQueue;
+struct FDecodedChunkPayload;
+struct FVoxelLODTransitions;
+
+// Async chunk load progress. A chunk counts as loaded once its mesh is up.
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnChunkLoadProgress, int32, ChunksLoaded, int32, ChunksTotal, int32, ChunksFailed);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnChunkLoadFinished, int32, ChunksLoaded, int32, ChunksFailed);
 
 // Helper struct for an island
 struct FIsland
@@ -166,6 +179,20 @@ struct FIslandData
     FIntVector ReferenceVoxel;
 };
 
+// Cross-chunk island pass result: each chunk-local island label (FVoxelIslandLabels) mapped to one global island
+struct FUnifiedIslandMap
+{
+    TMap<FIntVector, TMap<int32, int32>> ChunkIslandToGlobal;
+    int32 NumIslands = 0;
+
+    int32 Find(const FIntVector& ChunkCoords, int32 ChunkIsland) const
+    {
+        const TMap<int32, int32>* ChunkIslands = ChunkIslandToGlobal.Find(ChunkCoords);
+        const int32* Island = ChunkIslands ? ChunkIslands->Find(ChunkIsland) : nullptr;
+        return Island ? *Island : INDEX_NONE;
+    }
+};
+
 struct FIslandMeshData
 {
     TArray<FVector> Vertices;
@@ -199,12 +226,20 @@ public:
     void ApplyBrushToAllChunksPIE(FBrushStroke& BrushStroke);
     void ApplyBrushToAllChunks(FBrushStroke& BrushStroke, bool ForceUpdate);
     void ApplyBrushToAllChunks(FBrushStroke& BrushStroke);
+    // Stamps from one drag applied as a single union: each chunk and voxel is processed once for all of them.
+    // The stamps should share bDig.
+    void ApplyBrushStrokesToAllChunks(TArray<FBrushStroke>& Strokes);
+    static void GetBrushChunkRange(const FBrushStroke& BrushStroke, FIntVector& OutMinChunk, FIntVector& OutMaxChunk);
+    // Chunks in the range whose voxel domain the stroke's shape actually overlaps
+    static void GetBrushChunks(const FBrushStroke& BrushStroke, TArray<FIntVector>& OutChunks);
     bool SaveSDFBrushToFile(const FCustomSDFBrush& Brush, const FString& FilePath);
     bool LoadSDFBrushFromFile(const FString& FilePath, FCustomSDFBrush& OutBrush);
     bool GenerateSDFBrushFromStaticMesh(UStaticMesh* Mesh, FTransform MeshTransform, float VoxelSize,
                                         FCustomSDFBrush& OutBrush);
 
     TArray<FIslandData> DetectUnifiedIslands();
+    // Labels every chunk's islands (chunks in parallel), then joins them across chunk borders with a union-find
+    void BuildUnifiedIslandMap(FUnifiedIslandMap& OutMap);
     FIntVector GetWorldMinChunkCoords() const;
     void RemoveUnifiedIslandVoxels(const FIslandData& Island);
 
@@ -219,6 +254,66 @@ public:
     void DrawDiagonalDebugVoxelsFast(FIntVector ChunkCoords);
     UStaticMesh* ConvertIslandToStaticMesh(const FIslandData& Island, bool bWorldOrigin, FString AssetName);
     void UpdateAllDirtyChunks();
+
+    // Background meshing. Dirty chunks are queued (coalesced per chunk), picked nearest-to-viewer and
+    // most-recently-edited first, meshed on the thread pool and uploaded on the game thread under a per-frame cap.
+    UPROPERTY(EditAnywhere, Category="Digger System|Meshing", meta=(ClampMin="1"))
+    int32 MaxConcurrentMeshJobs = 4;
+
+    UPROPERTY(EditAnywhere, Category="Digger System|Meshing", meta=(ClampMin="1"))
+    int32 MaxMeshUploadsPerFrame = 4;
+
+    // Soft cap on game thread time spent uploading finished meshes per frame
+    UPROPERTY(EditAnywhere, Category="Digger System|Meshing", meta=(ClampMin="0.1"))
+    float MeshUploadBudgetMs = 4.0f;
+
+    // Priority cost of one second since a chunk was dirtied, in chunk distances
+    UPROPERTY(EditAnywhere, Category="Digger System|Meshing")
+    float MeshRecencyWeight = 2.0f;
+
+    // Chunks queued longer than this go first regardless of distance
+    UPROPERTY(EditAnywhere, Category="Digger System|Meshing")
+    float MeshMaxWaitSeconds = 2.0f;
+
+    // Distant chunks mesh at reduced resolution: LOD n has cells 2^n voxels wide and is picked per chunk as the coarsest
+    // level whose error (2^n - 1 voxels) projects to at most LODMaxScreenSpaceError pixels. Chunks touching each other
+    // stay within one level and the coarser one stitches the seam with transition cells.
+    UPROPERTY(EditAnywhere, Category="Digger System|LOD")
+    bool bEnableMeshLOD = false;
+
+    UPROPERTY(EditAnywhere, Category="Digger System|LOD", meta=(ClampMin="0", ClampMax="5", EditCondition="bEnableMeshLOD"))
+    int32 MaxMeshLOD = 3;
+
+    UPROPERTY(EditAnywhere, Category="Digger System|LOD", meta=(ClampMin="0.1", EditCondition="bEnableMeshLOD"))
+    float LODMaxScreenSpaceError = 2.0f;
+
+    UPROPERTY(EditAnywhere, Category="Digger System|LOD", meta=(ClampMin="0.05", EditCondition="bEnableMeshLOD"))
+    float LODUpdateInterval = 0.25f;
+
+    int32 GetChunkMeshLOD(const FIntVector& ChunkCoords) const { return bEnableMeshLOD ? ChunkMeshLODs.FindRef(ChunkCoords) : 0; }
+
+    // Chunk collision lives on a separate collision-only component, cooked from the rendered vertices: debounced by
+    // CollisionCookDelay after the chunk's last upload (NearPhysicsCollisionDelay when a pawn / simulated island is
+    // within CollisionPriorityRadius). The previous body stays live until the async cook finishes.
+    UPROPERTY(EditAnywhere, Category="Digger System|Collision", meta=(ClampMin="0.0"))
+    float CollisionCookDelay = 0.5f;
+
+    UPROPERTY(EditAnywhere, Category="Digger System|Collision", meta=(ClampMin="0.0"))
+    float NearPhysicsCollisionDelay = 0.15f;
+
+    UPROPERTY(EditAnywhere, Category="Digger System|Collision", meta=(ClampMin="0.0"))
+    float CollisionPriorityRadius = 1000.0f;
+
+    UPROPERTY(EditAnywhere, Category="Digger System|Collision", meta=(ClampMin="1"))
+    int32 MaxCollisionCooksPerFrame = 2;
+
+    void RequestChunkCollision(const FIntVector& ChunkCoords);
+
+    void EnqueueDirtyChunk(const FIntVector& ChunkCoords);
+    void PumpMeshJobs();
+    int32 GetNumQueuedMeshJobs() const { return MeshQueue.Num(); }
+    int32 GetNumInFlightMeshJobs() const { return InFlightMeshJobs.Num(); }
+
     AIslandActor* SpawnIslandActorFromIslandAtPosition(const FVector& IslandCenter, bool bEnablePhysics);
 
     FIntVector FindNearestSurfaceVoxel(USparseVoxelGrid* VoxelGrid, FIntVector IntVector, int SurfaceSearchRadius);
@@ -362,6 +457,10 @@ public:
 
     UFUNCTION(CallInEditor, Category="Digger Brush|Actions")
     void ApplyBrushInEditor(bool bDig);
+    // The stroke ApplyBrushInEditor would apply, built from the Editor* brush settings
+    FBrushStroke MakeEditorBrushStroke(bool bDig) const;
+    // Coalesced version of ApplyBrushInEditor for stamps gathered over a frame of painting
+    void ApplyBrushStrokesInEditor(TArray<FBrushStroke>& Strokes);
     void RemoveIslandAtPosition(const FVector& IslandCenter, const FIntVector& ReferenceVoxel);
 
 
@@ -417,6 +516,7 @@ protected:
     void RecreateIslandFromSaveData(const FIslandSaveData& SavedIsland);
     void PopulateAllCachedLandscapeHeights();
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
     void StartHeightCaching();
     void DestroyAllHoleBPs();
     void ClearHolesFromChunkMap();
@@ -516,6 +616,10 @@ public:
 
     void InitializeChunks();  // Initialize all chunks
     void InitializeSingleChunk(UVoxelChunk* Chunk);  // Initialize a single chunk
+    // Each chunk renders through its own component so an edit only rebuilds that chunk's render state
+    UProceduralMeshComponent* GetOrCreateChunkMeshComponent(const FIntVector& ChunkCoords);
+    // ...and collides through a second, hidden one that only the collision cook writes to
+    UProceduralMeshComponent* GetOrCreateChunkCollisionComponent(const FIntVector& ChunkCoords);
     void UpdateLandscapeProxies();
 
     // In ADiggerManager.h
@@ -539,9 +643,11 @@ public:
     UPROPERTY()
     TMap<FIntPoint, float> TerrainHeightCache;
 
-    // Top-level cache by Landscape Proxy
+    // Top-level cache by Landscape Proxy, dense heightfields (see FLandscapeHeightfield.h)
+    // Guarded by LandscapeHeightCachesLock, meshing threads read it through FindLandscapeHeightfield
     //UPROPERTY()
-    TMap<ALandscapeProxy*, TSharedPtr<TMap<FIntPoint, float>>> LandscapeHeightCaches;
+    TMap<ALandscapeProxy*, FLandscapeHeightfieldPtr> LandscapeHeightCaches;
+    mutable FRWLock LandscapeHeightCachesLock;
 
     //LoadingCache flag to determine if the height cache on a specific proxy exists. This prevents duplicate async jobs from starting for the same proxy.
     UPROPERTY()
@@ -610,6 +716,8 @@ public:
     // New methods for multiple save file support
     FString GetSaveFileDirectory(const FString& SaveFileName) const;
     FString GetChunkFilePath(const FIntVector& ChunkCoords, const FString& SaveFileName) const;
+    // Region pack that holds this chunk (see FVoxelRegionFile)
+    FString GetRegionFilePath(const FIntVector& ChunkCoords, const FString& SaveFileName) const;
     
     bool DoesSaveFileExist(const FString& SaveFileName) const;
     bool DoesChunkFileExist(const FIntVector& ChunkCoords, const FString& SaveFileName) const;
@@ -618,10 +726,126 @@ public:
     
     bool SaveChunk(const FIntVector& ChunkCoords, const FString& SaveFileName);
     bool LoadChunk(const FIntVector& ChunkCoords, const FString& SaveFileName);
+    bool LoadChunkFromPayload(const FIntVector& ChunkCoords, const TArray<uint8>& Payload, const FString& SaveFileName);
     
     bool SaveAllChunks(const FString& SaveFileName);
     bool LoadAllChunks(const FString& SaveFileName);
 
+    // Non blocking load: files decode on worker threads, a few chunks per frame are handed to the game thread
+    // nearest to the player start first, and meshing goes through the mesh job queue
+    UFUNCTION(BlueprintCallable, Category = "Voxel Serialization")
+    bool LoadAllChunksAsync(const FString& SaveFileName);
+
+    UFUNCTION(BlueprintCallable, Category = "Voxel Serialization")
+    void CancelAsyncChunkLoad();
+
+    UFUNCTION(BlueprintPure, Category = "Voxel Serialization")
+    bool IsLoadingChunks() const { return ActiveChunkLoad.IsValid(); }
+
+    // 0..1, 1 when no load is running
+    UFUNCTION(BlueprintPure, Category = "Voxel Serialization")
+    float GetChunkLoadProgress() const;
+
+    UPROPERTY(BlueprintAssignable, Category = "Voxel Serialization")
+    FOnChunkLoadProgress OnChunkLoadProgress;
+
+    UPROPERTY(BlueprintAssignable, Category = "Voxel Serialization")
+    FOnChunkLoadFinished OnChunkLoadFinished;
+
+    // Game thread budget for moving decoded chunks into their grids
+    UPROPERTY(EditAnywhere, Category="Digger System|Loading", meta=(ClampMin="1"))
+    int32 MaxChunksLoadedPerFrame = 16;
+
+    UPROPERTY(EditAnywhere, Category="Digger System|Loading", meta=(ClampMin="0.1"))
+    float ChunkLoadBudgetMs = 4.0f;
+
+    // Distance streaming (game worlds): chunks farther than StreamingUnloadRadius from every streaming source are
+    // saved if edited and dropped from memory, and come back in once a source is within StreamingLoadRadius.
+    // Sources are the player view points plus anything registered with RegisterStreamingSource.
+    UPROPERTY(EditAnywhere, Category="Digger System|Streaming")
+    bool bEnableChunkStreaming = false;
+
+    UPROPERTY(EditAnywhere, Category="Digger System|Streaming", meta=(ClampMin="0.0", EditCondition="bEnableChunkStreaming"))
+    float StreamingLoadRadius = 20000.0f;
+
+    // Kept at least one chunk beyond StreamingLoadRadius
+    UPROPERTY(EditAnywhere, Category="Digger System|Streaming", meta=(ClampMin="0.0", EditCondition="bEnableChunkStreaming"))
+    float StreamingUnloadRadius = 25000.0f;
+
+    UPROPERTY(EditAnywhere, Category="Digger System|Streaming", meta=(ClampMin="0.05", EditCondition="bEnableChunkStreaming"))
+    float StreamingUpdateInterval = 0.5f;
+
+    UPROPERTY(EditAnywhere, Category="Digger System|Streaming", meta=(ClampMin="1", EditCondition="bEnableChunkStreaming"))
+    int32 MaxChunksEvictedPerUpdate = 8;
+
+    UPROPERTY(EditAnywhere, Category="Digger System|Streaming", meta=(ClampMin="1", EditCondition="bEnableChunkStreaming"))
+    int32 MaxChunksStreamedInPerUpdate = 16;
+
+    // Save that evicted chunks are written to and streamed back from
+    UPROPERTY(EditAnywhere, Category="Digger System|Streaming", meta=(EditCondition="bEnableChunkStreaming"))
+    FString StreamingSaveFileName = TEXT("Default");
+
+    UFUNCTION(BlueprintCallable, Category = "Voxel Serialization")
+    void RegisterStreamingSource(AActor* Source);
+
+    UFUNCTION(BlueprintCallable, Category = "Voxel Serialization")
+    void UnregisterStreamingSource(AActor* Source);
+
+    // Saves (if edited) and unloads the given chunks, returns how many went. Chunks with a mesh job in flight stay.
+    int32 EvictChunks(const TArray<FIntVector>& ChunkCoords);
+    int32 GetNumStreamedOutChunks() const { return StreamedOutChunks.Num(); }
+
+    // Memory the undo / redo history may use. Oldest steps are dropped past this, 0 turns undo off.
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Digger System|Undo", meta=(ClampMin="0"))
+    float UndoMemoryBudgetMB = 64.f;
+
+    // Every voxel change between Begin and End becomes one undo step. Groups nest, the outermost one commits.
+    // Off while strokes are shared (net session or stroke relay): undo only restores voxels locally.
+    UFUNCTION(BlueprintCallable, Category = "Digger System|Undo")
+    void BeginUndoGroup();
+
+    UFUNCTION(BlueprintCallable, Category = "Digger System|Undo")
+    void EndUndoGroup();
+
+    UFUNCTION(BlueprintCallable, Category = "Digger System|Undo")
+    bool UndoVoxelEdit();
+
+    UFUNCTION(BlueprintCallable, Category = "Digger System|Undo")
+    bool RedoVoxelEdit();
+
+    UFUNCTION(BlueprintCallable, Category = "Digger System|Undo")
+    void ClearUndoHistory();
+
+    UFUNCTION(BlueprintPure, Category = "Digger System|Undo")
+    int32 GetNumUndoSteps() const { return UndoJournal.NumUndo(); }
+
+    UFUNCTION(BlueprintPure, Category = "Digger System|Undo")
+    int32 GetNumRedoSteps() const { return UndoJournal.NumRedo(); }
+
+    bool IsRecordingUndo() const { return UndoGroupDepth > 0 && bUndoGroupRecords && !bApplyingNetStrokes; }
+
+    // A grid calls this on its first capture inside the open group, EndUndoGroup only visits these. Any thread.
+    void RegisterUndoGrid(USparseVoxelGrid* Grid);
+
+    // Networked strokes are held this long and then leave as one binary batch (FBrushStrokeCodec), 0 sends next tick
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Digger System|Network", meta=(ClampMin="0"))
+    float StrokeBatchWindow = 0.05f;
+
+    // Sends the queued strokes now instead of waiting for the window
+    void FlushNetBrushStrokes();
+
+    // Applies a batch made by FBrushStrokeCodec::Encode. False if the payload doesn't decode.
+    bool ApplyEncodedBrushStrokes(const TArray<uint8>& Payload);
+
+    // One reliable RPC per batch of strokes, instead of one per stroke per chunk. Server only, clients send
+    // theirs through UDiggerStrokeNetComponent::ServerSendBrushStrokeBatch, which forwards here.
+    UFUNCTION(NetMulticast, Reliable)
+    void MulticastApplyBrushStrokeBatch(const TArray<uint8>& Payload);
+
+    // Also relays batches through digger-network: ours go to the lobby, the lobby's get applied here. Null clears.
+    UFUNCTION(BlueprintCallable, Category="Digger System|Network")
+    void SetStrokeRelay(USocketIOLobbyManager* LobbyManager, const FString& LobbyName);
+
     // Default Save
     TArray<FIntVector> GetAllSavedChunkCoordinates(bool bForceRefresh);
     // Named Save
@@ -703,11 +927,15 @@ public:
     }
     UFUNCTION(BlueprintCallable, Category = "Landscape Tools")
     float GetLandscapeHeightAt(FVector WorldPosition);
-    TSharedPtr<TMap<FIntPoint, float>> GetOrCreateLandscapeHeightCache(ALandscapeProxy* Landscape);
+    FLandscapeHeightfieldPtr FindLandscapeHeightfield(ALandscapeProxy* Landscape) const;
     void PopulateLandscapeHeightCacheAsync(ALandscapeProxy* Landscape);
+    // Marks the heightfield samples under WorldBox stale and schedules a (debounced) async resample
+    void InvalidateLandscapeHeightRegion(const FBox& WorldBox);
     ALandscapeProxy* GetLandscapeProxyAt(const FVector& WorldPos);
     TOptional<float> SampleLandscapeHeight(ALandscapeProxy* Landscape, const FVector& WorldPos, bool bForcePrecise);
     TOptional<float> SampleLandscapeHeight(ALandscapeProxy* Landscape, const FVector& WorldPos);
+    // Bypasses the heightfield and asks the landscape collision directly
+    static TOptional<float> SampleLandscapeHeightDirect(const ALandscapeProxy* Landscape, const FVector& WorldPos);
     // Delete this after it works!!!11!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
     // In DiggerManager.h
     UFUNCTION(CallInEditor, BlueprintCallable, Category = "Debug")
@@ -725,9 +953,143 @@ public:
 
 private:
 
-    std::queue<FBrushStroke> BrushStrokeQueue;
-    const int32 MaxUndoLength = 10; // Example limit
+    // Undo / redo of voxel edits, see BeginUndoGroup
+    FVoxelUndoJournal UndoJournal;
+    int32 UndoGroupDepth = 0;
+    // Decided when the outermost group opens
+    bool bUndoGroupRecords = false;
+    // Grids with a capture in the open group, guarded by UndoGroupGridsMutex
+    TArray<TWeakObjectPtr<USparseVoxelGrid>> UndoGroupGrids;
+    FCriticalSection UndoGroupGridsMutex;
+
+    void ApplyUndoEntry(const FVoxelUndoEntry& Entry, bool bRestoreBefore);
+
+    // Strokes waiting for the next batch, see StrokeBatchWindow
+    TArray<FBrushStroke> PendingNetStrokes;
+    FTimerHandle NetStrokeFlushHandle;
+    // Set while a received batch is applied, so it isn't queued to go out again or recorded for undo
+    bool bApplyingNetStrokes = false;
+
+    // Strokes go to other worlds, through replication or the stroke relay
+    bool IsSharingStrokes() const;
+
+    // Server: gives each joining PlayerController a UDiggerStrokeNetComponent
+    void AddStrokeNetComponent(AGameModeBase* GameMode, APlayerController* Controller);
+    FDelegateHandle PostLoginHandle;
+
+    UPROPERTY(Transient)
+    USocketIOLobbyManager* StrokeRelay = nullptr;
+    FString StrokeRelayLobby;
+    FDelegateHandle StrokeRelayHandle;
+
+    // Multiplayer: the stroke goes out in a batch and every machine (the server included) applies it from there
+    bool ShouldReplicateStrokes() const;
+    bool ShouldRelayStrokes() const;
+    void QueueNetBrushStroke(const FBrushStroke& Stroke);
 
     FTimerHandle ChunkProcessTimerHandle;
+
+    // Mesh job scheduler state, game thread only apart from MeshQueue itself
+    FChunkMeshQueue MeshQueue;
+    TSet<FIntVector> InFlightMeshJobs;
+    TArray<FChunkMeshJobResult> CompletedMeshJobs;
+    FTimerHandle MeshPumpTimerHandle;
+
+    // Keeps generators alive while a background job is using them
+    UPROPERTY()
+    TArray<UMarchingCubes*> InFlightMeshGenerators;
+
+    // Chunk -> time of its last render upload, waiting for a collision cook
+    TMap<FIntVector, double> PendingCollisionCooks;
+
+    // Chunk -> mesh LOD, see bEnableMeshLOD. Chunks not in here mesh at full resolution.
+    TMap<FIntVector, uint8> ChunkMeshLODs;
+    FTimerHandle MeshLODTimerHandle;
+
+    void StartMeshLODUpdates();
+    void UpdateChunkMeshLODs();
+    // View location and pixels per world unit at distance 1 (ViewWidth / (2 tan(FOV / 2)))
+    bool GetLODView(FVector& OutLocation, float& OutProjectionScale) const;
+    int32 GetMaxUsableMeshLOD() const;
+    FVoxelLODTransitions GetChunkLODTransitions(const FIntVector& ChunkCoords, int32 LOD) const;
+
+    // Async chunk load state, see LoadAllChunksAsync
+    TSharedPtr<FChunkLoadQueue, ESPMode::ThreadSafe> ActiveChunkLoad;
+    TSet<FIntVector> ChunkLoadAwaitingMesh;
+    TOptional<FVector> ChunkLoadFocus;
+    int32 ChunkLoadTotal = 0;
+    int32 ChunkLoadApplied = 0;
+    int32 ChunkLoadFailed = 0;
+    FTimerHandle ChunkLoadPumpHandle;
+
+    UVoxelChunk* ApplyDecodedChunk(FDecodedChunkPayload&& Decoded, bool bQueueMesh);
+    void StartChunkLoad(const FString& SaveFileName, const TArray<FIntVector>& ChunkCoords);
+    void ScheduleChunkLoadPump();
+    void PumpChunkLoad();
+    TOptional<FVector> FindChunkLoadFocus() const;
+
+    // Chunk streaming state, see bEnableChunkStreaming. StreamedOutChunks are saved but not resident,
+    // StreamingInFlight are being decoded by StreamingChunkLoad.
+    TSet<FIntVector> StreamedOutChunks;
+    TSet<FIntVector> StreamingInFlight;
+    TSharedPtr<FChunkLoadQueue, ESPMode::ThreadSafe> StreamingChunkLoad;
+    TArray<TWeakObjectPtr<AActor>> StreamingSourceActors;
+    FTimerHandle StreamingTimerHandle;
+
+    void StartChunkStreaming();
+    void UpdateChunkStreaming();
+    void GatherStreamingSourceLocations(TArray<FVector>& OutLocations) const;
+    static float GetDistSqToNearestStreamingSource(const FIntVector& ChunkCoords, const TArray<FVector>& Sources);
+    void ReleaseChunk(UVoxelChunk* Chunk);
+    // Brush passes look chunks up in ChunkMap first; bOutFresh is set for chunks new to this lookup, which are only
+    // created if the strokes would write to them (null otherwise)
+    UVoxelChunk* GetOrCreateBrushChunk(const FIntVector& ChunkCoords, TArrayView<const FBrushStroke> Strokes, bool& bOutFresh);
+    void ReleaseUntouchedBrushChunk(UVoxelChunk* Chunk, bool bFresh);
+    bool RestoreStreamedOutChunk(UVoxelChunk* Chunk);
+
+    void CookDueChunkCollision();
+    void GatherPhysicsActorLocations(TArray<FVector>& OutLocations) const;
+    void DispatchMeshJob(UVoxelChunk* Chunk);
+    void UploadCompletedMeshJobs();
+    void ScheduleMeshPump();
+    TOptional<FVector> GetMeshPriorityViewLocation() const;
+
+    // Landscape heightfield builds / region resamples
+    static FLandscapeHeightfieldPtr BuildLandscapeHeightfield(const ALandscapeProxy* Landscape, float DesiredSpacing);
+    void InstallLandscapeHeightfield(ALandscapeProxy* Landscape, FLandscapeHeightfieldPtr Heightfield);
+    void RebuildDirtyLandscapeHeightRegions();
+
+    // Sample rects waiting for a resample, per proxy
+    TMap<TWeakObjectPtr<ALandscapeProxy>, TArray<FIntRect>> PendingHeightRegions;
+    FTimerHandle HeightRegionRebuildTimerHandle;
+    // Drops the height caches of the loaded chunks that sampled anything under the XY box, and remeshes them if asked
+    void InvalidateChunkHeightCaches(const FBox& WorldBox, bool bRemesh);
+
+    // Spatial index behind GetLandscapeProxyAt. Rebuilt lazily on the game thread once proxies come or go,
+    // worker threads keep using the last built index.
+    FLandscapeProxyIndex LandscapeProxyIndex;
+    mutable FRWLock LandscapeProxyIndexLock;
+    FThreadSafeBool bLandscapeProxyIndexDirty = true;
+
+    void RebuildLandscapeProxyIndex();
+    void RegisterLandscapeProxyIndexHandlers();
+    void UnregisterLandscapeProxyIndexHandlers();
+    void OnWorldActorSpawned(AActor* Actor);
+    void OnWorldActorDestroyed(AActor* Actor);
+    void OnLevelAddedOrRemoved(ULevel* Level, UWorld* InWorld);
+
+    TWeakObjectPtr<UWorld> ProxyIndexWorld;
+    FDelegateHandle ActorSpawnedHandle;
+    FDelegateHandle ActorDestroyedHandle;
+    FDelegateHandle LevelAddedHandle;
+    FDelegateHandle LevelRemovedHandle;
+
+#if WITH_EDITOR
+    void OnLandscapeObjectModified(UObject* Object);
+    FDelegateHandle LandscapeModifiedHandle;
+#endif
+
+public:
+    virtual void BeginDestroy() override;
     
 };
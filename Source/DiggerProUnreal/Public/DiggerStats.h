@@ -0,0 +1,40 @@
+// DiggerStats.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Stats/Stats.h"
+#include "Trace/Trace.h"
+
+// `stat Digger` in game / editor, and a "Digger" channel for Unreal Insights (-trace=cpu,digger)
+DECLARE_STATS_GROUP(TEXT("Digger"), STATGROUP_Digger, STATCAT_Advanced);
+
+UE_TRACE_CHANNEL_EXTERN(DiggerChannel, DIGGERPROUNREAL_API);
+
+// Hot paths
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Apply Brush Strokes"), STAT_DiggerApplyBrushStrokes, STATGROUP_Digger, DIGGERPROUNREAL_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Build Meshing Slab"), STAT_DiggerBuildMeshingSlab, STATGROUP_Digger, DIGGERPROUNREAL_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Generate Mesh"), STAT_DiggerGenerateMesh, STATGROUP_Digger, DIGGERPROUNREAL_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Upload Mesh"), STAT_DiggerUploadMesh, STATGROUP_Digger, DIGGERPROUNREAL_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Detect Islands"), STAT_DiggerDetectIslands, STATGROUP_Digger, DIGGERPROUNREAL_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Sample Landscape Height"), STAT_DiggerSampleLandscapeHeight, STATGROUP_Digger, DIGGERPROUNREAL_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Sample Landscape Height (Precise)"), STAT_DiggerSampleLandscapeHeightPrecise, STATGROUP_Digger, DIGGERPROUNREAL_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Save Chunks"), STAT_DiggerSaveChunks, STATGROUP_Digger, DIGGERPROUNREAL_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Load Chunks"), STAT_DiggerLoadChunks, STATGROUP_Digger, DIGGERPROUNREAL_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Decode Chunk Payloads"), STAT_DiggerDecodeChunks, STATGROUP_Digger, DIGGERPROUNREAL_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Region File IO"), STAT_DiggerRegionFileIO, STATGROUP_Digger, DIGGERPROUNREAL_API);
+
+// Per frame counters, reset every frame
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Voxels Written"), STAT_DiggerVoxelsWritten, STATGROUP_Digger, DIGGERPROUNREAL_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Chunks Remeshed"), STAT_DiggerChunksRemeshed, STATGROUP_Digger, DIGGERPROUNREAL_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Triangles Emitted"), STAT_DiggerTrianglesEmitted, STATGROUP_Digger, DIGGERPROUNREAL_API);
+// Height queries answered, and how many of them (plus heightfield builds) went to the landscape collision
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Landscape Samples"), STAT_DiggerLandscapeSamples, STATGROUP_Digger, DIGGERPROUNREAL_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Landscape Samples (Precise)"), STAT_DiggerPreciseLandscapeSamples, STATGROUP_Digger, DIGGERPROUNREAL_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Bytes Serialized"), STAT_DiggerBytesSerialized, STATGROUP_Digger, DIGGERPROUNREAL_API);
+
+// Cycle stat plus a CPU trace event of the same name on the Digger channel. Any thread.
+#define DIGGER_SCOPE_CYCLE_COUNTER(Stat) \
+	SCOPE_CYCLE_COUNTER(Stat); \
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(Stat, DiggerChannel)
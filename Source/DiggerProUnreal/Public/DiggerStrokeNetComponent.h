@@ -0,0 +1,28 @@
+// DiggerStrokeNetComponent.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "DiggerStrokeNetComponent.generated.h"
+
+// Carries a client's brush stroke batches to the server. A NetMulticast called on a client only runs locally, so
+// clients send through a Server RPC on an actor they own (their PlayerController) and the server multicasts.
+// ADiggerManager adds one to every PlayerController on the server, it then replicates to the owning client.
+UCLASS(ClassGroup=(Digger), meta=(BlueprintSpawnableComponent))
+class DIGGERPROUNREAL_API UDiggerStrokeNetComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UDiggerStrokeNetComponent();
+
+	// Largest batch the server accepts, FBrushStrokeCodec::MaxStrokesPerBatch strokes at their worst case size
+	static constexpr int32 MaxPayloadBytes = 1024 * 128;
+
+	// Payload is a batch made by FBrushStrokeCodec::Encode
+	UFUNCTION(Server, Reliable, WithValidation)
+	void ServerSendBrushStrokeBatch(const TArray<uint8>& Payload);
+
+	// The component on the local player's controller, null if the server hasn't added it (yet)
+	static UDiggerStrokeNetComponent* FindLocal(const UWorld* World);
+};
@@ -0,0 +1,393 @@
+// FBrushStrokeCodec.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FBrushStroke.h"
+
+// Compact wire format for brush strokes, used by the manager's batched multicast and the digger-network relay.
+// digger-network/stroke-codec.js mirrors this layout byte for byte, keep the two in step.
+//
+// Batch:   u8 Version, varuint Count, then Count strokes
+// Stroke:  varuint FieldMask, 3 x varint position delta, then each field whose mask bit is set, in bit order
+//
+// Everything is quantized to fixed steps (see the scales below) and compared against the previous stroke of the
+// batch (the first one against a default FBrushStroke), so a drag that only moves costs a mask byte plus a few
+// bytes of position delta. Scalars are zigzag LEB128 varints, rotation is the engine's 16 bit axis compression.
+struct FBrushStrokeCodec
+{
+	static constexpr uint8 Version = 1;
+	static constexpr int32 MaxStrokesPerBatch = 1024;
+
+	// Quantization steps as "units per step": 0.1 uu for lengths, 0.01 deg for the brush angle
+	static constexpr float DistanceScale = 10.f;
+	static constexpr float StrengthScale = 1000.f;
+	static constexpr float AngleScale = 100.f;
+	static constexpr float ThicknessScale = 100.f;
+
+	enum EField : uint32
+	{
+		Field_Type         = 1 << 0,
+		Field_Flags        = 1 << 1,
+		Field_Radius       = 1 << 2,
+		Field_Strength     = 1 << 3,
+		Field_Falloff      = 1 << 4,
+		Field_Rotation     = 1 << 5,
+		Field_Length       = 1 << 6,
+		Field_Angle        = 1 << 7,
+		Field_Offset       = 1 << 8,
+		Field_CubeExtents  = 1 << 9,
+		Field_TorusInner   = 1 << 10,
+		Field_NumSteps     = 1 << 11,
+		Field_Wall         = 1 << 12,
+		Field_HoleAndLight = 1 << 13,
+		Field_LightColor   = 1 << 14,
+		Field_All          = (1 << 15) - 1
+	};
+
+	enum EFlag : uint8
+	{
+		Flag_Dig           = 1 << 0,
+		Flag_HiddenSeam    = 1 << 1,
+		Flag_AdvancedCube  = 1 << 2,
+		Flag_Spiral        = 1 << 3,
+		Flag_Filled        = 1 << 4
+	};
+
+	// A stroke after quantization, the unit the encoder diffs
+	struct FPacked
+	{
+		int32 Position[3] = { 0, 0, 0 };
+		uint8 Type = 0;
+		uint8 Flags = 0;
+		int32 Radius = 0;
+		int32 Strength = 0;
+		int32 Falloff = 0;
+		uint16 Rotation[3] = { 0, 0, 0 };
+		int32 Length = 0;
+		int32 Angle = 0;
+		int32 Offset[3] = { 0, 0, 0 };
+		int32 CubeExtents[3] = { 0, 0, 0 };
+		int32 TorusInner = 0;
+		int32 NumSteps = 0;
+		int32 Wall = 0;
+		uint8 HoleShape = 0;
+		uint8 LightType = 0;
+		FColor LightColor = FColor::White;
+
+		static FPacked Pack(const FBrushStroke& Stroke)
+		{
+			FPacked Out;
+			PackVector(Stroke.BrushPosition, DistanceScale, Out.Position);
+			Out.Type = (uint8)Stroke.BrushType;
+			Out.Flags = (uint8)((Stroke.bDig ? Flag_Dig : 0)
+				| (Stroke.bHiddenSeam ? Flag_HiddenSeam : 0)
+				| (Stroke.bUseAdvancedCubeBrush ? Flag_AdvancedCube : 0)
+				| (Stroke.bSpiral ? Flag_Spiral : 0)
+				| (Stroke.bIsFilled ? Flag_Filled : 0));
+			Out.Radius = Quantize(Stroke.BrushRadius, DistanceScale);
+			Out.Strength = Quantize(Stroke.BrushStrength, StrengthScale);
+			Out.Falloff = Quantize(Stroke.BrushFalloff, DistanceScale);
+			Out.Rotation[0] = FRotator::CompressAxisToShort(Stroke.BrushRotation.Pitch);
+			Out.Rotation[1] = FRotator::CompressAxisToShort(Stroke.BrushRotation.Yaw);
+			Out.Rotation[2] = FRotator::CompressAxisToShort(Stroke.BrushRotation.Roll);
+			Out.Length = Quantize(Stroke.BrushLength, DistanceScale);
+			Out.Angle = Quantize(Stroke.BrushAngle, AngleScale);
+			PackVector(Stroke.BrushOffset, DistanceScale, Out.Offset);
+			PackVector(FVector(Stroke.AdvancedCubeHalfExtentX, Stroke.AdvancedCubeHalfExtentY, Stroke.AdvancedCubeHalfExtentZ), DistanceScale, Out.CubeExtents);
+			Out.TorusInner = Quantize(Stroke.TorusInnerRadius, DistanceScale);
+			Out.NumSteps = Stroke.NumSteps;
+			Out.Wall = Quantize(Stroke.WallThickness, ThicknessScale);
+			Out.HoleShape = (uint8)Stroke.HoleShape;
+			Out.LightType = (uint8)Stroke.LightType;
+			Out.LightColor = Stroke.LightColor.ToFColor(true);
+			return Out;
+		}
+
+		void Unpack(FBrushStroke& Stroke) const
+		{
+			Stroke.BrushPosition = UnpackVector(Position, DistanceScale);
+			Stroke.BrushType = (EVoxelBrushType)Type;
+			Stroke.bDig = (Flags & Flag_Dig) != 0;
+			Stroke.bHiddenSeam = (Flags & Flag_HiddenSeam) != 0;
+			Stroke.bUseAdvancedCubeBrush = (Flags & Flag_AdvancedCube) != 0;
+			Stroke.bSpiral = (Flags & Flag_Spiral) != 0;
+			Stroke.bIsFilled = (Flags & Flag_Filled) != 0;
+			Stroke.BrushRadius = Radius / DistanceScale;
+			Stroke.BrushStrength = Strength / StrengthScale;
+			Stroke.BrushFalloff = Falloff / DistanceScale;
+			Stroke.BrushRotation = FRotator(
+				FRotator::DecompressAxisFromShort(Rotation[0]),
+				FRotator::DecompressAxisFromShort(Rotation[1]),
+				FRotator::DecompressAxisFromShort(Rotation[2]));
+			Stroke.BrushLength = Length / DistanceScale;
+			Stroke.BrushAngle = Angle / AngleScale;
+			Stroke.BrushOffset = UnpackVector(Offset, DistanceScale);
+			const FVector Extents = UnpackVector(CubeExtents, DistanceScale);
+			Stroke.AdvancedCubeHalfExtentX = Extents.X;
+			Stroke.AdvancedCubeHalfExtentY = Extents.Y;
+			Stroke.AdvancedCubeHalfExtentZ = Extents.Z;
+			Stroke.TorusInnerRadius = TorusInner / DistanceScale;
+			Stroke.NumSteps = NumSteps;
+			Stroke.WallThickness = Wall / ThicknessScale;
+			Stroke.HoleShape = (EHoleShapeType)HoleShape;
+			Stroke.LightType = (ELightBrushType)LightType;
+			Stroke.LightColor = FLinearColor(LightColor);
+			// Shape objects are per machine, the receiver resolves its own from BrushType
+			Stroke.BrushShape = nullptr;
+		}
+
+		uint32 DiffMask(const FPacked& Other) const
+		{
+			uint32 Mask = 0;
+			Mask |= Type != Other.Type ? Field_Type : 0;
+			Mask |= Flags != Other.Flags ? Field_Flags : 0;
+			Mask |= Radius != Other.Radius ? Field_Radius : 0;
+			Mask |= Strength != Other.Strength ? Field_Strength : 0;
+			Mask |= Falloff != Other.Falloff ? Field_Falloff : 0;
+			Mask |= FMemory::Memcmp(Rotation, Other.Rotation, sizeof(Rotation)) != 0 ? Field_Rotation : 0;
+			Mask |= Length != Other.Length ? Field_Length : 0;
+			Mask |= Angle != Other.Angle ? Field_Angle : 0;
+			Mask |= FMemory::Memcmp(Offset, Other.Offset, sizeof(Offset)) != 0 ? Field_Offset : 0;
+			Mask |= FMemory::Memcmp(CubeExtents, Other.CubeExtents, sizeof(CubeExtents)) != 0 ? Field_CubeExtents : 0;
+			Mask |= TorusInner != Other.TorusInner ? Field_TorusInner : 0;
+			Mask |= NumSteps != Other.NumSteps ? Field_NumSteps : 0;
+			Mask |= Wall != Other.Wall ? Field_Wall : 0;
+			Mask |= (HoleShape != Other.HoleShape || LightType != Other.LightType) ? Field_HoleAndLight : 0;
+			Mask |= LightColor != Other.LightColor ? Field_LightColor : 0;
+			return Mask;
+		}
+	};
+
+	// Appends a whole batch to OutBytes
+	static void Encode(TArrayView<const FBrushStroke> Strokes, TArray<uint8>& OutBytes)
+	{
+		const int32 Count = FMath::Min(Strokes.Num(), MaxStrokesPerBatch);
+		OutBytes.Reserve(OutBytes.Num() + 4 + Count * 8);
+		OutBytes.Add(Version);
+		WriteVarUInt(OutBytes, (uint32)Count);
+
+		FPacked Previous = FPacked::Pack(FBrushStroke());
+		for (int32 Index = 0; Index < Count; ++Index)
+		{
+			const FPacked Packed = FPacked::Pack(Strokes[Index]);
+			const uint32 Mask = Packed.DiffMask(Previous);
+			WriteVarUInt(OutBytes, Mask);
+			for (int32 Axis = 0; Axis < 3; ++Axis)
+			{
+				WriteVarInt(OutBytes, (int32)((int64)Packed.Position[Axis] - Previous.Position[Axis]));
+			}
+
+			if (Mask & Field_Type) { OutBytes.Add(Packed.Type); }
+			if (Mask & Field_Flags) { OutBytes.Add(Packed.Flags); }
+			if (Mask & Field_Radius) { WriteVarInt(OutBytes, Packed.Radius); }
+			if (Mask & Field_Strength) { WriteVarInt(OutBytes, Packed.Strength); }
+			if (Mask & Field_Falloff) { WriteVarInt(OutBytes, Packed.Falloff); }
+			if (Mask & Field_Rotation)
+			{
+				for (uint16 Axis : Packed.Rotation)
+				{
+					OutBytes.Add((uint8)(Axis & 0xFF));
+					OutBytes.Add((uint8)(Axis >> 8));
+				}
+			}
+			if (Mask & Field_Length) { WriteVarInt(OutBytes, Packed.Length); }
+			if (Mask & Field_Angle) { WriteVarInt(OutBytes, Packed.Angle); }
+			if (Mask & Field_Offset) { WriteVarInt3(OutBytes, Packed.Offset); }
+			if (Mask & Field_CubeExtents) { WriteVarInt3(OutBytes, Packed.CubeExtents); }
+			if (Mask & Field_TorusInner) { WriteVarInt(OutBytes, Packed.TorusInner); }
+			if (Mask & Field_NumSteps) { WriteVarInt(OutBytes, Packed.NumSteps); }
+			if (Mask & Field_Wall) { WriteVarInt(OutBytes, Packed.Wall); }
+			if (Mask & Field_HoleAndLight)
+			{
+				OutBytes.Add(Packed.HoleShape);
+				OutBytes.Add(Packed.LightType);
+			}
+			if (Mask & Field_LightColor)
+			{
+				OutBytes.Add(Packed.LightColor.R);
+				OutBytes.Add(Packed.LightColor.G);
+				OutBytes.Add(Packed.LightColor.B);
+				OutBytes.Add(Packed.LightColor.A);
+			}
+
+			Previous = Packed;
+		}
+	}
+
+	// False (and OutStrokes untouched) on a truncated, oversized or unknown payload. Payloads come off the wire.
+	static bool Decode(TArrayView<const uint8> Bytes, TArray<FBrushStroke>& OutStrokes)
+	{
+		FReader Reader(Bytes);
+		uint32 Count = 0;
+		if (Reader.ReadByte() != Version || !Reader.ReadVarUInt(Count) || Count > (uint32)MaxStrokesPerBatch)
+		{
+			return false;
+		}
+
+		TArray<FBrushStroke> Decoded;
+		Decoded.Reserve(Count);
+		FPacked Current = FPacked::Pack(FBrushStroke());
+		for (uint32 Index = 0; Index < Count; ++Index)
+		{
+			uint32 Mask = 0;
+			if (!Reader.ReadVarUInt(Mask) || (Mask & ~(uint32)Field_All) != 0)
+			{
+				return false;
+			}
+			for (int32 Axis = 0; Axis < 3; ++Axis)
+			{
+				int32 Delta = 0;
+				Reader.ReadVarInt(Delta);
+				Current.Position[Axis] = (int32)((int64)Current.Position[Axis] + Delta);
+			}
+
+			if (Mask & Field_Type) { Current.Type = Reader.ReadByte(); }
+			if (Mask & Field_Flags) { Current.Flags = Reader.ReadByte(); }
+			if (Mask & Field_Radius) { Reader.ReadVarInt(Current.Radius); }
+			if (Mask & Field_Strength) { Reader.ReadVarInt(Current.Strength); }
+			if (Mask & Field_Falloff) { Reader.ReadVarInt(Current.Falloff); }
+			if (Mask & Field_Rotation)
+			{
+				for (uint16& Axis : Current.Rotation)
+				{
+					const uint8 Low = Reader.ReadByte();
+					Axis = (uint16)(Low | (Reader.ReadByte() << 8));
+				}
+			}
+			if (Mask & Field_Length) { Reader.ReadVarInt(Current.Length); }
+			if (Mask & Field_Angle) { Reader.ReadVarInt(Current.Angle); }
+			if (Mask & Field_Offset) { Reader.ReadVarInt3(Current.Offset); }
+			if (Mask & Field_CubeExtents) { Reader.ReadVarInt3(Current.CubeExtents); }
+			if (Mask & Field_TorusInner) { Reader.ReadVarInt(Current.TorusInner); }
+			if (Mask & Field_NumSteps) { Reader.ReadVarInt(Current.NumSteps); }
+			if (Mask & Field_Wall) { Reader.ReadVarInt(Current.Wall); }
+			if (Mask & Field_HoleAndLight)
+			{
+				Current.HoleShape = Reader.ReadByte();
+				Current.LightType = Reader.ReadByte();
+			}
+			if (Mask & Field_LightColor)
+			{
+				Current.LightColor.R = Reader.ReadByte();
+				Current.LightColor.G = Reader.ReadByte();
+				Current.LightColor.B = Reader.ReadByte();
+				Current.LightColor.A = Reader.ReadByte();
+			}
+
+			if (Reader.bError
+				|| Current.Type > (uint8)EVoxelBrushType::Light
+				|| Current.HoleShape > (uint8)EHoleShapeType::Stairs
+				|| Current.LightType > (uint8)ELightBrushType::Directional)
+			{
+				return false;
+			}
+			Current.Unpack(Decoded.AddDefaulted_GetRef());
+		}
+
+		if (Reader.Offset != Bytes.Num())
+		{
+			return false;
+		}
+		OutStrokes.Append(MoveTemp(Decoded));
+		return true;
+	}
+
+	// What every receiver will see for this stroke. Apply this locally too so the sender doesn't drift from its peers.
+	static FBrushStroke Quantized(const FBrushStroke& Stroke)
+	{
+		FBrushStroke Out = Stroke;
+		FPacked::Pack(Stroke).Unpack(Out);
+		Out.BrushShape = Stroke.BrushShape;
+		return Out;
+	}
+
+private:
+	static int32 Quantize(double Value, float Scale)
+	{
+		return (int32)FMath::RoundToDouble(FMath::Clamp(Value * Scale, (double)MIN_int32, (double)MAX_int32));
+	}
+
+	static void PackVector(const FVector& Value, float Scale, int32 (&Out)[3])
+	{
+		Out[0] = Quantize(Value.X, Scale);
+		Out[1] = Quantize(Value.Y, Scale);
+		Out[2] = Quantize(Value.Z, Scale);
+	}
+
+	static FVector UnpackVector(const int32 (&Packed)[3], float Scale)
+	{
+		return FVector(Packed[0], Packed[1], Packed[2]) / Scale;
+	}
+
+	static void WriteVarUInt(TArray<uint8>& Out, uint32 Value)
+	{
+		while (Value >= 0x80)
+		{
+			Out.Add((uint8)(Value | 0x80));
+			Value >>= 7;
+		}
+		Out.Add((uint8)Value);
+	}
+
+	static void WriteVarInt(TArray<uint8>& Out, int32 Value)
+	{
+		WriteVarUInt(Out, ((uint32)Value << 1) ^ (uint32)(Value >> 31));
+	}
+
+	static void WriteVarInt3(TArray<uint8>& Out, const int32 (&Values)[3])
+	{
+		WriteVarInt(Out, Values[0]);
+		WriteVarInt(Out, Values[1]);
+		WriteVarInt(Out, Values[2]);
+	}
+
+	// Reads past the end set bError and return zeros, so the decoder can check once per stroke
+	struct FReader
+	{
+		TArrayView<const uint8> Bytes;
+		int32 Offset = 0;
+		bool bError = false;
+
+		explicit FReader(TArrayView<const uint8> InBytes) : Bytes(InBytes) {}
+
+		uint8 ReadByte()
+		{
+			if (Offset >= Bytes.Num())
+			{
+				bError = true;
+				return 0;
+			}
+			return Bytes[Offset++];
+		}
+
+		bool ReadVarUInt(uint32& OutValue)
+		{
+			OutValue = 0;
+			for (int32 Shift = 0; Shift < 35; Shift += 7)
+			{
+				const uint8 Byte = ReadByte();
+				OutValue |= (uint32)(Byte & 0x7F) << Shift;
+				if ((Byte & 0x80) == 0)
+				{
+					return !bError;
+				}
+			}
+			bError = true;
+			return false;
+		}
+
+		void ReadVarInt(int32& OutValue)
+		{
+			uint32 Raw = 0;
+			ReadVarUInt(Raw);
+			OutValue = (int32)(Raw >> 1) ^ -(int32)(Raw & 1);
+		}
+
+		void ReadVarInt3(int32 (&OutValues)[3])
+		{
+			ReadVarInt(OutValues[0]);
+			ReadVarInt(OutValues[1]);
+			ReadVarInt(OutValues[2]);
+		}
+	};
+};
@@ -0,0 +1,98 @@
+// FChunkLoadQueue.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FSpawnedHoleData.h"
+#include "SparseVoxelGrid.h"
+#include "VoxelConversion.h"
+#include "HAL/ThreadSafeBool.h"
+#include "Misc/ScopeLock.h"
+
+// A chunk decoded off the game thread, waiting to be moved into its UVoxelChunk
+struct FDecodedChunkPayload
+{
+	FIntVector ChunkCoords = FIntVector::ZeroValue;
+	FVoxelBrickMap Voxels;
+	TArray<FSpawnedHoleData> Holes;
+};
+
+// Hand-off between the async load workers and the game thread. Workers push decoded chunks as each region
+// file finishes, the game thread pops a few per frame, nearest to the load focus first.
+// Shared by pointer so a worker that outlives its manager still has somewhere valid to write.
+struct FChunkLoadQueue
+{
+	void Push(TArray<FDecodedChunkPayload>&& Chunks)
+	{
+		FScopeLock Lock(&QueueLock);
+		Ready.Append(MoveTemp(Chunks));
+		bNeedsSort = true;
+	}
+
+	void AddFailed(int32 Count)
+	{
+		FScopeLock Lock(&QueueLock);
+		Failed += Count;
+	}
+
+	void MarkDecodeFinished()
+	{
+		FScopeLock Lock(&QueueLock);
+		bDecodeFinished = true;
+	}
+
+	bool IsDecodeFinished() const
+	{
+		FScopeLock Lock(&QueueLock);
+		return bDecodeFinished;
+	}
+
+	int32 NumReady() const
+	{
+		FScopeLock Lock(&QueueLock);
+		return Ready.Num();
+	}
+
+	int32 NumFailed() const
+	{
+		FScopeLock Lock(&QueueLock);
+		return Failed;
+	}
+
+	// Workers check this between files and bail out early
+	void Cancel() { bCancelled = true; }
+	bool IsCancelled() const { return bCancelled; }
+
+	// Nearest chunk to Focus (any order without one). Sorting only happens after new chunks arrived.
+	bool PopNearest(const TOptional<FVector>& Focus, FDecodedChunkPayload& OutChunk)
+	{
+		FScopeLock Lock(&QueueLock);
+		if (Ready.Num() == 0)
+		{
+			return false;
+		}
+
+		if (bNeedsSort && Focus.IsSet())
+		{
+			const FVector FocusLocation = Focus.GetValue();
+			const FVector HalfChunk(FVoxelConversion::ChunkWorldSize * 0.5f);
+			// Farthest first, so the nearest one pops off the end
+			Ready.Sort([&FocusLocation, &HalfChunk](const FDecodedChunkPayload& A, const FDecodedChunkPayload& B)
+			{
+				return FVector::DistSquared(FVoxelConversion::ChunkToWorld(A.ChunkCoords) + HalfChunk, FocusLocation)
+					> FVector::DistSquared(FVoxelConversion::ChunkToWorld(B.ChunkCoords) + HalfChunk, FocusLocation);
+			});
+		}
+		bNeedsSort = false;
+
+		OutChunk = Ready.Pop(false);
+		return true;
+	}
+
+private:
+	TArray<FDecodedChunkPayload> Ready;
+	int32 Failed = 0;
+	bool bDecodeFinished = false;
+	bool bNeedsSort = false;
+	FThreadSafeBool bCancelled;
+	mutable FCriticalSection QueueLock;
+};
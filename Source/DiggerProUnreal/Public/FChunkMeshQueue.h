@@ -0,0 +1,125 @@
+// FChunkMeshQueue.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/ScopeLock.h"
+#include "Voxel/ChunkHeightCache.h"
+
+class UMarchingCubes;
+
+// Set of chunks waiting for a remesh. Marking a chunk that is already queued just refreshes its
+// timestamp, so a burst of brush dabs over one chunk costs one mesh job instead of one per dab.
+// MarkDirty can come from any thread (voxel writes), picking happens on the game thread.
+struct FChunkMeshQueue
+{
+	struct FEntry
+	{
+		double FirstDirtyTime = 0.0;
+		double LastDirtyTime = 0.0;
+		int32 DirtyCount = 0;
+	};
+
+	void MarkDirty(const FIntVector& ChunkCoords, double Now)
+	{
+		FScopeLock Lock(&QueueLock);
+		FEntry& Entry = Pending.FindOrAdd(ChunkCoords);
+		if (Entry.DirtyCount == 0)
+		{
+			Entry.FirstDirtyTime = Now;
+		}
+		Entry.LastDirtyTime = Now;
+		++Entry.DirtyCount;
+	}
+
+	void Remove(const FIntVector& ChunkCoords)
+	{
+		FScopeLock Lock(&QueueLock);
+		Pending.Remove(ChunkCoords);
+	}
+
+	void Reset()
+	{
+		FScopeLock Lock(&QueueLock);
+		Pending.Reset();
+	}
+
+	int32 Num() const
+	{
+		FScopeLock Lock(&QueueLock);
+		return Pending.Num();
+	}
+
+	// Removes and returns up to MaxCount chunks, best first. Priority is DistanceScore (viewer distance,
+	// lower = closer) plus a penalty that grows with the time since the chunk was last touched, so the spot
+	// being dug right now wins over an old edit at the same distance. Anything waiting longer than
+	// MaxWaitSeconds jumps the queue so far away chunks can't starve. Chunks rejected by CanDispatch stay queued.
+	template <typename DistanceScoreType, typename CanDispatchType>
+	void PopBest(int32 MaxCount, double Now, float RecencyWeight, float MaxWaitSeconds,
+		DistanceScoreType&& DistanceScore, CanDispatchType&& CanDispatch, TArray<FIntVector>& OutChunks)
+	{
+		OutChunks.Reset();
+		if (MaxCount <= 0)
+		{
+			return;
+		}
+
+		FScopeLock Lock(&QueueLock);
+		if (Pending.Num() == 0)
+		{
+			return;
+		}
+
+		struct FCandidate
+		{
+			float Score;
+			FIntVector Coords;
+		};
+		TArray<FCandidate> Candidates;
+		Candidates.Reserve(Pending.Num());
+
+		for (const TPair<FIntVector, FEntry>& Pair : Pending)
+		{
+			if (!CanDispatch(Pair.Key))
+			{
+				continue;
+			}
+
+			float Score = DistanceScore(Pair.Key);
+			Score += RecencyWeight * (float)(Now - Pair.Value.LastDirtyTime);
+			if (Now - Pair.Value.FirstDirtyTime > MaxWaitSeconds)
+			{
+				Score -= 1.0e6f;
+			}
+			Candidates.Add({ Score, Pair.Key });
+		}
+
+		if (Candidates.Num() > MaxCount)
+		{
+			Candidates.Sort([](const FCandidate& A, const FCandidate& B) { return A.Score < B.Score; });
+			Candidates.SetNum(MaxCount, false);
+		}
+
+		for (const FCandidate& Candidate : Candidates)
+		{
+			Pending.Remove(Candidate.Coords);
+			OutChunks.Add(Candidate.Coords);
+		}
+	}
+
+private:
+	TMap<FIntVector, FEntry> Pending;
+	mutable FCriticalSection QueueLock;
+};
+
+// A finished background mesh job waiting for its game thread upload
+struct FChunkMeshJobResult
+{
+	FIntVector ChunkCoords = FIntVector::ZeroValue;
+	int32 SectionIndex = INDEX_NONE;
+	TWeakObjectPtr<UMarchingCubes> Generator;
+	// The height cache the job meshed against, stale if the generator's has been dropped or rebuilt since
+	FChunkHeightCachePtr Heights;
+	TArray<FVector> Vertices;
+	TArray<int32> Triangles;
+	TArray<FVector> Normals;
+};
@@ -0,0 +1,185 @@
+// FLandscapeHeightfield.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/ThreadSafeCounter.h"
+
+// Dense, row-major copy of one landscape proxy's heights.
+// Built once off the game thread and sampled with bilinear interpolation, no hashing involved.
+// Regions can be marked dirty (landscape edits); samples touching a dirty tile report unset so the
+// caller falls back to a precise query until the region has been resampled.
+struct FLandscapeHeightfield
+{
+	static constexpr int32 TileSize = 32;
+
+	// World XY of sample (0,0) and the distance between samples
+	FVector2D Origin = FVector2D::ZeroVector;
+	float Spacing = 100.0f;
+
+	int32 SizeX = 0;
+	int32 SizeY = 0;
+
+	// Heights[Y * SizeX + X], NaN where the landscape had no height (holes / outside)
+	TArray<float> Heights;
+
+	void Init(const FVector2D& InOrigin, float InSpacing, int32 InSizeX, int32 InSizeY)
+	{
+		Origin = InOrigin;
+		Spacing = FMath::Max(InSpacing, KINDA_SMALL_NUMBER);
+		SizeX = FMath::Max(InSizeX, 0);
+		SizeY = FMath::Max(InSizeY, 0);
+		Heights.Init(NAN, SizeX * SizeY);
+
+		TilesX = FMath::DivideAndRoundUp(FMath::Max(SizeX, 1), TileSize);
+		TilesY = FMath::DivideAndRoundUp(FMath::Max(SizeY, 1), TileSize);
+		DirtyTiles.Init(0, TilesX * TilesY);
+		NumDirtyTiles.Reset();
+	}
+
+	bool IsValid() const { return SizeX > 1 && SizeY > 1 && Heights.Num() == SizeX * SizeY; }
+
+	FVector2D GetSampleLocation(int32 X, int32 Y) const
+	{
+		return Origin + FVector2D(X * Spacing, Y * Spacing);
+	}
+
+	TOptional<float> Sample(float WorldX, float WorldY) const
+	{
+		if (!IsValid())
+		{
+			return TOptional<float>();
+		}
+
+		const float GridX = (WorldX - Origin.X) / Spacing;
+		const float GridY = (WorldY - Origin.Y) / Spacing;
+		if (GridX < 0.0f || GridY < 0.0f || GridX > SizeX - 1 || GridY > SizeY - 1)
+		{
+			return TOptional<float>();
+		}
+
+		const int32 X0 = FMath::Min(FMath::FloorToInt(GridX), SizeX - 2);
+		const int32 Y0 = FMath::Min(FMath::FloorToInt(GridY), SizeY - 2);
+
+		// All four corners, a sample straddling a tile border reads from up to four tiles
+		if (NumDirtyTiles.GetValue() > 0 &&
+			(IsTileDirty(X0, Y0) || IsTileDirty(X0 + 1, Y0) || IsTileDirty(X0, Y0 + 1) || IsTileDirty(X0 + 1, Y0 + 1)))
+		{
+			return TOptional<float>();
+		}
+
+		const float FracX = GridX - X0;
+		const float FracY = GridY - Y0;
+
+		const int32 Row0 = Y0 * SizeX + X0;
+		const int32 Row1 = Row0 + SizeX;
+		const float H00 = Heights[Row0];
+		const float H10 = Heights[Row0 + 1];
+		const float H01 = Heights[Row1];
+		const float H11 = Heights[Row1 + 1];
+
+		// Any missing corner means we can't interpolate safely
+		if (FMath::IsNaN(H00) || FMath::IsNaN(H10) || FMath::IsNaN(H01) || FMath::IsNaN(H11))
+		{
+			return TOptional<float>();
+		}
+
+		const float H0 = FMath::Lerp(H00, H10, FracX);
+		const float H1 = FMath::Lerp(H01, H11, FracX);
+		return FMath::Lerp(H0, H1, FracY);
+	}
+
+	TOptional<float> Sample(const FVector& WorldPos) const
+	{
+		return Sample(WorldPos.X, WorldPos.Y);
+	}
+
+	// Marks every tile overlapping the XY box dirty and returns the covered sample rect (inclusive). False if no overlap.
+	bool MarkRegionDirty(const FBox& WorldBox, FIntRect& OutSampleRect)
+	{
+		if (!IsValid())
+		{
+			return false;
+		}
+
+		const int32 MinX = FMath::Max(0, FMath::FloorToInt((WorldBox.Min.X - Origin.X) / Spacing));
+		const int32 MinY = FMath::Max(0, FMath::FloorToInt((WorldBox.Min.Y - Origin.Y) / Spacing));
+		const int32 MaxX = FMath::Min(SizeX - 1, FMath::CeilToInt((WorldBox.Max.X - Origin.X) / Spacing));
+		const int32 MaxY = FMath::Min(SizeY - 1, FMath::CeilToInt((WorldBox.Max.Y - Origin.Y) / Spacing));
+		if (MinX > MaxX || MinY > MaxY)
+		{
+			return false;
+		}
+
+		const int32 TileMinX = MinX / TileSize;
+		const int32 TileMinY = MinY / TileSize;
+		const int32 TileMaxX = MaxX / TileSize;
+		const int32 TileMaxY = MaxY / TileSize;
+
+		for (int32 TY = TileMinY; TY <= TileMaxY; ++TY)
+		{
+			for (int32 TX = TileMinX; TX <= TileMaxX; ++TX)
+			{
+				uint8& Flag = DirtyTiles[TY * TilesX + TX];
+				if (!Flag)
+				{
+					Flag = 1;
+					NumDirtyTiles.Increment();
+				}
+			}
+		}
+
+		// Resample whole tiles so clearing the flags afterwards is exact
+		OutSampleRect.Min = FIntPoint(TileMinX * TileSize, TileMinY * TileSize);
+		OutSampleRect.Max = FIntPoint(FMath::Min(SizeX - 1, (TileMaxX + 1) * TileSize - 1), FMath::Min(SizeY - 1, (TileMaxY + 1) * TileSize - 1));
+		return true;
+	}
+
+	// Writes resampled heights for an inclusive sample rect (row-major within the rect) and clears its dirty tiles
+	void WriteRegion(const FIntRect& SampleRect, const TArray<float>& RegionHeights)
+	{
+		const int32 Width = SampleRect.Max.X - SampleRect.Min.X + 1;
+		const int32 Height = SampleRect.Max.Y - SampleRect.Min.Y + 1;
+		if (!IsValid() || Width <= 0 || Height <= 0 || RegionHeights.Num() != Width * Height)
+		{
+			return;
+		}
+
+		for (int32 Y = 0; Y < Height; ++Y)
+		{
+			FMemory::Memcpy(&Heights[(SampleRect.Min.Y + Y) * SizeX + SampleRect.Min.X], &RegionHeights[Y * Width], Width * sizeof(float));
+		}
+
+		// Heights must be visible before the tiles read as clean again
+		FPlatformMisc::MemoryBarrier();
+
+		for (int32 TY = SampleRect.Min.Y / TileSize; TY <= SampleRect.Max.Y / TileSize; ++TY)
+		{
+			for (int32 TX = SampleRect.Min.X / TileSize; TX <= SampleRect.Max.X / TileSize; ++TX)
+			{
+				uint8& Flag = DirtyTiles[TY * TilesX + TX];
+				if (Flag)
+				{
+					Flag = 0;
+					NumDirtyTiles.Decrement();
+				}
+			}
+		}
+	}
+
+	bool HasDirtyRegions() const { return NumDirtyTiles.GetValue() > 0; }
+
+	SIZE_T GetAllocatedSize() const { return Heights.GetAllocatedSize() + DirtyTiles.GetAllocatedSize(); }
+
+private:
+	bool IsTileDirty(int32 X, int32 Y) const
+	{
+		return DirtyTiles[(Y / TileSize) * TilesX + (X / TileSize)] != 0;
+	}
+
+	int32 TilesX = 0;
+	int32 TilesY = 0;
+	TArray<uint8> DirtyTiles;
+	FThreadSafeCounter NumDirtyTiles;
+};
+
+typedef TSharedPtr<FLandscapeHeightfield, ESPMode::ThreadSafe> FLandscapeHeightfieldPtr;
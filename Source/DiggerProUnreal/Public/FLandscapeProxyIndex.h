@@ -0,0 +1,122 @@
+// FLandscapeProxyIndex.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "LandscapeProxy.h"
+
+// Uniform 2D grid over landscape proxy XY bounds, so "which proxy is under this point" is a single
+// cell probe plus a couple of box tests instead of an actor iteration over the whole world.
+// The cell size follows the proxies themselves (World Partition streaming proxies are all the same size),
+// so a proxy overlaps at most a handful of cells.
+// Not thread safe by itself, ADiggerManager guards it with LandscapeProxyIndexLock.
+struct FLandscapeProxyIndex
+{
+	struct FEntry
+	{
+		TWeakObjectPtr<ALandscapeProxy> Proxy;
+		FBox2D Bounds;
+	};
+
+	void Reset()
+	{
+		Entries.Reset();
+		Cells.Reset();
+		CellSize = 0.0f;
+	}
+
+	// Rebuilds from scratch, cell size = average proxy XY extent
+	void Build(const TArray<ALandscapeProxy*>& Proxies)
+	{
+		Reset();
+
+		TArray<FEntry> NewEntries;
+		NewEntries.Reserve(Proxies.Num());
+		double ExtentSum = 0.0;
+		for (ALandscapeProxy* Proxy : Proxies)
+		{
+			if (!Proxy)
+			{
+				continue;
+			}
+			const FBox Box = Proxy->GetComponentsBoundingBox();
+			if (!Box.IsValid)
+			{
+				continue;
+			}
+			const FBox2D Bounds(FVector2D(Box.Min.X, Box.Min.Y), FVector2D(Box.Max.X, Box.Max.Y));
+			NewEntries.Add({ Proxy, Bounds });
+			ExtentSum += FMath::Max(Bounds.GetSize().X, Bounds.GetSize().Y);
+		}
+
+		CellSize = NewEntries.Num() > 0 ? FMath::Max((float)(ExtentSum / NewEntries.Num()), 100.0f) : DefaultCellSize;
+		for (const FEntry& Entry : NewEntries)
+		{
+			Add(Entry.Proxy.Get(), Entry.Bounds);
+		}
+	}
+
+	void Add(ALandscapeProxy* Proxy, const FBox2D& Bounds)
+	{
+		if (CellSize <= 0.0f)
+		{
+			CellSize = DefaultCellSize;
+		}
+
+		const int32 EntryIndex = Entries.Add({ Proxy, Bounds });
+		const FIntPoint MinCell = ToCell(Bounds.Min);
+		const FIntPoint MaxCell = ToCell(Bounds.Max);
+		for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+		{
+			for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+			{
+				Cells.FindOrAdd(FIntPoint(X, Y)).Add(EntryIndex);
+			}
+		}
+	}
+
+	ALandscapeProxy* Find(const FVector& WorldPos) const
+	{
+		if (Entries.Num() == 0)
+		{
+			return nullptr;
+		}
+
+		const FVector2D Point(WorldPos.X, WorldPos.Y);
+		const TArray<int32>* Cell = Cells.Find(ToCell(Point));
+		if (!Cell)
+		{
+			return nullptr;
+		}
+
+		for (const int32 EntryIndex : *Cell)
+		{
+			const FEntry& Entry = Entries[EntryIndex];
+			// Same strict XY test as FBox::IsInsideXY
+			if (Point.X > Entry.Bounds.Min.X && Point.X < Entry.Bounds.Max.X &&
+				Point.Y > Entry.Bounds.Min.Y && Point.Y < Entry.Bounds.Max.Y)
+			{
+				ALandscapeProxy* Proxy = Entry.Proxy.Get();
+				if (Proxy && IsValid(Proxy))
+				{
+					return Proxy;
+				}
+			}
+		}
+		return nullptr;
+	}
+
+	int32 Num() const { return Entries.Num(); }
+	const TArray<FEntry>& GetEntries() const { return Entries; }
+
+private:
+	static constexpr float DefaultCellSize = 51200.0f;
+
+	FIntPoint ToCell(const FVector2D& Point) const
+	{
+		return FIntPoint(FMath::FloorToInt(Point.X / CellSize), FMath::FloorToInt(Point.Y / CellSize));
+	}
+
+	float CellSize = 0.0f;
+	TArray<FEntry> Entries;
+	TMap<FIntPoint, TArray<int32>> Cells;
+};
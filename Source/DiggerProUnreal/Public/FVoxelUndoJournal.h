@@ -0,0 +1,147 @@
+// FVoxelUndoJournal.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include <limits>
+
+// Old and new SDF of every voxel one edit changed in one chunk. Local coords are packed as int16 triples
+// (chunk storage is [-2, N], far inside int16), a voxel that didn't exist on one side is stored as NaN.
+struct FVoxelChunkDelta
+{
+	FIntVector ChunkCoords = FIntVector::ZeroValue;
+	TArray<int16> Coords;
+	TArray<float> Before;
+	TArray<float> After;
+
+	static float Absent() { return std::numeric_limits<float>::quiet_NaN(); }
+	static bool IsAbsent(float Value) { return FMath::IsNaN(Value); }
+
+	void Add(const FIntVector& Voxel, float InBefore, float InAfter)
+	{
+		Coords.Add((int16)Voxel.X);
+		Coords.Add((int16)Voxel.Y);
+		Coords.Add((int16)Voxel.Z);
+		Before.Add(InBefore);
+		After.Add(InAfter);
+	}
+
+	int32 Num() const { return Before.Num(); }
+
+	FIntVector GetVoxel(int32 Index) const
+	{
+		return FIntVector(Coords[Index * 3], Coords[Index * 3 + 1], Coords[Index * 3 + 2]);
+	}
+
+	SIZE_T GetAllocatedSize() const
+	{
+		return sizeof(*this) + Coords.GetAllocatedSize() + Before.GetAllocatedSize() + After.GetAllocatedSize();
+	}
+};
+
+// One undo step: everything a stroke (or a group of strokes) changed
+struct FVoxelUndoEntry
+{
+	TArray<FVoxelChunkDelta> Chunks;
+
+	int32 NumVoxels() const
+	{
+		int32 Total = 0;
+		for (const FVoxelChunkDelta& Delta : Chunks)
+		{
+			Total += Delta.Num();
+		}
+		return Total;
+	}
+
+	SIZE_T GetAllocatedSize() const
+	{
+		SIZE_T Size = sizeof(*this) + Chunks.GetAllocatedSize();
+		for (const FVoxelChunkDelta& Delta : Chunks)
+		{
+			Size += Delta.GetAllocatedSize() - sizeof(Delta);
+		}
+		return Size;
+	}
+};
+
+// Undo / redo stacks of voxel deltas. Capped by memory instead of a step count: one huge stroke and a hundred
+// small ones cost the same budget. Oldest undo steps go first, then the farthest redo steps. Game thread only.
+struct FVoxelUndoJournal
+{
+	// A new edit: redo history no longer applies
+	void Push(FVoxelUndoEntry&& Entry, SIZE_T BudgetBytes)
+	{
+		RedoStack.Reset();
+		RedoBytes = 0;
+
+		UndoBytes += Entry.GetAllocatedSize();
+		UndoStack.Add(MoveTemp(Entry));
+		Trim(BudgetBytes);
+	}
+
+	bool PopUndo(FVoxelUndoEntry& OutEntry)
+	{
+		return PopFrom(UndoStack, UndoBytes, OutEntry);
+	}
+
+	bool PopRedo(FVoxelUndoEntry& OutEntry)
+	{
+		return PopFrom(RedoStack, RedoBytes, OutEntry);
+	}
+
+	// Moving steps between the stacks never changes the total, so no trim here
+	void PushRedo(FVoxelUndoEntry&& Entry)
+	{
+		RedoBytes += Entry.GetAllocatedSize();
+		RedoStack.Add(MoveTemp(Entry));
+	}
+
+	void PushUndo(FVoxelUndoEntry&& Entry)
+	{
+		UndoBytes += Entry.GetAllocatedSize();
+		UndoStack.Add(MoveTemp(Entry));
+	}
+
+	void Reset()
+	{
+		UndoStack.Reset();
+		RedoStack.Reset();
+		UndoBytes = 0;
+		RedoBytes = 0;
+	}
+
+	void Trim(SIZE_T BudgetBytes)
+	{
+		while (UndoBytes + RedoBytes > BudgetBytes && UndoStack.Num() > 0)
+		{
+			UndoBytes -= UndoStack[0].GetAllocatedSize();
+			UndoStack.RemoveAt(0, 1, false);
+		}
+		while (UndoBytes + RedoBytes > BudgetBytes && RedoStack.Num() > 0)
+		{
+			RedoBytes -= RedoStack[0].GetAllocatedSize();
+			RedoStack.RemoveAt(0, 1, false);
+		}
+	}
+
+	int32 NumUndo() const { return UndoStack.Num(); }
+	int32 NumRedo() const { return RedoStack.Num(); }
+	SIZE_T GetMemoryUsage() const { return UndoBytes + RedoBytes; }
+
+private:
+	static bool PopFrom(TArray<FVoxelUndoEntry>& Stack, SIZE_T& StackBytes, FVoxelUndoEntry& OutEntry)
+	{
+		if (Stack.Num() == 0)
+		{
+			return false;
+		}
+		OutEntry = Stack.Pop(false);
+		StackBytes -= OutEntry.GetAllocatedSize();
+		return true;
+	}
+
+	TArray<FVoxelUndoEntry> UndoStack;
+	TArray<FVoxelUndoEntry> RedoStack;
+	SIZE_T UndoBytes = 0;
+	SIZE_T RedoBytes = 0;
+};
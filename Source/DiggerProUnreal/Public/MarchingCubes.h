@@ -4,11 +4,14 @@
 #include "UObject/NoExportTypes.h"
 // Error in MarchingCubes.cpp
 #include "UDynamicMesh.h" // Not found
+#include "Voxel/ChunkHeightCache.h"
 #include "MarchingCubes.generated.h"
 
 class ADiggerManager;
 class UVoxelChunk;
 class USparseVoxelGrid;
+struct FVoxelDenseSlab;
+struct FVoxelLODTransitions;
 
 //Mesh Ready Delegate
 DECLARE_DELEGATE(FOnMeshReady);
@@ -32,9 +35,8 @@ public:
 
 	// Add these members to your MarchingCubes class
 private:
-	// Height caching system
-	UPROPERTY()
-	TMap<FIntVector, float> HeightCache;
+	// Height caching system. Replaced, never written in place, so mesh jobs can keep the one they were given.
+	FChunkHeightCachePtr HeightCache;
     
 	UPROPERTY()
 	FVector CachedChunkOrigin;
@@ -54,6 +56,8 @@ public:
 	float GetCachedHeight(const FVector& WorldPosition) const;
 	void ClearHeightCache();
 	bool IsHeightCacheValid(const FVector& ChunkOrigin, float VoxelSize) const;
+	// The current cache for a mesh job to take along, null until InitializeHeightCache
+	FChunkHeightCachePtr GetHeightCache() const { return HeightCache; }
 
 	bool IsDebugging() {return bIsDebugging;}
 
@@ -69,6 +73,36 @@ public:
 		// Add TArray<FVector2D>& OutUVs, TArray<FColor>& OutColors, TArray<FProcMeshTangent>& OutTangents if needed
 	);
 
+	// Split form of GenerateMeshFromGrid for background meshing: copy the chunk into a slab and take the
+	// height cache on the game thread, then mesh the slab anywhere. Never touches the generator's own cache.
+	// HighNeighbourGrids: optional +X, +Y, +Z neighbour grids (any may be null) for the layer at N + 1
+	static void BuildMeshingSlab(USparseVoxelGrid* InVoxelGrid, FVoxelDenseSlab& OutSlab, USparseVoxelGrid* const* HighNeighbourGrids = nullptr);
+	void GenerateMeshFromSlab(
+		const FVoxelDenseSlab& Slab,
+		const FChunkHeightCache& Heights,
+		const FVector& Origin,
+		float VoxelSize,
+		TArray<FVector>& OutVertices,
+		TArray<int32>& OutTriangles,
+		TArray<FVector>& OutNormals
+	);
+
+	// Reduced resolution form for distant chunks (LOD > 0): cells 2^LOD voxels wide, point sampled from the grid.
+	// Faces / edges in Transitions border a chunk one LOD finer and get transition cells sampled at that chunk's
+	// resolution, so the two meshes meet without cracks. Same game thread / anywhere split as above.
+	static void BuildLODMeshingSlab(USparseVoxelGrid* InVoxelGrid, int32 LOD, const FVoxelLODTransitions& Transitions, FVoxelDenseSlab& OutSlab);
+	void GenerateLODMeshFromSlab(
+		const FVoxelDenseSlab& Slab,
+		int32 LOD,
+		const FVoxelLODTransitions& Transitions,
+		const FChunkHeightCache& Heights,
+		const FVector& Origin,
+		float VoxelSize,
+		TArray<FVector>& OutVertices,
+		TArray<int32>& OutTriangles,
+		TArray<FVector>& OutNormals
+	);
+
 	void GenerateMeshFromGridSyncronous(
 	USparseVoxelGrid* InVoxelGrid,
 	const FVector& Origin,
@@ -79,14 +113,6 @@ public:
 	);
 	
 	
-	void PopulateHeightValues(
-	TArray<float>& OutHeights,
-	TSharedPtr<TMap<FIntPoint, float>>* HeightCachePtr,
-	const FVector& Origin,
-	float VoxelSize,
-	int32 N
-	) const;
-
 	void IdentifyAirVoxelsBelowTerrain(
 	USparseVoxelGrid* Grid,
 	TSet<FIntVector>& OutSet,
@@ -112,12 +138,6 @@ public:
 	
 	void LogDebug(const FString& Message);
 
-	float GetCachedHeight(
-		TSharedPtr<TMap<FIntPoint, float>>* HeightCachePtr,
-		const FVector& WorldPos,
-		float VoxelSize
-	) const;
-
 	void GenerateMeshForIsland(USparseVoxelGrid* IslandGrid, const FVector& Origin, float VoxelSize, int32 IslandId);
 	void ClearSectionAndRebuildMesh(int32 SectionIndex, FIntVector ChunkCoord);
 
@@ -147,7 +167,8 @@ public:
 
 	static int32 CalculateMarchingCubesIndex(const TArray<float>& CornerSDFValues);
 
-	void ReconstructMeshSection(int32 SectionIndex, const TArray<FVector>& OutOutVertices, const TArray<int32>& OutTriangles, const TArray<FVector>&
+	// Uploads a finished mesh to the chunk's own mesh component (section 0)
+	void ReconstructMeshSection(const FIntVector& ChunkCoords, const TArray<FVector>& OutOutVertices, const TArray<int32>& OutTriangles, const TArray<FVector>&
 	                            Normals) const;
 
 	// Reference to the associated voxel chunk
@@ -2,6 +2,9 @@
 
 #include "CoreMinimal.h"
 #include "DiggerManager.h"
+#include "Voxel/VoxelBrickMap.h"
+#include "Voxel/VoxelIslandLabels.h"
+#include "FVoxelUndoJournal.h"
 #include "SparseVoxelGrid.generated.h"
 
 class ADiggerManager;
@@ -23,6 +26,33 @@ struct FVoxelData
 
 	FVoxelData() : SDFValue(0.0f) {}
 	FVoxelData(float InSDFValue) : SDFValue(InSDFValue) {}
+
+	bool operator==(const FVoxelData& Other) const { return SDFValue == Other.SDFValue; }
+};
+
+// Bricked storage for FVoxelData, see Voxel/VoxelBrickMap.h
+typedef TVoxelBrickMap<FVoxelData> FVoxelBrickMap;
+
+// One pending SDF write, blended exactly like SetVoxel (max when digging, min when adding)
+struct FVoxelWrite
+{
+	FIntVector Coords;
+	float SDFValue;
+	bool bDig;
+};
+
+// Per-worker write buffer. Filled without any locking, then merged into the grid with ApplyWriteBatches
+struct FVoxelWriteBatch
+{
+	TArray<FVoxelWrite> Writes;
+
+	void Add(const FIntVector& Coords, float SDFValue, bool bDig)
+	{
+		Writes.Add({ Coords, SDFValue, bDig });
+	}
+
+	void Reset() { Writes.Reset(); }
+	int32 Num() const { return Writes.Num(); }
 };
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnIslandDetected, const FIslandData&, Island);
@@ -56,7 +86,6 @@ public:
 	float GetVoxel(FIntVector Vector);
 	bool IsVoxelSolid(const FIntVector& VoxelIndex) const;
 	const FVoxelData* GetVoxelData(const FIntVector& Voxel) const;
-	FVoxelData* GetVoxelData(const FIntVector& Voxel);
 
 	// Delegate to broadcast when a new island is detected
 	UPROPERTY(BlueprintAssignable, Category = "Island Detection")
@@ -64,16 +93,35 @@ public:
 	
 
 	//A public getter for VoxelData
-	const TMap<FIntVector, FVoxelData>& GetVoxel() const { return VoxelData; }
+	const FVoxelBrickMap& GetVoxel() const { return VoxelData; }
 	
 	// Adds a voxel at the given coordinates with the provided SDF value
 	void SetVoxel(FIntVector Position, float SDFValue, bool bDig);
 	void SetVoxel(int32 X, int32 Y, int32 Z, float NewSDFValue, bool bDig);
 	void SetVoxel(int32 X, int32 Y, int32 Z, float NewSDFValue, bool bDig) const;
 
+	// Merges batched writes under a single lock and marks the parent chunk dirty once. Returns voxels written.
+	int32 ApplyWriteBatch(const FVoxelWriteBatch& Batch);
+	int32 ApplyWriteBatches(TArrayView<const FVoxelWriteBatch> Batches);
+
 	bool SerializeToArchive(FArchive& Ar);
 	bool SerializeFromArchive(FArchive& Ar);
 
+	// Compact form for region packs: sorted, delta coded int16 coords and int16 SDF scaled by the chunk's max |SDF|
+	bool SerializeQuantizedToArchive(FArchive& Ar);
+	bool SerializeQuantizedFromArchive(FArchive& Ar);
+
+	// Undo capture for FVoxelUndoJournal: while the manager has an undo group open, the first write to each voxel
+	// keeps its old value. TakeUndoCapture turns that into a before / after delta and clears it.
+	// RestoreVoxels is safe off the game thread, the caller marks the chunk dirty afterwards.
+	bool HasUndoCapture();
+	bool TakeUndoCapture(FVoxelChunkDelta& OutDelta);
+	void RestoreVoxels(const FVoxelChunkDelta& Delta, bool bRestoreBefore);
+
+	// Decode into a loose brick map without touching any grid, safe on worker threads (async chunk loading)
+	static bool DecodeQuantizedVoxels(FArchive& Ar, FVoxelBrickMap& OutVoxels);
+	static bool DecodeVoxels(FArchive& Ar, FVoxelBrickMap& OutVoxels);
+
 	// Retrieves the voxel's SDF value; returns true if the voxel exists
 	float GetVoxel(int32 X, int32 Y, int32 Z);
 	float GetVoxel(int32 X, int32 Y, int32 Z) const;
@@ -117,6 +165,13 @@ public:
 	
 	UFUNCTION(BlueprintCallable, Category = "Voxel")
 	TArray<FIslandData> DetectIslands(float SDFThreshold = 0.0f);
+
+	// Incremental version of DetectIslands (SDF < 0), only re-floods what was written since the last call.
+	// Returns the island count, OutNewIslands gets labels of islands that appeared in this update.
+	int32 UpdateIslandLabels(TArray<int32>& OutNewIslands);
+	// Forces a full relabel on the next update, for code that replaces VoxelData wholesale
+	void InvalidateIslandLabels();
+	const FVoxelIslandLabels& GetIslandLabels() const { return IslandLabels; }
 	void RemoveSpecifiedVoxels(const TArray<FIntVector>& LocalVoxels);
 	bool RemoveVoxel(const FIntVector& LocalVoxel);
 
@@ -138,11 +193,26 @@ public:
 		return ParentChunkCoordinates;
 	}
 	
-	// The sparse voxel data map, keyed by 3D coordinates, storing FVoxelData
-	TMap<FIntVector, FVoxelData> VoxelData;
+	// Collapses bricks that ended up all air / all solid back to a single value
+	int32 CompactStorage();
+
+	// The sparse voxel data, keyed by 3D coordinates, stored in lazily allocated 8^3 bricks
+	FVoxelBrickMap VoxelData;
 
 	
 private:
+	// Blend one value into storage, caller must hold VoxelDataMutex
+	bool BlendVoxel_NoLock(const FIntVector& VoxelKey, float NewSDFValue, bool bDig);
+
+	// Persistent island labels, guarded by VoxelDataMutex
+	FVoxelIslandLabels IslandLabels;
+
+	// Keep a voxel's pre-edit value for undo, caller must hold VoxelDataMutex
+	void RecordUndo_NoLock(const FIntVector& Voxel);
+
+	// Voxel -> SDF before the open undo group touched it (NaN = wasn't stored), guarded by VoxelDataMutex
+	TMap<FIntVector, float> UndoCapture;
+
 	//Baked SDF for BaseSDF values for after the undo queue brush strokes fall out the end of the queue and get baked.
 	TMap<FIntVector, FVoxelData> BakedSDF;
 	
@@ -169,7 +239,13 @@ public:
 
 	void SetVoxelData(const TMap<FIntVector, FVoxelData>& InData)
 	{
-		VoxelData = InData;
+		VoxelData.Empty();
+		for (const auto& Pair : InData)
+		{
+			VoxelData.Add(Pair.Key, Pair.Value);
+		}
+		VoxelData.Compact();
+		IslandLabels.Invalidate();
 	}
 
 private:
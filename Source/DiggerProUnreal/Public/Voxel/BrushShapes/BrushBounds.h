@@ -0,0 +1,195 @@
+// BrushBounds.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FBrushStroke.h"
+
+// The region a stroke can write to, from each shape's real extent plus the falloff: a sphere for the round shapes,
+// an oriented box for the rest. Used to pick the chunks a stroke touches without padding by a whole chunk.
+struct FBrushBounds
+{
+	FVector Center = FVector::ZeroVector;
+	FQuat Rotation = FQuat::Identity;
+	FVector HalfExtents = FVector::ZeroVector;
+	// Round shapes only test the sphere, HalfExtents is then just its radius on every axis
+	bool bSphere = false;
+	float Radius = 0.0f;
+
+	// Digging skips voxels further than 1.5 radii above / below the brush (see UVoxelChunk::ApplyBrushStrokes)
+	float MinZ = -UE_BIG_NUMBER;
+	float MaxZ = UE_BIG_NUMBER;
+
+	static FBrushBounds FromStroke(const FBrushStroke& Stroke)
+	{
+		FBrushBounds Bounds;
+		Bounds.Center = Stroke.BrushPosition + Stroke.BrushOffset;
+		Bounds.Rotation = Stroke.BrushRotation.Quaternion();
+
+		const float Falloff = FMath::Max(Stroke.BrushFalloff, 0.0f);
+		auto SetSphere = [&Bounds](float InRadius)
+		{
+			Bounds.bSphere = true;
+			Bounds.Radius = InRadius;
+			Bounds.Rotation = FQuat::Identity;
+			Bounds.HalfExtents = FVector(InRadius);
+		};
+
+		// Local half extents match the SDF kernels in BrushSDFKernels.cpp, which all work around the unrotated centre
+		switch (Stroke.BrushType)
+		{
+		case EVoxelBrushType::Cube:
+			Bounds.HalfExtents = (Stroke.bUseAdvancedCubeBrush
+				? FVector(Stroke.AdvancedCubeHalfExtentX, Stroke.AdvancedCubeHalfExtentY, Stroke.AdvancedCubeHalfExtentZ)
+				: FVector(Stroke.BrushRadius)) + Falloff;
+			break;
+
+		case EVoxelBrushType::Cylinder:
+			Bounds.HalfExtents = FVector(Stroke.BrushRadius, Stroke.BrushRadius, Stroke.BrushLength * 0.5f) + Falloff;
+			break;
+
+		case EVoxelBrushType::Capsule:
+			// The caps stick out one radius past the segment ends
+			Bounds.HalfExtents = FVector(Stroke.BrushRadius, Stroke.BrushRadius, Stroke.BrushLength * 0.5f + Stroke.BrushRadius) + Falloff;
+			break;
+
+		case EVoxelBrushType::Torus:
+			// BrushRadius is the ring, TorusInnerRadius the tube around it
+			Bounds.HalfExtents = FVector(Stroke.BrushRadius + Stroke.TorusInnerRadius, Stroke.BrushRadius + Stroke.TorusInnerRadius, Stroke.TorusInnerRadius) + Falloff;
+			break;
+
+		case EVoxelBrushType::Cone:
+			{
+				// Apex at the centre, opening up the local Z axis to BrushLength
+				const float RadiusAtBase = Stroke.BrushLength * FMath::Tan(FMath::DegreesToRadians(Stroke.BrushAngle));
+				Bounds.Center += Bounds.Rotation.RotateVector(FVector(0.0f, 0.0f, Stroke.BrushLength * 0.5f));
+				Bounds.HalfExtents = FVector(FMath::Abs(RadiusAtBase), FMath::Abs(RadiusAtBase), Stroke.BrushLength * 0.5f) + Falloff;
+			}
+			break;
+
+		case EVoxelBrushType::Pyramid:
+			{
+				const float SlopeModifier = FMath::Tan(FMath::DegreesToRadians(Stroke.BrushAngle)) * 0.1f;
+				const float BaseSize = Stroke.BrushRadius * (1.0f + FMath::Max(SlopeModifier, 0.0f));
+				Bounds.HalfExtents = FVector(BaseSize, BaseSize, Stroke.BrushLength * 0.5f) + Falloff;
+			}
+			break;
+
+		case EVoxelBrushType::Sphere:
+			SetSphere(Stroke.BrushRadius + Falloff);
+			break;
+
+		case EVoxelBrushType::Icosphere:
+			// The faceting pushes the surface out by up to 10% of the radius
+			SetSphere(Stroke.BrushRadius * 1.1f + Falloff);
+			break;
+
+		case EVoxelBrushType::Smooth:
+		case EVoxelBrushType::Noise:
+			// These measure from BrushPosition and ignore the offset
+			Bounds.Center = Stroke.BrushPosition;
+			SetSphere(Stroke.BrushRadius + Falloff);
+			break;
+
+		default:
+			// Anything else (custom shapes) keeps the old radius + falloff box around the brush
+			Bounds.Center = Stroke.BrushPosition;
+			Bounds.Rotation = FQuat::Identity;
+			Bounds.HalfExtents = FVector(Stroke.BrushRadius + Falloff);
+			break;
+		}
+
+		if (Stroke.bDig)
+		{
+			Bounds.MinZ = Stroke.BrushPosition.Z - Stroke.BrushRadius * 1.5f;
+			Bounds.MaxZ = Stroke.BrushPosition.Z + Stroke.BrushRadius * 1.5f;
+		}
+		return Bounds;
+	}
+
+	// World axis aligned box around the rotated shape
+	FBox GetWorldBox() const
+	{
+		FVector Extent = HalfExtents;
+		if (!bSphere)
+		{
+			const FVector AxisX = Rotation.GetAxisX() * HalfExtents.X;
+			const FVector AxisY = Rotation.GetAxisY() * HalfExtents.Y;
+			const FVector AxisZ = Rotation.GetAxisZ() * HalfExtents.Z;
+			Extent = AxisX.GetAbs() + AxisY.GetAbs() + AxisZ.GetAbs();
+		}
+
+		FBox Box = FBox::BuildAABB(Center, Extent);
+		Box.Min.Z = FMath::Max(Box.Min.Z, (FVector::FReal)MinZ);
+		Box.Max.Z = FMath::Min(Box.Max.Z, (FVector::FReal)MaxZ);
+		return Box;
+	}
+
+	// Exact for the sphere, separating axis test for the oriented box
+	bool Intersects(const FBox& Box) const
+	{
+		if (Box.Max.Z < MinZ || Box.Min.Z > MaxZ)
+		{
+			return false;
+		}
+		if (bSphere)
+		{
+			return Box.ComputeSquaredDistanceToPoint(Center) <= FMath::Square(Radius);
+		}
+
+		const FVector BoxExtent = Box.GetExtent();
+		const FVector T = Center - Box.GetCenter();
+		const FVector Axes[3] = { Rotation.GetAxisX(), Rotation.GetAxisY(), Rotation.GetAxisZ() };
+
+		// R[i][j] = world axis i dotted with shape axis j, padded so near parallel edges don't produce a bogus cross axis
+		FVector::FReal R[3][3];
+		FVector::FReal AbsR[3][3];
+		for (int32 i = 0; i < 3; ++i)
+		{
+			for (int32 j = 0; j < 3; ++j)
+			{
+				R[i][j] = Axes[j][i];
+				AbsR[i][j] = FMath::Abs(R[i][j]) + UE_KINDA_SMALL_NUMBER;
+			}
+		}
+
+		// World axes
+		for (int32 i = 0; i < 3; ++i)
+		{
+			const FVector::FReal ShapeRadius = HalfExtents.X * AbsR[i][0] + HalfExtents.Y * AbsR[i][1] + HalfExtents.Z * AbsR[i][2];
+			if (FMath::Abs(T[i]) > BoxExtent[i] + ShapeRadius)
+			{
+				return false;
+			}
+		}
+
+		// Shape axes
+		for (int32 j = 0; j < 3; ++j)
+		{
+			const FVector::FReal BoxRadius = BoxExtent.X * AbsR[0][j] + BoxExtent.Y * AbsR[1][j] + BoxExtent.Z * AbsR[2][j];
+			if (FMath::Abs(FVector::DotProduct(T, Axes[j])) > BoxRadius + HalfExtents[j])
+			{
+				return false;
+			}
+		}
+
+		// World axis i cross shape axis j
+		for (int32 i = 0; i < 3; ++i)
+		{
+			const int32 i1 = (i + 1) % 3;
+			const int32 i2 = (i + 2) % 3;
+			for (int32 j = 0; j < 3; ++j)
+			{
+				const int32 j1 = (j + 1) % 3;
+				const int32 j2 = (j + 2) % 3;
+				const FVector::FReal BoxRadius = BoxExtent[i1] * AbsR[i2][j] + BoxExtent[i2] * AbsR[i1][j];
+				const FVector::FReal ShapeRadius = HalfExtents[j1] * AbsR[i][j2] + HalfExtents[j2] * AbsR[i][j1];
+				const FVector::FReal Distance = T[i2] * R[i1][j] - T[i1] * R[i2][j];
+				if (FMath::Abs(Distance) > BoxRadius + ShapeRadius)
+				{
+					return false;
+				}
+			}
+		}
+		return true;
+	}
+};
@@ -0,0 +1,366 @@
+#include "BrushSDFKernels.h"
+
+#include "FBrushStroke.h"
+#include "VoxelConversion.h"
+#include "Math/UnrealMathUtility.h"
+#include "Math/VectorRegister.h"
+
+void FBrushSDFBatch::Begin(const FBrushStroke& Stroke)
+{
+	Num = 0;
+	Center = Stroke.BrushPosition + Stroke.BrushOffset;
+}
+
+void FBrushSDFBatch::Unrotate(const FRotator& Rotation, bool bSkipNearlyZero)
+{
+	if (bSkipNearlyZero ? Rotation.IsNearlyZero() : Rotation.IsZero())
+	{
+		return;
+	}
+
+	const FQuat InverseRotation = Rotation.Quaternion().Inverse();
+	for (int32 Index = 0; Index < Num; ++Index)
+	{
+		const FVector Local = InverseRotation.RotateVector(FVector(X[Index], Y[Index], Z[Index]));
+		X[Index] = (float)Local.X;
+		Y[Index] = (float)Local.Y;
+		Z[Index] = (float)Local.Z;
+	}
+}
+
+void FBrushSDFBatch::PadTail()
+{
+	for (int32 Index = Num; Index < NumPadded(); ++Index)
+	{
+		X[Index] = 0.0f;
+		Y[Index] = 0.0f;
+		Z[Index] = 0.0f;
+		WorldZ[Index] = 0.0f;
+		TerrainHeight[Index] = 0.0f;
+	}
+}
+
+namespace
+{
+	// What the falloff band blends towards when digging (adding always fades to 0)
+	enum class EFalloffEdge : uint8
+	{
+		Zero,
+		Solid,
+		SolidBelowTerrain,
+	};
+
+	// The shapes share one falloff curve (smoothstep over BrushFalloff from the core value) and differ only in
+	// these three details, see each shape's CalculateSDF_Implementation
+	struct FFalloffProfile
+	{
+		bool bCutoffPastFalloff;
+		EFalloffEdge DigEdge;
+		bool bTerrainGate; // dig only below terrain, add only above it
+	};
+
+	constexpr FFalloffProfile ShellProfile{ true, EFalloffEdge::SolidBelowTerrain, false };
+	constexpr FFalloffProfile BoxProfile{ false, EFalloffEdge::Solid, false };
+	constexpr FFalloffProfile GatedProfile{ true, EFalloffEdge::Zero, true };
+
+	void ApplyFalloffProfile(const FBrushStroke& Stroke, FBrushSDFBatch& Batch, const FFalloffProfile& Profile)
+	{
+		const bool bDig = Stroke.bDig;
+		const float Falloff = Stroke.BrushFalloff;
+
+		const VectorRegister4Float Zero = VectorZeroFloat();
+		const VectorRegister4Float One = VectorOneFloat();
+		const VectorRegister4Float Two = VectorSetFloat1(2.0f);
+		const VectorRegister4Float Three = VectorSetFloat1(3.0f);
+		const VectorRegister4Float Core = VectorSetFloat1(bDig ? FVoxelConversion::SDF_AIR : FVoxelConversion::SDF_SOLID);
+		const VectorRegister4Float Solid = VectorSetFloat1(FVoxelConversion::SDF_SOLID);
+		const VectorRegister4Float FalloffV = VectorSetFloat1(Falloff);
+		const VectorRegister4Float InvFalloff = VectorSetFloat1(Falloff > 0.0f ? 1.0f / Falloff : 0.0f);
+		const VectorRegister4Float Strength = VectorSetFloat1(Stroke.BrushStrength);
+
+		for (int32 Index = 0; Index < Batch.NumPadded(); Index += 4)
+		{
+			const VectorRegister4Float Distance = VectorLoadAligned(&Batch.Distance[Index]);
+			const VectorRegister4Float Below = VectorCompareLT(VectorLoadAligned(&Batch.WorldZ[Index]), VectorLoadAligned(&Batch.TerrainHeight[Index]));
+
+			// SmoothStep(0, 1, Distance / Falloff)
+			const VectorRegister4Float T = VectorMin(VectorMax(VectorMultiply(Distance, InvFalloff), Zero), One);
+			const VectorRegister4Float S = VectorMultiply(VectorMultiply(T, T), VectorSubtract(Three, VectorMultiply(Two, T)));
+
+			VectorRegister4Float Edge = Zero;
+			if (bDig && Profile.DigEdge == EFalloffEdge::Solid)
+			{
+				Edge = Solid;
+			}
+			else if (bDig && Profile.DigEdge == EFalloffEdge::SolidBelowTerrain)
+			{
+				Edge = VectorSelect(Below, Solid, Zero);
+			}
+
+			VectorRegister4Float Value = VectorMultiplyAdd(VectorSubtract(Edge, Core), S, Core);
+			Value = VectorSelect(VectorCompareLE(Distance, Zero), Core, Value);
+
+			if (Profile.bCutoffPastFalloff)
+			{
+				Value = VectorSelect(VectorCompareGT(Distance, FalloffV), Zero, Value);
+			}
+			if (Profile.bTerrainGate)
+			{
+				Value = bDig ? VectorSelect(Below, Value, Zero) : VectorSelect(Below, Zero, Value);
+			}
+
+			VectorStoreAligned(VectorMultiply(Value, Strength), &Batch.SDF[Index]);
+		}
+	}
+
+	FORCEINLINE VectorRegister4Float LengthSquared2(const VectorRegister4Float& A, const VectorRegister4Float& B)
+	{
+		return VectorMultiplyAdd(A, A, VectorMultiply(B, B));
+	}
+
+	FORCEINLINE VectorRegister4Float LengthSquared3(const VectorRegister4Float& A, const VectorRegister4Float& B, const VectorRegister4Float& C)
+	{
+		return VectorMultiplyAdd(A, A, VectorMultiplyAdd(B, B, VectorMultiply(C, C)));
+	}
+}
+
+namespace BrushSDFKernels
+{
+	void Sphere(const FBrushStroke& Stroke, FBrushSDFBatch& Batch)
+	{
+		Batch.PadTail();
+
+		const VectorRegister4Float Radius = VectorSetFloat1(Stroke.BrushRadius);
+		for (int32 Index = 0; Index < Batch.NumPadded(); Index += 4)
+		{
+			const VectorRegister4Float Length = VectorSqrt(LengthSquared3(
+				VectorLoadAligned(&Batch.X[Index]), VectorLoadAligned(&Batch.Y[Index]), VectorLoadAligned(&Batch.Z[Index])));
+			VectorStoreAligned(VectorSubtract(Length, Radius), &Batch.Distance[Index]);
+		}
+
+		ApplyFalloffProfile(Stroke, Batch, ShellProfile);
+	}
+
+	void Cube(const FBrushStroke& Stroke, FBrushSDFBatch& Batch)
+	{
+		Batch.Unrotate(Stroke.BrushRotation, true);
+		Batch.PadTail();
+
+		const VectorRegister4Float Zero = VectorZeroFloat();
+		const VectorRegister4Float HalfX = VectorSetFloat1(Stroke.bUseAdvancedCubeBrush ? Stroke.AdvancedCubeHalfExtentX : Stroke.BrushRadius);
+		const VectorRegister4Float HalfY = VectorSetFloat1(Stroke.bUseAdvancedCubeBrush ? Stroke.AdvancedCubeHalfExtentY : Stroke.BrushRadius);
+		const VectorRegister4Float HalfZ = VectorSetFloat1(Stroke.bUseAdvancedCubeBrush ? Stroke.AdvancedCubeHalfExtentZ : Stroke.BrushRadius);
+
+		for (int32 Index = 0; Index < Batch.NumPadded(); Index += 4)
+		{
+			const VectorRegister4Float QX = VectorSubtract(VectorAbs(VectorLoadAligned(&Batch.X[Index])), HalfX);
+			const VectorRegister4Float QY = VectorSubtract(VectorAbs(VectorLoadAligned(&Batch.Y[Index])), HalfY);
+			const VectorRegister4Float QZ = VectorSubtract(VectorAbs(VectorLoadAligned(&Batch.Z[Index])), HalfZ);
+
+			// Inside: largest (least negative) face distance. Outside: length of the positive part.
+			const VectorRegister4Float Outside = VectorSqrt(LengthSquared3(VectorMax(QX, Zero), VectorMax(QY, Zero), VectorMax(QZ, Zero)));
+			const VectorRegister4Float Inside = VectorMin(VectorMax(VectorMax(QX, QY), QZ), Zero);
+			VectorStoreAligned(VectorAdd(Outside, Inside), &Batch.Distance[Index]);
+		}
+
+		ApplyFalloffProfile(Stroke, Batch, BoxProfile);
+	}
+
+	void Cylinder(const FBrushStroke& Stroke, FBrushSDFBatch& Batch)
+	{
+		Batch.Unrotate(Stroke.BrushRotation, true);
+		Batch.PadTail();
+
+		const float Radius = Stroke.BrushRadius;
+		const float HalfHeight = Stroke.BrushLength * 0.5f;
+
+		if (Stroke.bIsFilled)
+		{
+			const VectorRegister4Float Zero = VectorZeroFloat();
+			const VectorRegister4Float RadiusV = VectorSetFloat1(Radius);
+			const VectorRegister4Float HalfHeightV = VectorSetFloat1(HalfHeight);
+			for (int32 Index = 0; Index < Batch.NumPadded(); Index += 4)
+			{
+				const VectorRegister4Float Radial = VectorSqrt(LengthSquared2(VectorLoadAligned(&Batch.X[Index]), VectorLoadAligned(&Batch.Y[Index])));
+				const VectorRegister4Float DX = VectorSubtract(Radial, RadiusV);
+				const VectorRegister4Float DZ = VectorSubtract(VectorAbs(VectorLoadAligned(&Batch.Z[Index])), HalfHeightV);
+				const VectorRegister4Float Largest = VectorMax(DX, DZ);
+				VectorStoreAligned(VectorAdd(Largest, VectorMin(Largest, Zero)), &Batch.Distance[Index]);
+			}
+		}
+		else
+		{
+			// Hollow walls branch per voxel, left to the compiler
+			const float InnerRadius = FMath::Max(0.0f, Radius - Stroke.WallThickness);
+			for (int32 Index = 0; Index < Batch.NumPadded(); ++Index)
+			{
+				const float RadialDist = FMath::Sqrt(Batch.X[Index] * Batch.X[Index] + Batch.Y[Index] * Batch.Y[Index]);
+				const float AbsZ = FMath::Abs(Batch.Z[Index]);
+				const float PastCap = FMath::Square(FMath::Max(AbsZ - HalfHeight, 0.0f));
+				const float DistToOuter = FMath::Sqrt(FMath::Square(FMath::Max(RadialDist - Radius, 0.0f)) + PastCap);
+				const float DistToInner = FMath::Sqrt(FMath::Square(FMath::Max(InnerRadius - RadialDist, 0.0f)) + PastCap);
+				const float D = FMath::Min(DistToOuter, DistToInner);
+				Batch.Distance[Index] = (RadialDist < InnerRadius && AbsZ < HalfHeight) ? -D : D;
+			}
+		}
+
+		ApplyFalloffProfile(Stroke, Batch, GatedProfile);
+	}
+
+	void Cone(const FBrushStroke& Stroke, FBrushSDFBatch& Batch)
+	{
+		Batch.Unrotate(Stroke.BrushRotation, true);
+		Batch.PadTail();
+
+		const float Height = Stroke.BrushLength;
+		const float RadiusAtBase = Height * FMath::Tan(FMath::DegreesToRadians(Stroke.BrushAngle));
+		const float K = RadiusAtBase / Height;
+
+		for (int32 Index = 0; Index < Batch.NumPadded(); ++Index)
+		{
+			const float QX = FMath::Sqrt(Batch.X[Index] * Batch.X[Index] + Batch.Y[Index] * Batch.Y[Index]);
+			const float QY = Batch.Z[Index];
+
+			float Distance;
+			if (QY < 0.0f || QY > Height)
+			{
+				const float DZ = FMath::Min(FMath::Abs(QY), FMath::Abs(QY - Height));
+				Distance = FMath::Sqrt(QX * QX + DZ * DZ);
+			}
+			else
+			{
+				Distance = QX - K * QY;
+			}
+			Batch.Distance[Index] = Stroke.bIsFilled ? FMath::Abs(Distance) : Distance;
+		}
+
+		ApplyFalloffProfile(Stroke, Batch, BoxProfile);
+	}
+
+	void Capsule(const FBrushStroke& Stroke, FBrushSDFBatch& Batch)
+	{
+		Batch.Unrotate(Stroke.BrushRotation, false);
+		Batch.PadTail();
+
+		const VectorRegister4Float Radius = VectorSetFloat1(Stroke.BrushRadius);
+		const VectorRegister4Float HalfLength = VectorSetFloat1(Stroke.BrushLength * 0.5f);
+		const VectorRegister4Float NegHalfLength = VectorNegate(HalfLength);
+
+		for (int32 Index = 0; Index < Batch.NumPadded(); Index += 4)
+		{
+			// Distance to the closest point on the central segment
+			const VectorRegister4Float Z = VectorLoadAligned(&Batch.Z[Index]);
+			const VectorRegister4Float AxisZ = VectorSubtract(Z, VectorMin(VectorMax(Z, NegHalfLength), HalfLength));
+			const VectorRegister4Float Length = VectorSqrt(LengthSquared3(VectorLoadAligned(&Batch.X[Index]), VectorLoadAligned(&Batch.Y[Index]), AxisZ));
+			VectorStoreAligned(VectorSubtract(Length, Radius), &Batch.Distance[Index]);
+		}
+
+		ApplyFalloffProfile(Stroke, Batch, ShellProfile);
+	}
+
+	void Torus(const FBrushStroke& Stroke, FBrushSDFBatch& Batch)
+	{
+		Batch.Unrotate(Stroke.BrushRotation, false);
+		Batch.PadTail();
+
+		const VectorRegister4Float MajorRadius = VectorSetFloat1(Stroke.BrushRadius);
+		const VectorRegister4Float MinorRadius = VectorSetFloat1(Stroke.TorusInnerRadius);
+
+		for (int32 Index = 0; Index < Batch.NumPadded(); Index += 4)
+		{
+			const VectorRegister4Float Ring = VectorSubtract(
+				VectorSqrt(LengthSquared2(VectorLoadAligned(&Batch.X[Index]), VectorLoadAligned(&Batch.Y[Index]))), MajorRadius);
+			const VectorRegister4Float Length = VectorSqrt(LengthSquared2(Ring, VectorLoadAligned(&Batch.Z[Index])));
+			VectorStoreAligned(VectorSubtract(Length, MinorRadius), &Batch.Distance[Index]);
+		}
+
+		ApplyFalloffProfile(Stroke, Batch, ShellProfile);
+	}
+
+	void Pyramid(const FBrushStroke& Stroke, FBrushSDFBatch& Batch)
+	{
+		Batch.Unrotate(Stroke.BrushRotation, false);
+		Batch.PadTail();
+
+		const float Height = Stroke.BrushLength;
+		const float HalfHeight = Height * 0.5f;
+		const float BaseSize = Stroke.BrushRadius;
+		const float SlopeModifier = FMath::Tan(FMath::DegreesToRadians(Stroke.BrushAngle)) * 0.1f;
+
+		for (int32 Index = 0; Index < Batch.NumPadded(); ++Index)
+		{
+			const float LX = Batch.X[Index];
+			const float LY = Batch.Y[Index];
+			const float LZ = Batch.Z[Index];
+			const float Horizontal = FMath::Max(FMath::Abs(LX), FMath::Abs(LY));
+
+			float Distance;
+			if (LZ < -HalfHeight)
+			{
+				const float BaseDistance = Horizontal - BaseSize;
+				const float BelowBase = -LZ - HalfHeight;
+				Distance = BaseDistance <= 0.0f ? BelowBase : FMath::Sqrt(BaseDistance * BaseDistance + BelowBase * BelowBase);
+			}
+			else if (LZ > HalfHeight)
+			{
+				const float AboveTip = LZ - HalfHeight;
+				Distance = FMath::Sqrt(LX * LX + LY * LY + AboveTip * AboveTip);
+			}
+			else
+			{
+				const float HeightRatio = (LZ + HalfHeight) / Height;
+				const float PyramidSize = FMath::Max(0.0f, BaseSize * (1.0f - HeightRatio + SlopeModifier));
+				Distance = Horizontal - PyramidSize;
+			}
+			Batch.Distance[Index] = Distance;
+		}
+
+		ApplyFalloffProfile(Stroke, Batch, ShellProfile);
+	}
+
+	void Icosphere(const FBrushStroke& Stroke, FBrushSDFBatch& Batch)
+	{
+		Batch.Unrotate(Stroke.BrushRotation, false);
+		Batch.PadTail();
+
+		const float Radius = Stroke.BrushRadius;
+		const float OuterRadius = Stroke.BrushRadius + Stroke.BrushFalloff;
+		const float DistortionScale = 0.1f * Radius; // 10% distortion
+
+		for (int32 Index = 0; Index < Batch.NumPadded(); ++Index)
+		{
+			const FVector LocalPos(Batch.X[Index], Batch.Y[Index], Batch.Z[Index]);
+			float BaseDistance = LocalPos.Size();
+
+			// Past the undistorted shell the shape returns 0 outright, push it past the cutoff
+			if (BaseDistance > OuterRadius)
+			{
+				Batch.Distance[Index] = MAX_flt;
+				continue;
+			}
+			if (BaseDistance > 0.0f)
+			{
+				BaseDistance += IcosphereDistortion(LocalPos / BaseDistance, Stroke.NumSteps) * DistortionScale;
+			}
+			Batch.Distance[Index] = BaseDistance - Radius;
+		}
+
+		ApplyFalloffProfile(Stroke, Batch, ShellProfile);
+	}
+
+	float IcosphereDistortion(const FVector& NormalizedPos, int32 Subdivisions)
+	{
+		// Simple approximation of icosphere surface using spherical harmonics
+		const float Phi = FMath::Atan2(NormalizedPos.Y, NormalizedPos.X);
+		const float Theta = FMath::Acos(NormalizedPos.Z);
+
+		// Create faceted appearance based on subdivision level
+		const int32 PhiSteps = FMath::Max(1, Subdivisions * 2);
+		const int32 ThetaSteps = FMath::Max(1, Subdivisions);
+
+		const float QuantizedPhi = FMath::Floor(Phi * PhiSteps / (2.0f * PI)) * (2.0f * PI) / PhiSteps;
+		const float QuantizedTheta = FMath::Floor(Theta * ThetaSteps / PI) * PI / ThetaSteps;
+
+		return FMath::Sin(QuantizedPhi * 3.0f) * FMath::Sin(QuantizedTheta * 2.0f) * 0.1f;
+	}
+}
@@ -0,0 +1,71 @@
+// BrushSDFKernels.h
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FBrushStroke;
+
+// Up to MaxSize brush samples in SoA layout, positions relative to the brush centre (BrushPosition + BrushOffset).
+// Lanes past Num are zero padded so kernels can always run whole SIMD registers.
+struct DIGGERPROUNREAL_API FBrushSDFBatch
+{
+	static constexpr int32 MaxSize = 64;
+
+	int32 Num = 0;
+	FVector Center = FVector::ZeroVector;
+
+	alignas(16) float X[MaxSize];
+	alignas(16) float Y[MaxSize];
+	alignas(16) float Z[MaxSize];
+	alignas(16) float WorldZ[MaxSize];
+	alignas(16) float TerrainHeight[MaxSize];
+
+	// Kernel scratch: signed distance to the shape surface, then the final SDF
+	alignas(16) float Distance[MaxSize];
+	alignas(16) float SDF[MaxSize];
+
+	void Begin(const FBrushStroke& Stroke);
+
+	void Add(const FVector& WorldPos, float InTerrainHeight)
+	{
+		checkSlow(Num < MaxSize);
+		const FVector Local = WorldPos - Center;
+		X[Num] = (float)Local.X;
+		Y[Num] = (float)Local.Y;
+		Z[Num] = (float)Local.Z;
+		WorldZ[Num] = (float)WorldPos.Z;
+		TerrainHeight[Num] = InTerrainHeight;
+		++Num;
+	}
+
+	bool IsFull() const { return Num == MaxSize; }
+
+	// Num rounded up to whole SIMD registers
+	int32 NumPadded() const { return Align(Num, 4); }
+
+	FVector GetWorldPos(int32 Index) const { return Center + FVector(X[Index], Y[Index], Z[Index]); }
+
+	// Moves the positions into brush space. The shapes disagree on what counts as "no rotation", hence the flag.
+	void Unrotate(const FRotator& Rotation, bool bSkipNearlyZero);
+
+	// Zero fills the lanes between Num and NumPadded
+	void PadTail();
+};
+
+// Native SDF kernels for the built-in brush shapes. Same results as the shapes' CalculateSDF_Implementation,
+// without the per voxel UObject / Blueprint dispatch. Distances run 4 wide where the math is branch free,
+// the falloff profile is shared and always vectorised.
+namespace BrushSDFKernels
+{
+	DIGGERPROUNREAL_API void Sphere(const FBrushStroke& Stroke, FBrushSDFBatch& Batch);
+	DIGGERPROUNREAL_API void Cube(const FBrushStroke& Stroke, FBrushSDFBatch& Batch);
+	DIGGERPROUNREAL_API void Cylinder(const FBrushStroke& Stroke, FBrushSDFBatch& Batch);
+	DIGGERPROUNREAL_API void Cone(const FBrushStroke& Stroke, FBrushSDFBatch& Batch);
+	DIGGERPROUNREAL_API void Capsule(const FBrushStroke& Stroke, FBrushSDFBatch& Batch);
+	DIGGERPROUNREAL_API void Torus(const FBrushStroke& Stroke, FBrushSDFBatch& Batch);
+	DIGGERPROUNREAL_API void Pyramid(const FBrushStroke& Stroke, FBrushSDFBatch& Batch);
+	DIGGERPROUNREAL_API void Icosphere(const FBrushStroke& Stroke, FBrushSDFBatch& Batch);
+
+	// The faceting term of the icosphere brush, shared with UIcosphereBrushShape
+	DIGGERPROUNREAL_API float IcosphereDistortion(const FVector& NormalizedPos, int32 Subdivisions);
+}
@@ -1,5 +1,6 @@
 #include "CapsuleBrushShape.h"
 
+#include "BrushSDFKernels.h"
 #include "FBrushStroke.h"
 #include "VoxelConversion.h"
 #include "Math/UnrealMathUtility.h"
@@ -81,3 +82,8 @@ bool UCapsuleBrushShape::IsWithinBounds(const FVector& WorldPos, const FBrushStr
     const float RadiusSq = Stroke.BrushRadius * Stroke.BrushRadius;
     return DistanceSq <= RadiusSq;
 }
+
+void UCapsuleBrushShape::CalculateSDFBatch(const FBrushStroke& Stroke, FBrushSDFBatch& Batch) const
+{
+    BrushSDFKernels::Capsule(Stroke, Batch);
+}
@@ -1,5 +1,6 @@
 #include "ConeBrushShape.h"
 
+#include "BrushSDFKernels.h"
 #include "FBrushStroke.h"
 #include "VoxelConversion.h"
 
@@ -83,4 +84,9 @@ bool UConeBrushShape::IsWithinBounds(const FVector& WorldPos, const FBrushStroke
     }
 
     return Distance <= Stroke.BrushFalloff;
-}
\ No newline at end of file
+}
+
+void UConeBrushShape::CalculateSDFBatch(const FBrushStroke& Stroke, FBrushSDFBatch& Batch) const
+{
+    BrushSDFKernels::Cone(Stroke, Batch);
+}
@@ -1,5 +1,6 @@
 #include "CubeBrushShape.h"
 
+#include "BrushSDFKernels.h"
 #include "FBrushStroke.h"
 #include "VoxelConversion.h"
 
@@ -117,3 +118,8 @@ bool UCubeBrushShape::IsWithinBounds(const FVector& WorldPos, const FBrushStroke
 
     return Distance <= 0.0f;
 }
+
+void UCubeBrushShape::CalculateSDFBatch(const FBrushStroke& Stroke, FBrushSDFBatch& Batch) const
+{
+    BrushSDFKernels::Cube(Stroke, Batch);
+}
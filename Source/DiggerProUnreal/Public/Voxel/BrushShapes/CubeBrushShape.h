@@ -19,4 +19,10 @@ public:
     
     // In UVoxelCubeBrushShape.h
     bool IsWithinBounds(const FVector& WorldPos, const FBrushStroke& Stroke) const override;
+
+    // Native batch kernel, see BrushSDFKernels.h
+    virtual void CalculateSDFBatch(const FBrushStroke& Stroke, FBrushSDFBatch& Batch) const override;
+
+protected:
+    virtual bool HasSDFBatchKernel() const override { return true; }
 };
\ No newline at end of file
@@ -1,5 +1,6 @@
 #include "CylinderBrushShape.h"
 
+#include "BrushSDFKernels.h"
 #include "FBrushStroke.h"
 #include "VoxelConversion.h"
 #include "Math/UnrealMathUtility.h"
@@ -106,4 +107,9 @@ bool UCylinderBrushShape::IsWithinBounds(const FVector& WorldPos, const FBrushSt
     const float RadiusSq = Radius * Radius;
     
     return RadialDistanceSq <= RadiusSq;
-}
\ No newline at end of file
+}
+
+void UCylinderBrushShape::CalculateSDFBatch(const FBrushStroke& Stroke, FBrushSDFBatch& Batch) const
+{
+    BrushSDFKernels::Cylinder(Stroke, Batch);
+}
@@ -1,5 +1,6 @@
 #include "IcosphereBrushShape.h"
 
+#include "BrushSDFKernels.h"
 #include "FBrushStroke.h"
 #include "VoxelConversion.h"
 #include "Math/UnrealMathUtility.h"
@@ -78,21 +79,7 @@ float UIcosphereBrushShape::CalculateSDF_Implementation(
 
 float UIcosphereBrushShape::GetIcosphereDistortion(const FVector& NormalizedPos, int32 Subdivisions) const
 {
-    // Simple approximation of icosphere surface using spherical harmonics
-    float Phi = FMath::Atan2(NormalizedPos.Y, NormalizedPos.X);
-    float Theta = FMath::Acos(NormalizedPos.Z);
-    
-    // Create faceted appearance based on subdivision level
-    int32 PhiSteps = FMath::Max(1, Subdivisions * 2);
-    int32 ThetaSteps = FMath::Max(1, Subdivisions);
-    
-    float QuantizedPhi = FMath::Floor(Phi * PhiSteps / (2.0f * PI)) * (2.0f * PI) / PhiSteps;
-    float QuantizedTheta = FMath::Floor(Theta * ThetaSteps / PI) * PI / ThetaSteps;
-    
-    // Create subtle surface variation
-    float Distortion = FMath::Sin(QuantizedPhi * 3.0f) * FMath::Sin(QuantizedTheta * 2.0f) * 0.1f;
-    
-    return Distortion;
+    return BrushSDFKernels::IcosphereDistortion(NormalizedPos, Subdivisions);
 }
 
 bool UIcosphereBrushShape::IsWithinBounds(const FVector& WorldPos, const FBrushStroke& Stroke) const
@@ -103,3 +90,8 @@ bool UIcosphereBrushShape::IsWithinBounds(const FVector& WorldPos, const FBrushS
     const float RadiusSq = Stroke.BrushRadius * Stroke.BrushRadius;
     return DistanceSq <= RadiusSq;
 }
+
+void UIcosphereBrushShape::CalculateSDFBatch(const FBrushStroke& Stroke, FBrushSDFBatch& Batch) const
+{
+    BrushSDFKernels::Icosphere(Stroke, Batch);
+}
@@ -1,5 +1,6 @@
 #include "PyramidBrushShape.h"
 
+#include "BrushSDFKernels.h"
 #include "FBrushStroke.h"
 #include "VoxelConversion.h"
 #include "Math/UnrealMathUtility.h"
@@ -107,3 +108,8 @@ bool UPyramidBrushShape::IsWithinBounds(const FVector& WorldPos, const FBrushStr
     const float RadiusSq = Stroke.BrushRadius * Stroke.BrushRadius;
     return DistanceSq <= RadiusSq;
 }
+
+void UPyramidBrushShape::CalculateSDFBatch(const FBrushStroke& Stroke, FBrushSDFBatch& Batch) const
+{
+    BrushSDFKernels::Pyramid(Stroke, Batch);
+}
@@ -1,5 +1,6 @@
 #include "SphereBrushShape.h"
 
+#include "BrushSDFKernels.h"
 #include "FBrushStroke.h"
 #include "VoxelConversion.h"
 
@@ -59,4 +60,9 @@ bool USphereBrushShape::IsWithinBounds(const FVector& WorldPos, const FBrushStro
     const float DistanceSq = Delta.SizeSquared();
     const float RadiusSq = Stroke.BrushRadius * Stroke.BrushRadius;
     return DistanceSq <= RadiusSq;
-}
\ No newline at end of file
+}
+
+void USphereBrushShape::CalculateSDFBatch(const FBrushStroke& Stroke, FBrushSDFBatch& Batch) const
+{
+    BrushSDFKernels::Sphere(Stroke, Batch);
+}
@@ -1,5 +1,6 @@
 #include "TorusBrushShape.h"
 
+#include "BrushSDFKernels.h"
 #include "FBrushStroke.h"
 #include "VoxelConversion.h"
 
@@ -75,3 +76,7 @@ bool UTorusBrushShape::IsWithinBounds(const FVector& WorldPos, const FBrushStrok
     return Super::IsWithinBounds(WorldPos, Stroke);
 }
 
+void UTorusBrushShape::CalculateSDFBatch(const FBrushStroke& Stroke, FBrushSDFBatch& Batch) const
+{
+    BrushSDFKernels::Torus(Stroke, Batch);
+}
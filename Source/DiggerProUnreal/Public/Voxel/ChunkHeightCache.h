@@ -0,0 +1,50 @@
+// ChunkHeightCache.h
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Landscape heights under one chunk, Dim x Dim samples VoxelSize apart starting at Start (row-major, X fastest).
+// Filled once on the game thread and never changed after, so a mesh job can hold on to it while the game thread
+// drops or rebuilds the chunk's cache.
+struct FChunkHeightCache
+{
+	// Samples past the chunk on every side, for interpolation at the edges
+	static constexpr int32 Padding = 3;
+
+	FVector2D Start = FVector2D::ZeroVector;
+	float VoxelSize = 0.0f;
+	int32 Dim = 0;
+	TArray<float> Heights;
+
+	// XY range a cache for a chunk at ChunkOrigin samples, Z unbounded
+	static FBox GetSampledBounds(const FVector& ChunkOrigin, float InVoxelSize, int32 VoxelsPerChunk)
+	{
+		const FVector Min = ChunkOrigin - FVector(Padding * InVoxelSize);
+		const FVector Max = ChunkOrigin + FVector((VoxelsPerChunk + Padding) * InVoxelSize);
+		return FBox(FVector(Min.X, Min.Y, -UE_BIG_NUMBER), FVector(Max.X, Max.Y, UE_BIG_NUMBER));
+	}
+
+	// Bilinear, clamped to the sampled range
+	float Sample(const FVector& WorldPosition) const
+	{
+		if (Dim < 2)
+		{
+			return 0.0f;
+		}
+
+		const float GridX = FMath::Clamp((float)(WorldPosition.X - Start.X) / VoxelSize, 0.0f, (float)(Dim - 1));
+		const float GridY = FMath::Clamp((float)(WorldPosition.Y - Start.Y) / VoxelSize, 0.0f, (float)(Dim - 1));
+		const int32 X0 = FMath::Min(FMath::FloorToInt(GridX), Dim - 2);
+		const int32 Y0 = FMath::Min(FMath::FloorToInt(GridY), Dim - 2);
+		const float FracX = GridX - X0;
+		const float FracY = GridY - Y0;
+
+		const int32 Row0 = Y0 * Dim + X0;
+		const int32 Row1 = Row0 + Dim;
+		const float H0 = FMath::Lerp(Heights[Row0], Heights[Row0 + 1], FracX);
+		const float H1 = FMath::Lerp(Heights[Row1], Heights[Row1 + 1], FracX);
+		return FMath::Lerp(H0, H1, FracY);
+	}
+};
+
+typedef TSharedPtr<const FChunkHeightCache, ESPMode::ThreadSafe> FChunkHeightCachePtr;
@@ -0,0 +1,85 @@
+// MarchingCubesEdgeCache.h
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Edge-indexed vertex cache for marching cubes (the usual two-slice scheme).
+// Cells are walked with X as the outer loop. Every cube edge lives either between the two current
+// X planes (X-axis edges) or on one of them (Y/Z-axis edges), so two planes of Y/Z edges plus one
+// layer of X edges is enough to share every vertex with no hashing. Slots hold vertex indices, -1 = not emitted yet.
+struct FMarchingCubesEdgeCache
+{
+	// Where a cube edge (0..11) sits relative to its cell, and which end is the low corner
+	struct FEdgeSlot
+	{
+		uint8 Axis;        // 0 = X, 1 = Y, 2 = Z
+		uint8 bHighPlane;  // Y/Z edges only, on plane X+1 instead of X
+		uint8 DY;
+		uint8 DZ;
+		uint8 LowCorner;
+		uint8 HighCorner;
+	};
+
+	// Derives the 12 slots from a corner offset table and the edge -> corner pair table
+	static void BuildEdgeSlots(const FIntVector (&CornerOffsets)[8], const int (&EdgeCorners)[12][2], FEdgeSlot (&OutSlots)[12])
+	{
+		for (int32 Edge = 0; Edge < 12; ++Edge)
+		{
+			const int32 A = EdgeCorners[Edge][0];
+			const int32 B = EdgeCorners[Edge][1];
+			const FIntVector OA = CornerOffsets[A];
+			const FIntVector OB = CornerOffsets[B];
+			const FIntVector Low(FMath::Min(OA.X, OB.X), FMath::Min(OA.Y, OB.Y), FMath::Min(OA.Z, OB.Z));
+
+			FEdgeSlot& Slot = OutSlots[Edge];
+			Slot.Axis = OA.X != OB.X ? 0 : (OA.Y != OB.Y ? 1 : 2);
+			Slot.bHighPlane = (uint8)Low.X;
+			Slot.DY = (uint8)Low.Y;
+			Slot.DZ = (uint8)Low.Z;
+			Slot.LowCorner = (uint8)(OA == Low ? A : B);
+			Slot.HighCorner = (uint8)(OA == Low ? B : A);
+		}
+	}
+
+	// CellsPerSide = N, corners run 0..N
+	void Init(int32 CellsPerSide)
+	{
+		Stride = CellsPerSide + 1;
+		const int32 PlaneSize = Stride * Stride;
+		XEdges.Init(INDEX_NONE, PlaneSize);
+		for (int32 Plane = 0; Plane < 2; ++Plane)
+		{
+			YEdges[Plane].Init(INDEX_NONE, PlaneSize);
+			ZEdges[Plane].Init(INDEX_NONE, PlaneSize);
+		}
+		LowPlane = 0;
+	}
+
+	// Call when the outer X loop moves on: plane X+1 becomes plane X, the new X+1 plane and the X edges start empty
+	void AdvanceX()
+	{
+		LowPlane ^= 1;
+		const int32 NewHigh = LowPlane ^ 1;
+		FMemory::Memset(YEdges[NewHigh].GetData(), 0xFF, YEdges[NewHigh].Num() * sizeof(int32));
+		FMemory::Memset(ZEdges[NewHigh].GetData(), 0xFF, ZEdges[NewHigh].Num() * sizeof(int32));
+		FMemory::Memset(XEdges.GetData(), 0xFF, XEdges.Num() * sizeof(int32));
+	}
+
+	FORCEINLINE int32& Get(const FEdgeSlot& Slot, int32 Y, int32 Z)
+	{
+		const int32 Index = (Y + Slot.DY) * Stride + (Z + Slot.DZ);
+		if (Slot.Axis == 0)
+		{
+			return XEdges[Index];
+		}
+		const int32 Plane = Slot.bHighPlane ? (LowPlane ^ 1) : LowPlane;
+		return Slot.Axis == 1 ? YEdges[Plane][Index] : ZEdges[Plane][Index];
+	}
+
+private:
+	int32 Stride = 0;
+	int32 LowPlane = 0;
+	TArray<int32> XEdges;
+	TArray<int32> YEdges[2];
+	TArray<int32> ZEdges[2];
+};
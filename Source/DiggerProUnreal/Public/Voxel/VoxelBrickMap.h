@@ -0,0 +1,299 @@
+// VoxelBrickMap.h
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Bricked voxel storage used by USparseVoxelGrid.
+// Voxels are grouped into 8x8x8 dense bricks that are allocated lazily, so a lookup is one small
+// brick-map probe plus an array index instead of a hash per voxel. Bricks that are completely filled
+// with one value (all air / all solid) collapse to a single uniform value and drop their dense array.
+// The interface mirrors the subset of TMap the grid code used (Find/Contains/Add/Remove/Num/iteration).
+template <typename ValueType>
+class TVoxelBrickMap
+{
+public:
+	static constexpr int32 BrickShift = 3;
+	static constexpr int32 BrickDim = 1 << BrickShift;
+	static constexpr int32 BrickMask = BrickDim - 1;
+	static constexpr int32 BrickVolume = BrickDim * BrickDim * BrickDim;
+	static constexpr int32 MaskWords = BrickVolume / 64;
+
+	struct FBrick
+	{
+		// One bit per voxel, a voxel only "exists" when its bit is set
+		uint64 Occupancy[MaskWords] = {};
+		int32 NumSet = 0;
+
+		// Only valid while the brick is uniform (fully occupied, single value, Values empty)
+		ValueType UniformValue = ValueType();
+
+		// Dense values, indexed X + Y*8 + Z*64
+		TArray<ValueType> Values;
+
+		FORCEINLINE bool IsUniform() const { return Values.Num() == 0; }
+		FORCEINLINE bool IsSet(int32 Index) const { return (Occupancy[Index >> 6] >> (Index & 63)) & 1ull; }
+
+		FORCEINLINE const ValueType& Get(int32 Index) const
+		{
+			return IsUniform() ? UniformValue : Values[Index];
+		}
+
+		void Expand()
+		{
+			if (IsUniform())
+			{
+				Values.Init(UniformValue, BrickVolume);
+			}
+		}
+
+		bool TryCollapse()
+		{
+			if (IsUniform() || NumSet != BrickVolume)
+			{
+				return false;
+			}
+			const ValueType& First = Values[0];
+			for (int32 i = 1; i < BrickVolume; ++i)
+			{
+				if (!(Values[i] == First))
+				{
+					return false;
+				}
+			}
+			UniformValue = First;
+			Values.Empty();
+			return true;
+		}
+	};
+
+	FORCEINLINE static FIntVector ToBrick(const FIntVector& Voxel)
+	{
+		// Arithmetic shift floors negative (overflow slab) coordinates into the correct brick
+		return FIntVector(Voxel.X >> BrickShift, Voxel.Y >> BrickShift, Voxel.Z >> BrickShift);
+	}
+
+	FORCEINLINE static int32 ToLocalIndex(const FIntVector& Voxel)
+	{
+		return (Voxel.X & BrickMask) | ((Voxel.Y & BrickMask) << BrickShift) | ((Voxel.Z & BrickMask) << (BrickShift * 2));
+	}
+
+	FORCEINLINE static FIntVector FromBrick(const FIntVector& Brick, int32 Index)
+	{
+		return FIntVector(
+			(Brick.X << BrickShift) | (Index & BrickMask),
+			(Brick.Y << BrickShift) | ((Index >> BrickShift) & BrickMask),
+			(Brick.Z << BrickShift) | (Index >> (BrickShift * 2)));
+	}
+
+	const ValueType* Find(const FIntVector& Voxel) const
+	{
+		const FBrick* Brick = Bricks.Find(ToBrick(Voxel));
+		if (!Brick)
+		{
+			return nullptr;
+		}
+		const int32 Index = ToLocalIndex(Voxel);
+		return Brick->IsSet(Index) ? &Brick->Get(Index) : nullptr;
+	}
+
+	// Mutable access expands a uniform brick so the write only touches this voxel.
+	// Kept separate from Find so plain reads never de-uniform a brick.
+	ValueType* FindMutable(const FIntVector& Voxel)
+	{
+		FBrick* Brick = Bricks.Find(ToBrick(Voxel));
+		if (!Brick)
+		{
+			return nullptr;
+		}
+		const int32 Index = ToLocalIndex(Voxel);
+		if (!Brick->IsSet(Index))
+		{
+			return nullptr;
+		}
+		Brick->Expand();
+		return &Brick->Values[Index];
+	}
+
+	// Like TMap::operator[], the voxel must exist
+	const ValueType& operator[](const FIntVector& Voxel) const
+	{
+		const ValueType* Value = Find(Voxel);
+		check(Value);
+		return *Value;
+	}
+
+	FORCEINLINE bool Contains(const FIntVector& Voxel) const
+	{
+		const FBrick* Brick = Bricks.Find(ToBrick(Voxel));
+		return Brick && Brick->IsSet(ToLocalIndex(Voxel));
+	}
+
+	void Add(const FIntVector& Voxel, const ValueType& Value)
+	{
+		FBrick& Brick = Bricks.FindOrAdd(ToBrick(Voxel));
+		const int32 Index = ToLocalIndex(Voxel);
+
+		if (Brick.IsUniform())
+		{
+			if (Brick.NumSet == BrickVolume)
+			{
+				if (Brick.UniformValue == Value)
+				{
+					return;
+				}
+				Brick.Expand();
+			}
+			else
+			{
+				// Freshly allocated brick
+				Brick.Values.SetNum(BrickVolume);
+			}
+		}
+
+		Brick.Values[Index] = Value;
+		if (!Brick.IsSet(Index))
+		{
+			Brick.Occupancy[Index >> 6] |= (1ull << (Index & 63));
+			++Brick.NumSet;
+			++NumVoxels;
+		}
+	}
+
+	int32 Remove(const FIntVector& Voxel)
+	{
+		const FIntVector BrickKey = ToBrick(Voxel);
+		FBrick* Brick = Bricks.Find(BrickKey);
+		if (!Brick)
+		{
+			return 0;
+		}
+		const int32 Index = ToLocalIndex(Voxel);
+		if (!Brick->IsSet(Index))
+		{
+			return 0;
+		}
+
+		Brick->Expand();
+		Brick->Occupancy[Index >> 6] &= ~(1ull << (Index & 63));
+		--NumVoxels;
+		if (--Brick->NumSet == 0)
+		{
+			Bricks.Remove(BrickKey);
+		}
+		return 1;
+	}
+
+	// Collapses every full brick whose voxels all share one value. Returns the number of bricks collapsed.
+	int32 Compact()
+	{
+		int32 Collapsed = 0;
+		for (auto& Pair : Bricks)
+		{
+			Collapsed += Pair.Value.TryCollapse() ? 1 : 0;
+		}
+		return Collapsed;
+	}
+
+	void Empty()
+	{
+		Bricks.Empty();
+		NumVoxels = 0;
+	}
+
+	FORCEINLINE int32 Num() const { return NumVoxels; }
+	FORCEINLINE bool IsEmpty() const { return NumVoxels == 0; }
+	FORCEINLINE int32 NumBricks() const { return Bricks.Num(); }
+
+	int32 NumUniformBricks() const
+	{
+		int32 Count = 0;
+		for (const auto& Pair : Bricks)
+		{
+			Count += Pair.Value.IsUniform() ? 1 : 0;
+		}
+		return Count;
+	}
+
+	// Rough heap footprint, used for debug/benchmark reporting
+	SIZE_T GetAllocatedSize() const
+	{
+		SIZE_T Size = Bricks.GetAllocatedSize();
+		for (const auto& Pair : Bricks)
+		{
+			Size += Pair.Value.Values.GetAllocatedSize();
+		}
+		return Size;
+	}
+
+	const TMap<FIntVector, FBrick>& GetBricks() const { return Bricks; }
+
+	// Range-for support, yields { Key, Value } like a TMap pair (read-only)
+	struct FPair
+	{
+		FIntVector Key;
+		const ValueType& Value;
+	};
+
+	struct FEndSentinel {};
+
+	class TConstIterator
+	{
+	public:
+		explicit TConstIterator(const TMap<FIntVector, FBrick>& InBricks)
+			: BrickIt(InBricks.CreateConstIterator())
+		{
+			SkipToSet();
+		}
+
+		FPair operator*() const
+		{
+			const FBrick& Brick = BrickIt.Value();
+			return FPair{ FromBrick(BrickIt.Key(), Index), Brick.Get(Index) };
+		}
+
+		TConstIterator& operator++()
+		{
+			++Index;
+			SkipToSet();
+			return *this;
+		}
+
+		explicit operator bool() const { return (bool)BrickIt; }
+		bool operator!=(const FEndSentinel&) const { return (bool)BrickIt; }
+
+		FIntVector Key() const { return FromBrick(BrickIt.Key(), Index); }
+		const ValueType& Value() const { return BrickIt.Value().Get(Index); }
+
+	private:
+		void SkipToSet()
+		{
+			while (BrickIt)
+			{
+				const FBrick& Brick = BrickIt.Value();
+				while (Index < BrickVolume)
+				{
+					const uint64 Word = Brick.Occupancy[Index >> 6] >> (Index & 63);
+					if (Word != 0)
+					{
+						Index += (int32)FMath::CountTrailingZeros64(Word);
+						return;
+					}
+					Index = (Index | 63) + 1;
+				}
+				++BrickIt;
+				Index = 0;
+			}
+		}
+
+		typename TMap<FIntVector, FBrick>::TConstIterator BrickIt;
+		int32 Index = 0;
+	};
+
+	TConstIterator CreateConstIterator() const { return TConstIterator(Bricks); }
+	TConstIterator begin() const { return TConstIterator(Bricks); }
+	FEndSentinel end() const { return FEndSentinel(); }
+
+private:
+	TMap<FIntVector, FBrick> Bricks;
+	int32 NumVoxels = 0;
+};
@@ -0,0 +1,139 @@
+// VoxelDenseSlab.h
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Dense, padded copy of a cubic range of a sparse voxel grid, made once before meshing so the
+// per-corner work is plain array reads instead of storage lookups. Covers [Min, Max] on every axis
+// (the chunk plus its overflow slab and whatever neighbourhood the mesher looks at), Z is the fastest axis.
+struct FVoxelDenseSlab
+{
+	int32 Min = 0;
+	int32 Dim = 0;
+	// Voxels per sample, see BuildDownsampled
+	int32 Step = 1;
+
+	// SDF per sample, 0 where the grid had nothing
+	TArray<float> Values;
+	// 1 where the grid had an explicit voxel
+	TArray<uint8> Explicit;
+
+	// Works with anything iterable as { Key, Value.SDFValue } pairs (FVoxelBrickMap, TMap<FIntVector, FVoxelData>)
+	template <typename VoxelMapType>
+	void Build(const VoxelMapType& VoxelData, int32 InMin, int32 InMax)
+	{
+		Min = InMin;
+		Dim = InMax - InMin + 1;
+		Step = 1;
+		const int32 Total = Dim * Dim * Dim;
+		Values.SetNumZeroed(Total);
+		Explicit.SetNumZeroed(Total);
+
+		for (const auto& Pair : VoxelData)
+		{
+			const FIntVector& Key = Pair.Key;
+			if (InRange(Key.X, Key.Y, Key.Z))
+			{
+				const int32 Index = ToIndex(Key.X, Key.Y, Key.Z);
+				Values[Index] = Pair.Value.SDFValue;
+				Explicit[Index] = 1;
+			}
+		}
+	}
+
+	// Every InStep-th voxel of [InMin, InMax] for reduced LOD meshing. Point sampled rather than filtered, so a voxel on
+	// a chunk border reads the same from both chunks whatever their LODs. Coordinates are in samples from here on:
+	// voxel X is sample (X - InMin) / InStep, and Min is 0.
+	template <typename VoxelMapType>
+	void BuildDownsampled(const VoxelMapType& VoxelData, int32 InMin, int32 InMax, int32 InStep)
+	{
+		Min = 0;
+		Step = InStep;
+		Dim = (InMax - InMin) / InStep + 1;
+		const int32 Total = Dim * Dim * Dim;
+		Values.SetNumZeroed(Total);
+		Explicit.SetNumZeroed(Total);
+
+		for (const auto& Pair : VoxelData)
+		{
+			const FIntVector Offset = Pair.Key - FIntVector(InMin);
+			if (Offset.X % InStep != 0 || Offset.Y % InStep != 0 || Offset.Z % InStep != 0)
+			{
+				continue;
+			}
+
+			const FIntVector Sample = Offset / InStep;
+			if (InRange(Sample.X, Sample.Y, Sample.Z))
+			{
+				const int32 Index = ToIndex(Sample.X, Sample.Y, Sample.Z);
+				Values[Index] = Pair.Value.SDFValue;
+				Explicit[Index] = 1;
+			}
+		}
+	}
+
+	// Fills the slab's layer at Layer along Axis from a neighbouring chunk's grid, whose voxel coordinates are ours
+	// shifted by NeighbourShift along that axis. Only explicit voxels are copied, the rest stay unset.
+	template <typename VoxelMapType>
+	void FillLayerFromNeighbour(const VoxelMapType& NeighbourData, int32 Axis, int32 Layer, int32 NeighbourShift)
+	{
+		const int32 Axis1 = (Axis + 1) % 3;
+		const int32 Axis2 = (Axis + 2) % 3;
+		FIntVector P;
+		P[Axis] = Layer;
+		for (int32 A = Min; A < Min + Dim; ++A)
+		for (int32 B = Min; B < Min + Dim; ++B)
+		{
+			P[Axis1] = A;
+			P[Axis2] = B;
+			FIntVector NeighbourVoxel = P;
+			NeighbourVoxel[Axis] -= NeighbourShift;
+			if (const auto* Voxel = NeighbourData.Find(NeighbourVoxel))
+			{
+				const int32 Index = ToIndex(P.X, P.Y, P.Z);
+				Values[Index] = Voxel->SDFValue;
+				Explicit[Index] = 1;
+			}
+		}
+	}
+
+	FORCEINLINE bool InRange(int32 X, int32 Y, int32 Z) const
+	{
+		// Unsigned compare folds the < Min and > Max checks into one
+		return (uint32)(X - Min) < (uint32)Dim && (uint32)(Y - Min) < (uint32)Dim && (uint32)(Z - Min) < (uint32)Dim;
+	}
+
+	FORCEINLINE int32 ToIndex(int32 X, int32 Y, int32 Z) const
+	{
+		return ((X - Min) * Dim + (Y - Min)) * Dim + (Z - Min);
+	}
+
+	// Index offsets for stepping one sample along each axis
+	FORCEINLINE int32 StrideX() const { return Dim * Dim; }
+	FORCEINLINE int32 StrideY() const { return Dim; }
+
+	FORCEINLINE bool Contains(int32 X, int32 Y, int32 Z) const
+	{
+		return InRange(X, Y, Z) && Explicit[ToIndex(X, Y, Z)] != 0;
+	}
+
+	// Caller checks Contains first
+	FORCEINLINE float GetValue(int32 X, int32 Y, int32 Z) const
+	{
+		return Values[ToIndex(X, Y, Z)];
+	}
+
+	// Builds a per-sample mask of explicit voxels with SDF > 0 (explicit air), flat loop over the whole slab
+	void BuildExplicitAirMask(TArray<uint8>& OutMask) const
+	{
+		const int32 Total = Values.Num();
+		OutMask.SetNumUninitialized(Total);
+		const float* RESTRICT V = Values.GetData();
+		const uint8* RESTRICT E = Explicit.GetData();
+		uint8* RESTRICT M = OutMask.GetData();
+		for (int32 i = 0; i < Total; ++i)
+		{
+			M[i] = E[i] & (uint8)(V[i] > 0.0f);
+		}
+	}
+};
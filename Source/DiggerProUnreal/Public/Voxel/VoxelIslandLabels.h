@@ -0,0 +1,547 @@
+// VoxelIslandLabels.h
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Persistent connected-component labels for the solid voxels of one grid (26-connected, same rule as
+// USparseVoxelGrid::DetectIslands). Writes only widen a dirty box. Update re-floods that box plus a margin
+// and stitches the result back onto the labels around it: merges are O(1) label aliases, and a split costs
+// a walk of the smaller side. An edit that disconnects nothing (the usual dig) never looks outside the box.
+// Not thread safe by itself, USparseVoxelGrid drives it under VoxelDataMutex.
+struct FVoxelIslandLabels
+{
+	// Slack around the dirty box, keeps the untouched rim of a dig inside the re-flood so both sides of
+	// the hole get stitched through it instead of through a walk outside the box
+	static constexpr int32 Margin = 2;
+
+	bool IsValid() const { return bValid; }
+	bool NeedsUpdate() const { return !bValid || bHasDirty; }
+
+	// Next Update does a full rebuild (bulk loads, raw storage replacement...)
+	void Invalidate()
+	{
+		bValid = false;
+		bHasDirty = false;
+	}
+
+	void MarkDirty(const FIntVector& Voxel)
+	{
+		if (!bValid)
+		{
+			return;
+		}
+		if (!bHasDirty)
+		{
+			DirtyMin = DirtyMax = Voxel;
+			bHasDirty = true;
+			return;
+		}
+		DirtyMin = FIntVector(FMath::Min(DirtyMin.X, Voxel.X), FMath::Min(DirtyMin.Y, Voxel.Y), FMath::Min(DirtyMin.Z, Voxel.Z));
+		DirtyMax = FIntVector(FMath::Max(DirtyMax.X, Voxel.X), FMath::Max(DirtyMax.Y, Voxel.Y), FMath::Max(DirtyMax.Z, Voxel.Z));
+	}
+
+	int32 NumIslands() const { return Sizes.Num(); }
+	const TMap<int32, int32>& GetIslandSizes() const { return Sizes; }
+
+	int32 GetIslandSize(int32 Label) const
+	{
+		const int32* Size = Sizes.Find(FindRootConst(Label));
+		return Size ? *Size : 0;
+	}
+
+	// Island label of a solid voxel, INDEX_NONE for air / unknown
+	int32 GetLabel(const FIntVector& Voxel) const
+	{
+		const int32* Label = Labels.Find(Voxel);
+		return Label ? FindRootConst(*Label) : INDEX_NONE;
+	}
+
+	// Func(const FIntVector& Voxel, int32 Label) for every labelled voxel, Label already resolved
+	template <typename FuncType>
+	void ForEachLabel(FuncType&& Func) const
+	{
+		for (const TPair<FIntVector, int32>& Pair : Labels)
+		{
+			Func(Pair.Key, FindRootConst(Pair.Value));
+		}
+	}
+
+	// Full flood fill of every solid voxel in VoxelData (anything iterable as { Key, Value } pairs)
+	template <typename VoxelMapType, typename IsSolidType>
+	void Rebuild(const VoxelMapType& VoxelData, IsSolidType&& IsSolid)
+	{
+		Labels.Reset();
+		LabelParent.Reset();
+		Sizes.Reset();
+		NextLabel = 0;
+
+		TArray<FIntVector> Stack;
+		for (const auto& Pair : VoxelData)
+		{
+			const FIntVector& Start = Pair.Key;
+			if (Labels.Contains(Start) || !IsSolid(Start))
+			{
+				continue;
+			}
+
+			const int32 Label = NextLabel++;
+			int32 Count = 0;
+			Labels.Add(Start, Label);
+			Stack.Add(Start);
+			while (Stack.Num() > 0)
+			{
+				const FIntVector Current = Stack.Pop(false);
+				++Count;
+				for (const FIntVector& Dir : GetNeighbourOffsets())
+				{
+					const FIntVector Neighbour = Current + Dir;
+					if (!Labels.Contains(Neighbour) && IsSolid(Neighbour))
+					{
+						Labels.Add(Neighbour, Label);
+						Stack.Add(Neighbour);
+					}
+				}
+			}
+			Sizes.Add(Label, Count);
+		}
+
+		bValid = true;
+		bHasDirty = false;
+	}
+
+	// Brings the labels up to date with everything marked dirty since the last call. OutNewIslands gets the
+	// labels of islands that appeared in this update (broke off, or added floating), empty after a full rebuild.
+	template <typename VoxelMapType, typename IsSolidType>
+	void Update(const VoxelMapType& VoxelData, IsSolidType&& IsSolid, TArray<int32>& OutNewIslands)
+	{
+		OutNewIslands.Reset();
+		if (!bValid)
+		{
+			Rebuild(VoxelData, IsSolid);
+			return;
+		}
+		if (!bHasDirty)
+		{
+			return;
+		}
+
+		const FIntVector Min = DirtyMin - FIntVector(Margin);
+		const FIntVector Max = DirtyMax + FIntVector(Margin);
+		const FIntVector Extent = Max - Min + FIntVector(1);
+		bHasDirty = false;
+
+		// A box bigger than the grid's voxel count is cheaper to redo from scratch
+		if ((int64)Extent.X * Extent.Y * Extent.Z > (int64)FMath::Max(VoxelData.Num(), 4096))
+		{
+			Rebuild(VoxelData, IsSolid);
+			return;
+		}
+
+		UpdateRegion(Min, Max, IsSolid, OutNewIslands);
+	}
+
+private:
+	static const TArray<FIntVector>& GetNeighbourOffsets()
+	{
+		static const TArray<FIntVector> Offsets = []()
+		{
+			TArray<FIntVector> Result;
+			for (int32 DX = -1; DX <= 1; ++DX)
+			for (int32 DY = -1; DY <= 1; ++DY)
+			for (int32 DZ = -1; DZ <= 1; ++DZ)
+			{
+				if (DX != 0 || DY != 0 || DZ != 0)
+				{
+					Result.Add(FIntVector(DX, DY, DZ));
+				}
+			}
+			return Result;
+		}();
+		return Offsets;
+	}
+
+	int32 FindRootConst(int32 Label) const
+	{
+		while (const int32* Parent = LabelParent.Find(Label))
+		{
+			Label = *Parent;
+		}
+		return Label;
+	}
+
+	int32 FindRoot(int32 Label)
+	{
+		const int32 Root = FindRootConst(Label);
+		// Path compression
+		while (int32* Parent = LabelParent.Find(Label))
+		{
+			const int32 Next = *Parent;
+			*Parent = Root;
+			Label = Next;
+		}
+		return Root;
+	}
+
+	// Aliases the smaller island into the bigger one, returns the survivor
+	int32 MergeLabels(int32 A, int32 B)
+	{
+		A = FindRoot(A);
+		B = FindRoot(B);
+		if (A == B)
+		{
+			return A;
+		}
+		if (Sizes.FindRef(A) < Sizes.FindRef(B))
+		{
+			Swap(A, B);
+		}
+		Sizes.FindOrAdd(A) += Sizes.FindRef(B);
+		Sizes.Remove(B);
+		LabelParent.Add(B, A);
+		return A;
+	}
+
+	template <typename IsSolidType>
+	void UpdateRegion(const FIntVector& Min, const FIntVector& Max, IsSolidType&& IsSolid, TArray<int32>& OutNewIslands)
+	{
+		auto InBox = [&Min, &Max](const FIntVector& V)
+		{
+			return V.X >= Min.X && V.X <= Max.X && V.Y >= Min.Y && V.Y <= Max.Y && V.Z >= Min.Z && V.Z <= Max.Z;
+		};
+
+		// 1. Drop the old labels inside the box, remembering which islands lost voxels there
+		TSet<int32> AffectedRoots;
+		for (int32 X = Min.X; X <= Max.X; ++X)
+		for (int32 Y = Min.Y; Y <= Max.Y; ++Y)
+		for (int32 Z = Min.Z; Z <= Max.Z; ++Z)
+		{
+			const FIntVector Voxel(X, Y, Z);
+			if (const int32* Label = Labels.Find(Voxel))
+			{
+				const int32 Root = FindRoot(*Label);
+				AffectedRoots.Add(Root);
+				--Sizes.FindOrAdd(Root);
+				Labels.Remove(Voxel);
+			}
+		}
+
+		// 2. Flood the solid voxels inside the box into local components
+		TMap<FIntVector, int32> LocalComponent;
+		TArray<TArray<FIntVector>> LocalVoxels;
+		TArray<FIntVector> Stack;
+		for (int32 X = Min.X; X <= Max.X; ++X)
+		for (int32 Y = Min.Y; Y <= Max.Y; ++Y)
+		for (int32 Z = Min.Z; Z <= Max.Z; ++Z)
+		{
+			const FIntVector Start(X, Y, Z);
+			if (LocalComponent.Contains(Start) || !IsSolid(Start))
+			{
+				continue;
+			}
+
+			const int32 Component = LocalVoxels.AddDefaulted();
+			LocalComponent.Add(Start, Component);
+			Stack.Add(Start);
+			while (Stack.Num() > 0)
+			{
+				const FIntVector Current = Stack.Pop(false);
+				LocalVoxels[Component].Add(Current);
+				for (const FIntVector& Dir : GetNeighbourOffsets())
+				{
+					const FIntVector Neighbour = Current + Dir;
+					if (InBox(Neighbour) && !LocalComponent.Contains(Neighbour) && IsSolid(Neighbour))
+					{
+						LocalComponent.Add(Neighbour, Component);
+						Stack.Add(Neighbour);
+					}
+				}
+			}
+		}
+
+		// 3. Labelled voxels on the shell just outside the box are where the box meets the old islands
+		TArray<FIntVector> Contacts;
+		TMap<FIntVector, int32> ContactIndex;
+		TMap<int32, TArray<int32>> ContactsByRoot;
+		for (int32 X = Min.X - 1; X <= Max.X + 1; ++X)
+		for (int32 Y = Min.Y - 1; Y <= Max.Y + 1; ++Y)
+		for (int32 Z = Min.Z - 1; Z <= Max.Z + 1; ++Z)
+		{
+			const FIntVector Voxel(X, Y, Z);
+			if (InBox(Voxel))
+			{
+				continue;
+			}
+			if (const int32* Label = Labels.Find(Voxel))
+			{
+				const int32 Index = Contacts.Add(Voxel);
+				ContactIndex.Add(Voxel, Index);
+				ContactsByRoot.FindOrAdd(FindRoot(*Label)).Add(Index);
+			}
+		}
+
+		// 4. Union-find over local components [0, NumLocal) and contacts [NumLocal, ...)
+		const int32 NumLocal = LocalVoxels.Num();
+		TArray<int32> Parent;
+		Parent.SetNumUninitialized(NumLocal + Contacts.Num());
+		for (int32 i = 0; i < Parent.Num(); ++i)
+		{
+			Parent[i] = i;
+		}
+		auto Find = [&Parent](int32 Node)
+		{
+			while (Parent[Node] != Node)
+			{
+				Parent[Node] = Parent[Parent[Node]];
+				Node = Parent[Node];
+			}
+			return Node;
+		};
+		auto Union = [&Parent, &Find](int32 A, int32 B)
+		{
+			A = Find(A);
+			B = Find(B);
+			if (A != B)
+			{
+				Parent[B] = A;
+			}
+		};
+
+		for (int32 i = 0; i < Contacts.Num(); ++i)
+		{
+			for (const FIntVector& Dir : GetNeighbourOffsets())
+			{
+				if (const int32* Component = LocalComponent.Find(Contacts[i] + Dir))
+				{
+					Union(NumLocal + i, *Component);
+				}
+			}
+		}
+
+		// Contacts of the same old island are connected outside the box, unless the box is what held it
+		// together. Only islands that lost voxels in the box can have come apart.
+		TArray<bool> bContactInPiece;
+		bContactInPiece.Init(false, Contacts.Num());
+		TArray<TArray<FIntVector>> Pieces;
+		TArray<int32> PieceContact;
+
+		for (const TPair<int32, TArray<int32>>& Pair : ContactsByRoot)
+		{
+			const int32 Root = Pair.Key;
+			const TArray<int32>& Group = Pair.Value;
+			if (!AffectedRoots.Contains(Root))
+			{
+				for (int32 i = 1; i < Group.Num(); ++i)
+				{
+					Union(NumLocal + Group[0], NumLocal + Group[i]);
+				}
+				continue;
+			}
+
+			for (;;)
+			{
+				int32 Anchor = INDEX_NONE;
+				int32 Stray = INDEX_NONE;
+				for (const int32 Contact : Group)
+				{
+					if (bContactInPiece[Contact])
+					{
+						continue;
+					}
+					if (Anchor == INDEX_NONE)
+					{
+						Anchor = Contact;
+					}
+					else if (Find(NumLocal + Contact) != Find(NumLocal + Anchor))
+					{
+						Stray = Contact;
+						break;
+					}
+				}
+				if (Stray == INDEX_NONE)
+				{
+					break;
+				}
+
+				// Walk the island outside the box from both ends at once. The first walk to reach a contact in
+				// another set joins the two, a walk that runs dry has found a piece that broke off. Either way
+				// the cost is bounded by the smaller side.
+				FOutsideWalk Walks[2];
+				Walks[0].Start(Contacts[Anchor], Find(NumLocal + Anchor));
+				Walks[1].Start(Contacts[Stray], Find(NumLocal + Stray));
+
+				bool bResolved = false;
+				while (!bResolved)
+				{
+					for (FOutsideWalk& Walk : Walks)
+					{
+						int32 Reached = INDEX_NONE;
+						const bool bMore = Walk.Step(Root, InBox, [&](const FIntVector& Voxel)
+						{
+							const int32* Index = ContactIndex.Find(Voxel);
+							if (Index && !bContactInPiece[*Index] && Find(NumLocal + *Index) != Find(Walk.Set))
+							{
+								Reached = *Index;
+								return true;
+							}
+							return false;
+						}, *this);
+
+						if (Reached != INDEX_NONE)
+						{
+							Union(Walk.Set, NumLocal + Reached);
+							bResolved = true;
+							break;
+						}
+						if (!bMore)
+						{
+							for (const FIntVector& Voxel : Walk.Queue)
+							{
+								if (const int32* Index = ContactIndex.Find(Voxel))
+								{
+									bContactInPiece[*Index] = true;
+								}
+							}
+							PieceContact.Add(Walk.StartContact);
+							Pieces.Add(MoveTemp(Walk.Queue));
+							bResolved = true;
+							break;
+						}
+					}
+				}
+			}
+		}
+
+		// 5. Each union-find set is one island now. Sets holding surviving old islands keep the biggest one
+		// (the rest alias into it), sets with none get a fresh label.
+		TMap<int32, int32> SetLabel;
+		for (int32 i = 0; i < Contacts.Num(); ++i)
+		{
+			if (bContactInPiece[i])
+			{
+				continue;
+			}
+			const int32 Set = Find(NumLocal + i);
+			const int32 Root = FindRoot(Labels.FindChecked(Contacts[i]));
+			if (int32* Existing = SetLabel.Find(Set))
+			{
+				*Existing = MergeLabels(*Existing, Root);
+			}
+			else
+			{
+				SetLabel.Add(Set, Root);
+			}
+		}
+
+		auto LabelForSet = [&](int32 Set)
+		{
+			if (const int32* Existing = SetLabel.Find(Set))
+			{
+				return FindRoot(*Existing);
+			}
+			const int32 Label = NextLabel++;
+			Sizes.Add(Label, 0);
+			SetLabel.Add(Set, Label);
+			OutNewIslands.Add(Label);
+			return Label;
+		};
+
+		for (int32 i = 0; i < Pieces.Num(); ++i)
+		{
+			const int32 Target = LabelForSet(Find(NumLocal + ContactIndex.FindChecked(PieceContact[i])));
+			for (const FIntVector& Voxel : Pieces[i])
+			{
+				int32& Label = Labels.FindChecked(Voxel);
+				const int32 OldRoot = FindRoot(Label);
+				if (OldRoot != Target)
+				{
+					--Sizes.FindOrAdd(OldRoot);
+					++Sizes.FindOrAdd(Target);
+				}
+				Label = Target;
+			}
+		}
+
+		for (int32 Component = 0; Component < NumLocal; ++Component)
+		{
+			const int32 Target = LabelForSet(Find(Component));
+			for (const FIntVector& Voxel : LocalVoxels[Component])
+			{
+				Labels.Add(Voxel, Target);
+			}
+			Sizes.FindOrAdd(Target) += LocalVoxels[Component].Num();
+		}
+
+		// Islands dug away completely
+		for (auto It = Sizes.CreateIterator(); It; ++It)
+		{
+			if (It.Value() <= 0)
+			{
+				It.RemoveCurrent();
+			}
+		}
+		OutNewIslands.RemoveAll([this](int32 Label) { return !Sizes.Contains(FindRootConst(Label)); });
+	}
+
+	// Breadth first walk over one old island's voxels outside the dirty box
+	struct FOutsideWalk
+	{
+		TArray<FIntVector> Queue;
+		TSet<FIntVector> Visited;
+		FIntVector StartContact;
+		int32 Head = 0;
+		int32 Set = INDEX_NONE;
+
+		void Start(const FIntVector& Contact, int32 InSet)
+		{
+			StartContact = Contact;
+			Set = InSet;
+			Queue.Add(Contact);
+			Visited.Add(Contact);
+		}
+
+		// Expands one voxel. Returns false once the walk has run dry. Stops early (returning true) when
+		// ShouldStop accepts a neighbour.
+		template <typename InBoxType, typename ShouldStopType>
+		bool Step(int32 Root, InBoxType& InBox, ShouldStopType&& ShouldStop, FVoxelIslandLabels& Owner)
+		{
+			if (Head >= Queue.Num())
+			{
+				return false;
+			}
+			const FIntVector Current = Queue[Head++];
+			for (const FIntVector& Dir : GetNeighbourOffsets())
+			{
+				const FIntVector Neighbour = Current + Dir;
+				if (InBox(Neighbour) || Visited.Contains(Neighbour))
+				{
+					continue;
+				}
+				const int32* Label = Owner.Labels.Find(Neighbour);
+				if (!Label || Owner.FindRoot(*Label) != Root)
+				{
+					continue;
+				}
+				if (ShouldStop(Neighbour))
+				{
+					return true;
+				}
+				Visited.Add(Neighbour);
+				Queue.Add(Neighbour);
+			}
+			return Head < Queue.Num();
+		}
+	};
+
+	// Solid voxel -> label (resolve through LabelParent)
+	TMap<FIntVector, int32> Labels;
+	// Merged label -> label it was merged into
+	TMap<int32, int32> LabelParent;
+	// Root label -> voxel count
+	TMap<int32, int32> Sizes;
+	int32 NextLabel = 0;
+
+	FIntVector DirtyMin = FIntVector::ZeroValue;
+	FIntVector DirtyMax = FIntVector::ZeroValue;
+	bool bHasDirty = false;
+	bool bValid = false;
+};
@@ -0,0 +1,249 @@
+// VoxelLODContour.h
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Boundaries of a reduced LOD chunk that touch a chunk meshed one level finer. Bits 0..5 are the faces
+// (-X, +X, -Y, +Y, -Z, +Z), bits 6..17 the twelve chunk edges, for when only the diagonal neighbour across an edge is finer.
+struct FVoxelLODTransitions
+{
+	static constexpr int32 NumFaces = 6;
+	static constexpr int32 NumEdges = 12;
+
+	uint32 Mask = 0;
+
+	bool IsEmpty() const { return Mask == 0; }
+	bool Has(int32 Bit) const { return (Mask & (1u << Bit)) != 0; }
+	void Set(int32 Bit) { Mask |= 1u << Bit; }
+
+	static int32 FaceBit(int32 Axis, bool bHigh) { return Axis * 2 + (bHigh ? 1 : 0); }
+
+	// Edge running along Axis, on the low / high side of the two other axes, (Axis + 1) % 3 and (Axis + 2) % 3
+	static int32 EdgeBit(int32 Axis, bool bHighU, bool bHighV)
+	{
+		return NumFaces + Axis * 4 + (bHighU ? 1 : 0) + (bHighV ? 2 : 0);
+	}
+
+	// Chunk offset of the neighbour across a face / edge bit
+	static FIntVector NeighbourOffset(int32 Bit)
+	{
+		FIntVector Offset(0, 0, 0);
+		if (Bit < NumFaces)
+		{
+			Offset[Bit / 2] = (Bit & 1) ? 1 : -1;
+			return Offset;
+		}
+		const int32 Edge = Bit - NumFaces;
+		const int32 Axis = Edge / 4;
+		Offset[(Axis + 1) % 3] = (Edge & 1) ? 1 : -1;
+		Offset[(Axis + 2) % 3] = (Edge & 2) ? 1 : -1;
+		return Offset;
+	}
+
+	// Cell face with normal Axis at lattice coordinate Coord, chunk spans [0, Max]
+	bool IsSubdividedFace(int32 Axis, int32 Coord, int32 Max) const
+	{
+		return (Coord == 0 && Has(FaceBit(Axis, false))) || (Coord == Max && Has(FaceBit(Axis, true)));
+	}
+
+	// Cell edge running along EdgeAxis from Low
+	bool IsSubdividedEdge(const FIntVector& Low, int32 EdgeAxis, int32 Max) const
+	{
+		const int32 U = (EdgeAxis + 1) % 3;
+		const int32 V = (EdgeAxis + 2) % 3;
+		const bool bOnU = Low[U] == 0 || Low[U] == Max;
+		const bool bOnV = Low[V] == 0 || Low[V] == Max;
+		if ((bOnU && IsSubdividedFace(U, Low[U], Max)) || (bOnV && IsSubdividedFace(V, Low[V], Max)))
+		{
+			return true;
+		}
+		return bOnU && bOnV && Has(EdgeBit(EdgeAxis, Low[U] == Max, Low[V] == Max));
+	}
+};
+
+// Marching cubes for one cell without a case table: every face is contoured on its own, the face segments are chained
+// into loops and each loop is fanned. A face shared by two cells comes out the same from both, so a cell can split the
+// faces and edges lying on a transition boundary at the finer neighbour's resolution (Transvoxel's transition cells)
+// and still meet its regular neighbours with no cracks. Cells are K lattice steps wide, K = 2 when there are transitions.
+struct FVoxelCellPolygonizer
+{
+	struct FSegment
+	{
+		int32 Start;
+		int32 End;
+	};
+
+	using FSegmentArray = TArray<FSegment, TInlineAllocator<48>>;
+
+	// Corners of each cell face (-X, +X, -Y, +Y, -Z, +Z), counter clockwise seen from outside the cell
+	static const FIntVector& FaceCorner(int32 Face, int32 Corner)
+	{
+		static const FIntVector Corners[6][4] = {
+			{ FIntVector(0, 0, 0), FIntVector(0, 0, 1), FIntVector(0, 1, 1), FIntVector(0, 1, 0) },
+			{ FIntVector(1, 0, 0), FIntVector(1, 1, 0), FIntVector(1, 1, 1), FIntVector(1, 0, 1) },
+			{ FIntVector(0, 0, 0), FIntVector(1, 0, 0), FIntVector(1, 0, 1), FIntVector(0, 0, 1) },
+			{ FIntVector(0, 1, 0), FIntVector(0, 1, 1), FIntVector(1, 1, 1), FIntVector(1, 1, 0) },
+			{ FIntVector(0, 0, 0), FIntVector(0, 1, 0), FIntVector(1, 1, 0), FIntVector(1, 0, 0) },
+			{ FIntVector(0, 0, 1), FIntVector(1, 0, 1), FIntVector(1, 1, 1), FIntVector(0, 1, 1) }
+		};
+		return Corners[Face][Corner];
+	}
+
+	// Sample(P) -> SDF at lattice point P (< 0 is solid). EdgeVertex(Low, High, LowValue, HighValue) -> vertex index of the
+	// crossing on that lattice edge, called with the low end first. Triangles wind like the marching cubes table.
+	template <typename SampleType, typename EdgeVertexType>
+	static void Polygonize(const FIntVector& Base, int32 K, int32 Max, const FVoxelLODTransitions& Transitions,
+		SampleType&& Sample, EdgeVertexType&& EdgeVertex, TArray<int32>& OutTriangles)
+	{
+		FSegmentArray Segments;
+
+		for (int32 Face = 0; Face < 6; ++Face)
+		{
+			FIntVector Corners[4];
+			for (int32 i = 0; i < 4; ++i)
+			{
+				Corners[i] = Base + FaceCorner(Face, i) * K;
+			}
+
+			// On a transition face: the four quarters, matching the finer chunk's cells on the other side
+			if (K > 1 && Transitions.IsSubdividedFace(Face / 2, Corners[0][Face / 2], Max))
+			{
+				const FIntVector Center = (Corners[0] + Corners[2]) / 2;
+				for (int32 i = 0; i < 4; ++i)
+				{
+					const FIntVector Quarter[4] = {
+						Corners[i],
+						(Corners[i] + Corners[(i + 1) % 4]) / 2,
+						Center,
+						(Corners[(i + 3) % 4] + Corners[i]) / 2
+					};
+					ContourPolygon(Quarter, 4, Sample, EdgeVertex, Segments);
+				}
+				continue;
+			}
+
+			// Otherwise one polygon, with the midpoint of any edge that lies on a transition boundary
+			FIntVector Polygon[8];
+			int32 NumPoints = 0;
+			for (int32 i = 0; i < 4; ++i)
+			{
+				const FIntVector& A = Corners[i];
+				const FIntVector& B = Corners[(i + 1) % 4];
+				Polygon[NumPoints++] = A;
+				if (K > 1)
+				{
+					const int32 EdgeAxis = A.X != B.X ? 0 : (A.Y != B.Y ? 1 : 2);
+					const FIntVector& Low = A[EdgeAxis] < B[EdgeAxis] ? A : B;
+					if (Transitions.IsSubdividedEdge(Low, EdgeAxis, Max))
+					{
+						Polygon[NumPoints++] = (A + B) / 2;
+					}
+				}
+			}
+			ContourPolygon(Polygon, NumPoints, Sample, EdgeVertex, Segments);
+		}
+
+		// Every crossing ends one segment and starts another, so the segments close into loops
+		TArray<bool, TInlineAllocator<48>> Used;
+		Used.SetNumZeroed(Segments.Num());
+		TArray<int32, TInlineAllocator<16>> Loop;
+		for (int32 First = 0; First < Segments.Num(); ++First)
+		{
+			if (Used[First])
+			{
+				continue;
+			}
+			Used[First] = true;
+
+			Loop.Reset();
+			Loop.Add(Segments[First].Start);
+			int32 Current = Segments[First].End;
+			bool bClosed = false;
+			while (Loop.Num() <= Segments.Num())
+			{
+				if (Current == Loop[0])
+				{
+					bClosed = true;
+					break;
+				}
+				Loop.Add(Current);
+
+				int32 Next = INDEX_NONE;
+				for (int32 s = First + 1; s < Segments.Num(); ++s)
+				{
+					if (!Used[s] && Segments[s].Start == Current)
+					{
+						Next = s;
+						break;
+					}
+				}
+				if (Next == INDEX_NONE)
+				{
+					break;
+				}
+				Used[Next] = true;
+				Current = Segments[Next].End;
+			}
+
+			if (bClosed && Loop.Num() >= 3)
+			{
+				for (int32 i = 1; i + 1 < Loop.Num(); ++i)
+				{
+					OutTriangles.Add(Loop[0]);
+					OutTriangles.Add(Loop[i]);
+					OutTriangles.Add(Loop[i + 1]);
+				}
+			}
+		}
+	}
+
+private:
+	// Points are the polygon's corners in order, counter clockwise seen from outside the cell
+	template <typename SampleType, typename EdgeVertexType>
+	static void ContourPolygon(const FIntVector* Points, int32 NumPoints, SampleType& Sample, EdgeVertexType& EdgeVertex,
+		FSegmentArray& OutSegments)
+	{
+		float Values[8];
+		float Sum = 0.0f;
+		for (int32 i = 0; i < NumPoints; ++i)
+		{
+			Values[i] = Sample(Points[i]);
+			Sum += Values[i];
+		}
+
+		struct FCrossing
+		{
+			int32 Vertex;
+			bool bLeavesSolid;
+		};
+		FCrossing Crossings[8];
+		int32 NumCrossings = 0;
+		for (int32 i = 0; i < NumPoints; ++i)
+		{
+			const int32 j = (i + 1) % NumPoints;
+			const bool bSolidI = Values[i] < 0.0f;
+			if (bSolidI == (Values[j] < 0.0f))
+			{
+				continue;
+			}
+
+			const FIntVector& A = Points[i];
+			const FIntVector& B = Points[j];
+			const bool bAIsLow = A.X + A.Y + A.Z < B.X + B.Y + B.Z;
+			const int32 Vertex = bAIsLow ? EdgeVertex(A, B, Values[i], Values[j]) : EdgeVertex(B, A, Values[j], Values[i]);
+			Crossings[NumCrossings++] = { Vertex, bSolidI };
+		}
+
+		// Each segment runs from a crossing leaving the solid to one entering it. With more than two crossings the
+		// polygon is ambiguous and its mean picks the pairing: a solid middle keeps the solid runs joined.
+		const bool bJoinSolid = Sum < 0.0f;
+		for (int32 c = 0; c < NumCrossings; ++c)
+		{
+			if (Crossings[c].bLeavesSolid)
+			{
+				const int32 Enter = bJoinSolid ? (c + 1) % NumCrossings : (c + NumCrossings - 1) % NumCrossings;
+				OutSegments.Add({ Crossings[c].Vertex, Crossings[Enter].Vertex });
+			}
+		}
+	}
+};
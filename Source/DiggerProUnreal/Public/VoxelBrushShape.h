@@ -8,6 +8,7 @@
 
 class ADiggerManager;
 class UVoxelChunk;
+struct FBrushSDFBatch;
 
 
 UCLASS()
@@ -42,6 +43,13 @@ public:
 		const FBrushStroke& Stroke,
 		float TerrainHeight
 	) const { return 0.0f; }
+
+	// Whole-batch SDF evaluation. Built-in shapes run native kernels, the base version goes voxel by voxel
+	// through CalculateSDF. Check HasNativeSDFBatch to know which one you'll get.
+	virtual void CalculateSDFBatch(const FBrushStroke& Stroke, FBrushSDFBatch& Batch) const;
+
+	// False for shapes without a kernel and for Blueprint subclasses that override CalculateSDF
+	bool HasNativeSDFBatch() const;
 	
 	
 	UFUNCTION(BlueprintCallable, Category = "Brush")
@@ -97,6 +105,8 @@ public:
 	virtual bool IsWithinBounds(const FVector& WorldPos, const FBrushStroke& Stroke) const;
 
 protected:
+	virtual bool HasSDFBatchKernel() const { return false; }
+
 	//Brush Settings
 	// Size and location of the brush
 	float BrushSize;
@@ -16,6 +16,7 @@ class VoxelBrushShape;
 class USparseVoxelGrid;
 class UMarchingCubes;
 class UProceduralMeshComponent;
+struct FDecodedChunkPayload;
 
 
 // First, add this struct definition to your header file (e.g., in VoxelChunk.h or a separate types header)
@@ -65,6 +66,7 @@ public:
     // Initialization
     void InitializeChunk(const FIntVector& InChunkCoordinates, ADiggerManager* InDiggerManager);
     void InitializeMeshComponent(UProceduralMeshComponent* MeshComponent);
+    void InitializeCollisionComponent(UProceduralMeshComponent* CollisionComponent);
     void InitializeDiggerManager(ADiggerManager* InDiggerManager);
     void RestoreAllHoles();
     void OnMarchingMeshComplete() const;
@@ -97,6 +99,13 @@ public:
     // Brush application
     UFUNCTION(BlueprintCallable, Category = "Voxel")
     void ApplyBrushStroke(const FBrushStroke& Stroke);
+    // Several stamps of one drag in a single pass: every voxel is visited once and the stamps are unioned.
+    // The stamps should share bDig.
+    void ApplyBrushStrokes(TArrayView<const FBrushStroke> Strokes);
+    static constexpr int32 MaxStrokesPerPass = 64;
+    // Dry run of ApplyBrushStrokes against a chunk's voxel box, no grid needed: true if any stamp would write
+    // a voxel there. Brush passes use it to skip creating chunks a shape only grazes.
+    static bool WouldBrushStrokesWrite(const FIntVector& ChunkCoords, TArrayView<const FBrushStroke> Strokes, ADiggerManager* Manager);
     void WriteToOverflows(const FIntVector& LocalVoxelCoords, int32 StorageX, int32 StorageY, int32 StorageZ, float SDF,
                           bool bDig);
     void InitializeBrushShapes();
@@ -104,6 +113,8 @@ public:
     // Update functions
     UFUNCTION(BlueprintCallable, Category  =Custom)
     void MarkDirty();
+    // Queues a remesh without counting as an edit, e.g. when the chunk's mesh LOD changes
+    void RequestRemesh();
     UFUNCTION(BlueprintCallable, Category  =Custom)
     void UpdateIfDirty();
     UFUNCTION(BlueprintCallable, Category  =Custom)
@@ -114,6 +125,15 @@ public:
     bool SaveChunkData(const FString& FilePath);
     bool LoadChunkData(const FString& FilePath);
     bool LoadChunkData(const FString& FilePath, bool bOverwrite);
+
+    // Region pack payload (quantized voxels + hole data), stored by FVoxelRegionFile
+    bool SaveChunkPayload(TArray<uint8>& OutPayload);
+    bool LoadChunkPayload(const TArray<uint8>& Payload, bool bOverwrite);
+
+    // Split load for LoadAllChunksAsync: decode on any thread (no UObjects touched), apply on the game thread
+    static bool DecodeChunkPayload(const TArray<uint8>& Payload, FDecodedChunkPayload& OutDecoded);
+    static bool DecodeLegacyChunkFile(const TArray<uint8>& FileData, FDecodedChunkPayload& OutDecoded);
+    void ApplyDecodedPayload(FDecodedChunkPayload&& Decoded, bool bOverwrite);
     void ClearSpawnedHoles();
     void SpawnHoleMeshes();
     AActor* SpawnTransientActor(UWorld* InWorld, TSubclassOf<AActor> ActorClass, FVector Location, FRotator Rotation,
@@ -143,8 +163,15 @@ public:
     UFUNCTION(BluePrintCallable)
     USparseVoxelGrid* GetSparseVoxelGrid() const;
     UMarchingCubes* GetMarchingCubesGenerator() const { return MarchingCubesGenerator; }
+    UProceduralMeshComponent* GetMeshComponent() const { return ProceduralMeshComponent; }
+    UProceduralMeshComponent* GetCollisionComponent() const { return CollisionMeshComponent; }
     TMap<FIntVector, float> GetActiveVoxels() const;
     bool IsDirty() const { return bIsDirty; }
+    // For the manager's mesh scheduler, which takes over the rebuild once it dispatches a job
+    void ClearDirty() { bIsDirty = false; }
+    // Voxels or holes changed since the last save / load, chunk streaming saves these before evicting
+    bool HasUnsavedChanges() const { return bHasUnsavedChanges; }
+    void ClearUnsavedChanges() { bHasUnsavedChanges = false; }
     
 
     // Setters
@@ -176,14 +203,9 @@ private:
     TMap<EVoxelBrushType, UVoxelBrushShape*> CachedBrushShapes;
     UVoxelBrushShape* GetBrushShapeForType(EVoxelBrushType BrushType);
     
-public:
-    UFUNCTION(NetMulticast, Reliable)
-    void MulticastApplyBrushStroke(const FBrushStroke& Stroke);
-
-private:
     FCriticalSection BrushStrokeMutex;
     
-    FVector CalculateBrushBounds(const FBrushStroke& Stroke) const;
+    FBox CalculateBrushBounds(const FBrushStroke& Stroke) const;
     
 
     void CreateSolidShellAroundAirVoxels(const TArray<FIntVector>& AirVoxels, bool bHiddenSeam = false);
@@ -207,6 +229,7 @@ private:
 
 private:
     bool bIsDirty;
+    bool bHasUnsavedChanges = false;
     
     UPROPERTY()
     UWorld* World;
@@ -222,4 +245,8 @@ private:
 
     UPROPERTY()
     UProceduralMeshComponent* ProceduralMeshComponent;
+
+    // Hidden, collision only. Render uploads never touch it, the manager re-cooks it from the uploaded vertices.
+    UPROPERTY()
+    UProceduralMeshComponent* CollisionMeshComponent;
 };
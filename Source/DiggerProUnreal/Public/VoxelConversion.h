@@ -234,6 +234,46 @@ static FIntVector ChunkAndLocalToGlobalVoxel_CenterAligned(const FIntVector& Chu
         return bValidX && bValidY && bValidZ;
     }
 
+    /**
+     * Chunks whose storage range (IsValidVoxelIndex, overflow included) can hold a global voxel.
+     * The canonical owner always comes first; at most one extra chunk per axis, so never more than 8.
+     *
+     * @param GlobalVoxelCoords - Center-aligned global voxel
+     * @param OutChunks - Candidate chunk coordinates, owner first
+     */
+    static void GetStorageChunkCandidates(const FIntVector& GlobalVoxelCoords, TArray<FIntVector, TInlineAllocator<8>>& OutChunks)
+    {
+        const int32 VoxelsPerChunk = ChunkSize * Subdivisions;
+        FIntVector Owner, Local;
+        GlobalVoxelToChunkAndLocal_CenterAligned(GlobalVoxelCoords, Owner, Local);
+
+        // Per axis: which chunk offsets (-1, 0, +1) still see this voxel inside [-2, VoxelsPerChunk]
+        int32 AxisOffsets[3][2];
+        int32 AxisCount[3];
+        for (int32 Axis = 0; Axis < 3; ++Axis)
+        {
+            AxisOffsets[Axis][0] = 0;
+            AxisCount[Axis] = 1;
+            const int32 L = Local[Axis];
+            if (L + VoxelsPerChunk <= VoxelsPerChunk)
+            {
+                AxisOffsets[Axis][AxisCount[Axis]++] = -1;
+            }
+            else if (L - VoxelsPerChunk >= -2)
+            {
+                AxisOffsets[Axis][AxisCount[Axis]++] = 1;
+            }
+        }
+
+        OutChunks.Reset();
+        for (int32 IX = 0; IX < AxisCount[0]; ++IX)
+        for (int32 IY = 0; IY < AxisCount[1]; ++IY)
+        for (int32 IZ = 0; IZ < AxisCount[2]; ++IZ)
+        {
+            OutChunks.Add(Owner + FIntVector(AxisOffsets[0][IX], AxisOffsets[1][IY], AxisOffsets[2][IZ]));
+        }
+    }
+
     /**
      * Converts voxel indices (where 0,0,0 is the minimum corner) to world position.
      * This coordinate system treats the minimum corner of the chunk as the origin,
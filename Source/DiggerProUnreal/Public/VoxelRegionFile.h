@@ -0,0 +1,49 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Region pack save format. RegionSize^3 chunks share one "Region_X_Y_Z.VoxelRegion" file in the save directory
+ * instead of one file per chunk.
+ *
+ * Layout: header (magic, version, entry count), offset table (one FEntry per stored chunk), then one blob per
+ * chunk, zlib compressed when that actually saves space. Loading a single chunk reads the header and the table
+ * and seeks straight to its blob, the rest of the region is never touched.
+ *
+ * Payloads are opaque here, UVoxelChunk::SaveChunkPayload / LoadChunkPayload define what goes in them.
+ * All functions are static and stateless, safe to call from worker threads for different files.
+ */
+struct DIGGERPROUNREAL_API FVoxelRegionFile
+{
+	static constexpr int32 RegionSize = 16;
+	static const TCHAR* Extension;
+
+	enum class ECompression : uint8
+	{
+		None = 0,
+		Zlib = 1,
+	};
+
+	struct FEntry
+	{
+		FIntVector ChunkCoords = FIntVector::ZeroValue;
+		int64 Offset = 0;
+		int32 StoredSize = 0;
+		int32 RawSize = 0;
+		ECompression Compression = ECompression::None;
+	};
+
+	static FIntVector ChunkToRegion(const FIntVector& ChunkCoords);
+	static FString GetRegionFilePath(const FString& SaveDirectory, const FIntVector& RegionCoords);
+	static bool ParseRegionFileName(const FString& FileName, FIntVector& OutRegionCoords);
+
+	// Header + offset table only
+	static bool ReadTable(const FString& FilePath, TArray<FEntry>& OutEntries);
+	static bool ReadChunk(const FString& FilePath, const FIntVector& ChunkCoords, TArray<uint8>& OutPayload);
+	// Whole file in one read, for bulk loads
+	static bool ReadAllChunks(const FString& FilePath, TMap<FIntVector, TArray<uint8>>& OutPayloads);
+
+	// Rewrites the region with Payloads added or replaced and RemoveChunks dropped. Other chunks already in the
+	// file are carried over as stored blobs, without a decompress / recompress. Payloads are compressed in parallel.
+	static bool WriteChunks(const FString& FilePath, const TMap<FIntVector, TArray<uint8>>& Payloads, const TSet<FIntVector>& RemoveChunks);
+};
@@ -10,7 +10,7 @@ const io = new Server(server, {
   }
 });
 
-const PORT = 3001;
+const PORT = Number(process.env.PORT) || 3001;
 
 let lobbies = {}; // { lobbyName: { users: [user1, user2], ... } }
 
@@ -48,6 +48,15 @@ io.on('connection', (socket) => {
     socket.to(lobbyName).emit('receiveBrushStroke', strokeData);
   });
 
+  // Binary stroke batches (see stroke-codec.js), relayed untouched as one attachment
+  socket.on('sendBrushStrokes', ({ lobbyName, strokes } = {}) => {
+    if (!lobbyName || !Buffer.isBuffer(strokes)) {
+      return;
+    }
+    console.log(`🎨 ${strokes.length} byte stroke batch in ${lobbyName}`);
+    socket.to(lobbyName).emit('receiveBrushStrokes', strokes);
+  });
+
   socket.on('disconnect', () => {
     const { lobbyName, userName } = socket.data || {};
     console.log(`❌ Disconnected: ${userName || socket.id}`);
@@ -0,0 +1,221 @@
+// Stand-in for the socket.io server, preloaded by loopback-test.js (node -r ./loopback-socketio.js index.js).
+// It only takes over when require('socket.io') fails. The vendored engine.io and socket.io-parser ship
+// without their build/ output, so index.js cannot start from this checkout as it stands.
+//
+// Covers the part of the API index.js uses: connection, on/emit, join, to(room).emit, socket.data and
+// disconnect. The protocol is Engine.IO 4 / Socket.IO 5 over the websocket transport, default namespace
+// only, so a stock socket.io-client running with transports: ['websocket'] can connect too.
+
+const Module = require('module');
+
+function realSocketIoLoads() {
+  try {
+    require.resolve('socket.io');
+    require('socket.io');
+    return true;
+  } catch (err) {
+    return false;
+  }
+}
+
+// Swaps Buffers for placeholders, Socket.IO style, and collects them as attachments
+function deconstruct(value, attachments) {
+  if (Buffer.isBuffer(value) || value instanceof Uint8Array) {
+    attachments.push(Buffer.from(value.buffer, value.byteOffset, value.byteLength));
+    return { _placeholder: true, num: attachments.length - 1 };
+  }
+  if (Array.isArray(value)) {
+    return value.map((v) => deconstruct(v, attachments));
+  }
+  if (value && typeof value === 'object') {
+    const out = {};
+    for (const key of Object.keys(value)) {
+      out[key] = deconstruct(value[key], attachments);
+    }
+    return out;
+  }
+  return value;
+}
+
+function reconstruct(value, attachments) {
+  if (Array.isArray(value)) {
+    return value.map((v) => reconstruct(v, attachments));
+  }
+  if (value && typeof value === 'object') {
+    if (value._placeholder === true && Number.isInteger(value.num)) {
+      return attachments[value.num];
+    }
+    const out = {};
+    for (const key of Object.keys(value)) {
+      out[key] = reconstruct(value[key], attachments);
+    }
+    return out;
+  }
+  return value;
+}
+
+// Socket.IO packets for one event, "2[...]" or "5<n>-[...]" followed by n binary attachments
+function encodeEvent(args) {
+  const attachments = [];
+  const json = JSON.stringify(deconstruct(args, attachments));
+  if (attachments.length === 0) {
+    return ['2' + json];
+  }
+  return ['5' + attachments.length + '-' + json, ...attachments];
+}
+
+let nextId = 0;
+
+class Socket {
+  constructor(server, ws) {
+    this.server = server;
+    this.ws = ws;
+    this.id = `loopback-${++nextId}`;
+    this.data = {};
+    this.rooms = new Set([this.id]);
+    this.handlers = new Map();
+    this.pending = null;
+  }
+
+  on(event, handler) {
+    if (!this.handlers.has(event)) {
+      this.handlers.set(event, []);
+    }
+    this.handlers.get(event).push(handler);
+    return this;
+  }
+
+  join(room) {
+    this.rooms.add(room);
+  }
+
+  emit(event, ...args) {
+    this.send(encodeEvent([event, ...args]));
+    return true;
+  }
+
+  to(room) {
+    return this.server.to(room, this);
+  }
+
+  send(frames) {
+    for (const frame of frames) {
+      this.ws.send(typeof frame === 'string' ? '4' + frame : frame, { binary: typeof frame !== 'string' });
+    }
+  }
+
+  dispatch(event, args) {
+    for (const handler of this.handlers.get(event) || []) {
+      handler(...args);
+    }
+  }
+
+  receive(data, isBinary) {
+    if (isBinary) {
+      if (!this.pending) {
+        return;
+      }
+      this.pending.attachments.push(Buffer.from(data));
+      if (this.pending.attachments.length === this.pending.count) {
+        const { args, attachments } = this.pending;
+        this.pending = null;
+        const [event, ...rest] = reconstruct(args, attachments);
+        this.dispatch(event, rest);
+      }
+      return;
+    }
+
+    const text = data.toString();
+    switch (text[0]) {
+      case '2': // ping
+        this.ws.send('3' + text.slice(1));
+        return;
+      case '4': // message
+        break;
+      default:
+        return;
+    }
+
+    const packet = text.slice(1);
+    if (packet[0] === '0') {
+      this.send(['0' + JSON.stringify({ sid: this.id })]);
+      this.server.dispatch('connection', this);
+    } else if (packet[0] === '2') {
+      const [event, ...rest] = JSON.parse(packet.slice(1));
+      this.dispatch(event, rest);
+    } else if (packet[0] === '5') {
+      const dash = packet.indexOf('-');
+      const count = Number(packet.slice(1, dash));
+      this.pending = { count, args: JSON.parse(packet.slice(dash + 1)), attachments: [] };
+    } else if (packet[0] === '1') {
+      this.ws.close();
+    }
+  }
+}
+
+class Server {
+  constructor(httpServer) {
+    const { WebSocketServer } = require('ws');
+    this.sockets = new Set();
+    this.handlers = new Map();
+    this.wss = new WebSocketServer({ server: httpServer, path: '/socket.io/' });
+    this.wss.on('connection', (ws) => {
+      const socket = new Socket(this, ws);
+      this.sockets.add(socket);
+      ws.send('0' + JSON.stringify({ sid: socket.id, upgrades: [], pingInterval: 25000, pingTimeout: 20000, maxPayload: 1e6 }));
+      ws.on('message', (data, isBinary) => socket.receive(data, isBinary));
+      ws.on('close', () => {
+        this.sockets.delete(socket);
+        socket.dispatch('disconnect', ['transport close']);
+      });
+    });
+  }
+
+  on(event, handler) {
+    if (!this.handlers.has(event)) {
+      this.handlers.set(event, []);
+    }
+    this.handlers.get(event).push(handler);
+    return this;
+  }
+
+  dispatch(event, ...args) {
+    for (const handler of this.handlers.get(event) || []) {
+      handler(...args);
+    }
+  }
+
+  emit(event, ...args) {
+    const frames = encodeEvent([event, ...args]);
+    for (const socket of this.sockets) {
+      socket.send(frames);
+    }
+    return true;
+  }
+
+  to(room, except) {
+    return {
+      emit: (event, ...args) => {
+        const frames = encodeEvent([event, ...args]);
+        for (const socket of this.sockets) {
+          if (socket !== except && socket.rooms.has(room)) {
+            socket.send(frames);
+          }
+        }
+        return true;
+      }
+    };
+  }
+}
+
+if (!realSocketIoLoads()) {
+  const load = Module._load;
+  Module._load = function (request, parent, isMain) {
+    if (request === 'socket.io') {
+      return { Server };
+    }
+    return load.call(this, request, parent, isMain);
+  };
+}
+
+module.exports = { Server };
@@ -0,0 +1,307 @@
+// Loopback check of the stroke relay: starts index.js on a spare port, joins two clients to one lobby and
+// replays the same simulated drag as JSON strokes (sendBrushStroke) and as binary batches (sendBrushStrokes).
+// Verifies what arrives and prints the bytes each stroke cost on the wire.
+//
+// The clients speak Engine.IO 4 / Socket.IO 5 straight over ws, so the only dependency is the ws package.
+// index.js is preloaded with loopback-socketio.js, which stands in for socket.io when the vendored copy
+// does not load.
+//
+//   node loopback-test.js [strokeCount] [batchWindowMs]
+
+const path = require('path');
+const { spawn } = require('child_process');
+const WebSocket = require('ws');
+const codec = require('./stroke-codec');
+
+const PORT = Number(process.env.PORT) || 3101;
+const STROKE_COUNT = Number(process.argv[2]) || 600;
+const BATCH_WINDOW_MS = Number(process.argv[3]) || 50;
+const STAMP_INTERVAL_MS = 1000 / 60; // the editor stamps once per tick
+const LOBBY = 'LoopbackLobby';
+
+// A wandering dig drag, with the occasional radius change from the brush slider
+function makeDrag(count) {
+  const strokes = [];
+  let x = 12000.0, y = -3400.0, z = 250.0, heading = 0.3, radius = 150;
+  for (let i = 0; i < count; i++) {
+    heading += Math.sin(i * 0.07) * 0.05;
+    x += Math.cos(heading) * 9.37;
+    y += Math.sin(heading) * 9.37;
+    z += Math.sin(i * 0.2) * 0.8;
+    if (i % 120 === 119) {
+      radius += 25;
+    }
+    strokes.push({
+      brushType: codec.BrushType.Sphere,
+      position: { x, y, z },
+      radius,
+      strength: 1,
+      falloff: 0.2,
+      dig: true
+    });
+  }
+  return strokes;
+}
+
+// The whole FBrushStroke, the way it used to go out as strokeData
+function toJsonStroke(s) {
+  const full = { ...codec.DEFAULT_STROKE, ...s };
+  return {
+    BrushType: full.brushType,
+    BrushPosition: { X: full.position.x, Y: full.position.y, Z: full.position.z },
+    BrushRadius: full.radius,
+    BrushStrength: full.strength,
+    BrushFalloff: full.falloff,
+    BrushRotation: { Pitch: full.rotation.pitch, Yaw: full.rotation.yaw, Roll: full.rotation.roll },
+    BrushLength: full.length,
+    BrushAngle: full.angle,
+    BrushOffset: { X: full.offset.x, Y: full.offset.y, Z: full.offset.z },
+    bHiddenSeam: full.hiddenSeam,
+    LightColor: { R: 1, G: 1, B: 1, A: 1 },
+    bDig: full.dig,
+    bUseAdvancedCubeBrush: full.useAdvancedCube,
+    AdvancedCubeHalfExtentX: full.cubeHalfExtents.x,
+    AdvancedCubeHalfExtentY: full.cubeHalfExtents.y,
+    AdvancedCubeHalfExtentZ: full.cubeHalfExtents.z,
+    TorusInnerRadius: full.torusInnerRadius,
+    NumSteps: full.numSteps,
+    bSpiral: full.spiral,
+    bIsFilled: full.filled,
+    WallThickness: full.wallThickness,
+    HoleShape: full.holeShape,
+    LightType: full.lightType
+  };
+}
+
+function startServer() {
+  return new Promise((resolve, reject) => {
+    const server = spawn(process.execPath, ['-r', path.join(__dirname, 'loopback-socketio.js'), path.join(__dirname, 'index.js')], {
+      env: { ...process.env, PORT: String(PORT) },
+      stdio: ['ignore', 'pipe', 'inherit']
+    });
+    server.on('error', reject);
+    server.on('exit', (code) => reject(new Error(`server exited early (${code})`)));
+    server.stdout.on('data', (chunk) => {
+      if (chunk.toString().includes('running')) {
+        server.removeAllListeners('exit');
+        resolve(server);
+      }
+    });
+  });
+}
+
+// Swaps Buffers for Socket.IO attachment placeholders
+function deconstruct(value, attachments) {
+  if (Buffer.isBuffer(value)) {
+    attachments.push(value);
+    return { _placeholder: true, num: attachments.length - 1 };
+  }
+  if (Array.isArray(value)) {
+    return value.map((v) => deconstruct(v, attachments));
+  }
+  if (value && typeof value === 'object') {
+    return Object.fromEntries(Object.entries(value).map(([k, v]) => [k, deconstruct(v, attachments)]));
+  }
+  return value;
+}
+
+function reconstruct(value, attachments) {
+  if (Array.isArray(value)) {
+    return value.map((v) => reconstruct(v, attachments));
+  }
+  if (value && typeof value === 'object') {
+    if (value._placeholder === true) {
+      return attachments[value.num];
+    }
+    return Object.fromEntries(Object.entries(value).map(([k, v]) => [k, reconstruct(v, attachments)]));
+  }
+  return value;
+}
+
+// Minimal Socket.IO client on the default namespace. Counts the Engine.IO payload bytes it sends
+// (WebSocket frame headers not included).
+class LoopbackClient {
+  constructor(ws) {
+    this.ws = ws;
+    this.sentBytes = 0;
+    this.sentFrames = 0;
+    this.handlers = new Map();
+    this.pending = null;
+  }
+
+  on(event, handler) {
+    if (!this.handlers.has(event)) {
+      this.handlers.set(event, new Set());
+    }
+    this.handlers.get(event).add(handler);
+  }
+
+  off(event, handler) {
+    this.handlers.get(event)?.delete(handler);
+  }
+
+  emit(event, ...args) {
+    const attachments = [];
+    const json = JSON.stringify(deconstruct([event, ...args], attachments));
+    this.sendFrame(attachments.length ? `5${attachments.length}-${json}` : `2${json}`);
+    attachments.forEach((a) => this.sendFrame(a));
+  }
+
+  sendFrame(packet) {
+    const data = typeof packet === 'string' ? '4' + packet : packet;
+    this.sentBytes += typeof data === 'string' ? Buffer.byteLength(data) : data.length;
+    this.sentFrames++;
+    this.ws.send(data, { binary: typeof data !== 'string' });
+  }
+
+  dispatch(args) {
+    const [event, ...rest] = args;
+    for (const handler of this.handlers.get(event) || []) {
+      handler(...rest);
+    }
+  }
+
+  receive(data, isBinary) {
+    if (isBinary) {
+      this.pending.attachments.push(Buffer.from(data));
+      if (this.pending.attachments.length === this.pending.count) {
+        const { args, attachments } = this.pending;
+        this.pending = null;
+        this.dispatch(reconstruct(args, attachments));
+      }
+      return;
+    }
+    const text = data.toString();
+    if (text[0] === '2') {
+      this.ws.send('3' + text.slice(1));
+    } else if (text.startsWith('40')) {
+      this.onConnect?.();
+    } else if (text.startsWith('42')) {
+      this.dispatch(JSON.parse(text.slice(2)));
+    } else if (text.startsWith('45')) {
+      const dash = text.indexOf('-');
+      this.pending = { count: Number(text.slice(2, dash)), args: JSON.parse(text.slice(dash + 1)), attachments: [] };
+    }
+  }
+
+  close() {
+    this.ws.close();
+  }
+}
+
+function connect(userName) {
+  return new Promise((resolve, reject) => {
+    const ws = new WebSocket(`ws://localhost:${PORT}/socket.io/?EIO=4&transport=websocket`);
+    const socket = new LoopbackClient(ws);
+    ws.on('message', (data, isBinary) => socket.receive(data, isBinary));
+    ws.on('error', reject);
+    ws.on('open', () => ws.send('40'));
+    socket.onConnect = () => {
+      socket.emit('joinLobby', { lobbyName: LOBBY, userName });
+      socket.sentBytes = 0;
+      socket.sentFrames = 0;
+      resolve(socket);
+    };
+  });
+}
+
+function waitFor(predicate, timeoutMs = 10000) {
+  const start = Date.now();
+  return new Promise((resolve, reject) => {
+    const poll = () => {
+      if (predicate()) return resolve();
+      if (Date.now() - start > timeoutMs) return reject(new Error('timed out waiting for the relay'));
+      setTimeout(poll, 5);
+    };
+    poll();
+  });
+}
+
+const sameStroke = (a, b) => JSON.stringify(a) === JSON.stringify(b);
+
+// Batches as the manager does: the first stroke opens a window, everything stamped inside it goes together
+function batchByWindow(strokes, windowMs) {
+  const perBatch = Math.max(1, Math.floor(windowMs / STAMP_INTERVAL_MS) + 1);
+  const batches = [];
+  for (let i = 0; i < strokes.length; i += perBatch) {
+    batches.push(strokes.slice(i, i + perBatch));
+  }
+  return batches;
+}
+
+async function main() {
+  const server = await startServer();
+  const sender = await connect('Sender');
+  const receiver = await connect('Receiver');
+  // Let both joins land before anything is relayed
+  await new Promise((r) => setTimeout(r, 100));
+
+  const strokes = makeDrag(STROKE_COUNT);
+  const results = [];
+
+  try {
+    // JSON, one event per stroke
+    let jsonReceived = 0;
+    receiver.on('receiveBrushStroke', () => jsonReceived++);
+    sender.sentBytes = 0;
+    sender.sentFrames = 0;
+    for (const stroke of strokes) {
+      sender.emit('sendBrushStroke', { lobbyName: LOBBY, strokeData: toJsonStroke(stroke) });
+    }
+    await waitFor(() => jsonReceived === strokes.length);
+    results.push({ format: 'JSON, one event per stroke', events: strokes.length, bytes: sender.sentBytes, frames: sender.sentFrames });
+
+    // Binary, batched per window and then one batch per stroke for comparison
+    for (const windowMs of [BATCH_WINDOW_MS, 0]) {
+      const batches = windowMs > 0 ? batchByWindow(strokes, windowMs) : strokes.map((s) => [s]);
+      const decoded = [];
+      const relayed = [];
+      const onBatch = (payload) => {
+        relayed.push(payload);
+        decoded.push(...codec.decode(payload));
+      };
+      receiver.on('receiveBrushStrokes', onBatch);
+      sender.sentBytes = 0;
+      sender.sentFrames = 0;
+      const sent = batches.map((batch) => codec.encode(batch));
+      for (const payload of sent) {
+        sender.emit('sendBrushStrokes', { lobbyName: LOBBY, strokes: payload });
+      }
+      await waitFor(() => decoded.length === strokes.length);
+      receiver.off('receiveBrushStrokes', onBatch);
+
+      if (!sent.every((payload, i) => Buffer.compare(payload, relayed[i]) === 0)) {
+        throw new Error('relay changed a batch');
+      }
+      const mismatch = strokes.findIndex((s, i) => !sameStroke(codec.quantized(s), decoded[i]));
+      if (mismatch >= 0) {
+        throw new Error(`stroke ${mismatch} decoded differently from what was sent`);
+      }
+
+      results.push({
+        format: windowMs > 0 ? `binary, ${windowMs} ms batches (${(strokes.length / batches.length).toFixed(1)} strokes)` : 'binary, one batch per stroke',
+        events: batches.length,
+        bytes: sender.sentBytes,
+        frames: sender.sentFrames,
+        payload: sent.reduce((n, p) => n + p.length, 0)
+      });
+    }
+  } finally {
+    sender.close();
+    receiver.close();
+    server.kill();
+  }
+
+  console.log(`\n${strokes.length} strokes relayed through index.js on port ${PORT}\n`);
+  const baseline = results[0].bytes / strokes.length;
+  for (const r of results) {
+    const perStroke = r.bytes / strokes.length;
+    const payload = r.payload !== undefined ? `, codec ${(r.payload / strokes.length).toFixed(2)} B/stroke` : '';
+    console.log(`${r.format.padEnd(44)} ${String(r.events).padStart(5)} events  ${perStroke.toFixed(2).padStart(8)} B/stroke on the wire${payload}  (${(baseline / perStroke).toFixed(1)}x)`);
+  }
+}
+
+main().then(() => process.exit(0), (err) => {
+  console.error(`❌ ${err.message}`);
+  process.exit(1);
+});
@@ -0,0 +1,305 @@
+// Binary brush stroke batches, byte for byte the layout of FBrushStrokeCodec.h in the DiggerProUnreal module.
+// Keep the two in step.
+//
+// Batch:   u8 version, varuint count, then count strokes
+// Stroke:  varuint field mask, 3 x varint position delta, then each field whose mask bit is set, in bit order
+//
+// Values are quantized to fixed steps and diffed against the previous stroke of the batch (the first one
+// against the FBrushStroke defaults). Scalars are zigzag LEB128 varints, rotation axes are 16 bit.
+
+const VERSION = 1;
+const MAX_STROKES_PER_BATCH = 1024;
+
+const DISTANCE_SCALE = 10;
+const STRENGTH_SCALE = 1000;
+const ANGLE_SCALE = 100;
+const THICKNESS_SCALE = 100;
+
+const Field = {
+  Type: 1 << 0,
+  Flags: 1 << 1,
+  Radius: 1 << 2,
+  Strength: 1 << 3,
+  Falloff: 1 << 4,
+  Rotation: 1 << 5,
+  Length: 1 << 6,
+  Angle: 1 << 7,
+  Offset: 1 << 8,
+  CubeExtents: 1 << 9,
+  TorusInner: 1 << 10,
+  NumSteps: 1 << 11,
+  Wall: 1 << 12,
+  HoleAndLight: 1 << 13,
+  LightColor: 1 << 14,
+  All: (1 << 15) - 1
+};
+
+const Flag = {
+  Dig: 1 << 0,
+  HiddenSeam: 1 << 1,
+  AdvancedCube: 1 << 2,
+  Spiral: 1 << 3,
+  Filled: 1 << 4
+};
+
+// EVoxelBrushType order
+const BrushType = {
+  Cube: 0, Sphere: 1, Cone: 2, Cylinder: 3, Capsule: 4, Smooth: 5, Noise: 6, Debug: 7,
+  Custom: 8, AdvancedCube: 9, Torus: 10, Pyramid: 11, Icosphere: 12, Stairs: 13, Light: 14
+};
+
+// FBrushStroke's constructor defaults
+const DEFAULT_STROKE = Object.freeze({
+  brushType: BrushType.Sphere,
+  position: { x: 0, y: 0, z: 0 },
+  radius: 100,
+  strength: 1,
+  falloff: 0.2,
+  rotation: { pitch: 0, yaw: 0, roll: 0 },
+  length: 200,
+  angle: 0,
+  offset: { x: 0, y: 0, z: 0 },
+  dig: true,
+  hiddenSeam: false,
+  useAdvancedCube: false,
+  cubeHalfExtents: { x: 50, y: 50, z: 50 },
+  torusInnerRadius: 25,
+  numSteps: 5,
+  spiral: false,
+  filled: false,
+  wallThickness: 1.5,
+  holeShape: 0,
+  lightType: 0,
+  lightColor: { r: 255, g: 255, b: 255, a: 255 }
+});
+
+const quantize = (value, scale) => Math.round(value * scale) | 0;
+const compressAxis = (degrees) => Math.round(degrees * 65536 / 360) & 0xffff;
+const decompressAxis = (short) => short * 360 / 65536;
+const packVector = (v, scale) => [quantize(v.x, scale), quantize(v.y, scale), quantize(v.z, scale)];
+const unpackVector = (p, scale) => ({ x: p[0] / scale, y: p[1] / scale, z: p[2] / scale });
+const sameArray = (a, b) => a.length === b.length && a.every((v, i) => v === b[i]);
+
+function pack(stroke) {
+  const s = { ...DEFAULT_STROKE, ...stroke };
+  const color = s.lightColor;
+  return {
+    position: packVector(s.position, DISTANCE_SCALE),
+    type: s.brushType & 0xff,
+    flags: (s.dig ? Flag.Dig : 0) | (s.hiddenSeam ? Flag.HiddenSeam : 0) | (s.useAdvancedCube ? Flag.AdvancedCube : 0)
+      | (s.spiral ? Flag.Spiral : 0) | (s.filled ? Flag.Filled : 0),
+    radius: quantize(s.radius, DISTANCE_SCALE),
+    strength: quantize(s.strength, STRENGTH_SCALE),
+    falloff: quantize(s.falloff, DISTANCE_SCALE),
+    rotation: [compressAxis(s.rotation.pitch), compressAxis(s.rotation.yaw), compressAxis(s.rotation.roll)],
+    length: quantize(s.length, DISTANCE_SCALE),
+    angle: quantize(s.angle, ANGLE_SCALE),
+    offset: packVector(s.offset, DISTANCE_SCALE),
+    cubeExtents: packVector(s.cubeHalfExtents, DISTANCE_SCALE),
+    torusInner: quantize(s.torusInnerRadius, DISTANCE_SCALE),
+    numSteps: s.numSteps | 0,
+    wall: quantize(s.wallThickness, THICKNESS_SCALE),
+    holeShape: s.holeShape & 0xff,
+    lightType: s.lightType & 0xff,
+    lightColor: [color.r & 0xff, color.g & 0xff, color.b & 0xff, color.a & 0xff]
+  };
+}
+
+function unpack(p) {
+  return {
+    brushType: p.type,
+    position: unpackVector(p.position, DISTANCE_SCALE),
+    radius: p.radius / DISTANCE_SCALE,
+    strength: p.strength / STRENGTH_SCALE,
+    falloff: p.falloff / DISTANCE_SCALE,
+    rotation: { pitch: decompressAxis(p.rotation[0]), yaw: decompressAxis(p.rotation[1]), roll: decompressAxis(p.rotation[2]) },
+    length: p.length / DISTANCE_SCALE,
+    angle: p.angle / ANGLE_SCALE,
+    offset: unpackVector(p.offset, DISTANCE_SCALE),
+    dig: (p.flags & Flag.Dig) !== 0,
+    hiddenSeam: (p.flags & Flag.HiddenSeam) !== 0,
+    useAdvancedCube: (p.flags & Flag.AdvancedCube) !== 0,
+    cubeHalfExtents: unpackVector(p.cubeExtents, DISTANCE_SCALE),
+    torusInnerRadius: p.torusInner / DISTANCE_SCALE,
+    numSteps: p.numSteps,
+    spiral: (p.flags & Flag.Spiral) !== 0,
+    filled: (p.flags & Flag.Filled) !== 0,
+    wallThickness: p.wall / THICKNESS_SCALE,
+    holeShape: p.holeShape,
+    lightType: p.lightType,
+    lightColor: { r: p.lightColor[0], g: p.lightColor[1], b: p.lightColor[2], a: p.lightColor[3] }
+  };
+}
+
+function diffMask(p, prev) {
+  let mask = 0;
+  if (p.type !== prev.type) mask |= Field.Type;
+  if (p.flags !== prev.flags) mask |= Field.Flags;
+  if (p.radius !== prev.radius) mask |= Field.Radius;
+  if (p.strength !== prev.strength) mask |= Field.Strength;
+  if (p.falloff !== prev.falloff) mask |= Field.Falloff;
+  if (!sameArray(p.rotation, prev.rotation)) mask |= Field.Rotation;
+  if (p.length !== prev.length) mask |= Field.Length;
+  if (p.angle !== prev.angle) mask |= Field.Angle;
+  if (!sameArray(p.offset, prev.offset)) mask |= Field.Offset;
+  if (!sameArray(p.cubeExtents, prev.cubeExtents)) mask |= Field.CubeExtents;
+  if (p.torusInner !== prev.torusInner) mask |= Field.TorusInner;
+  if (p.numSteps !== prev.numSteps) mask |= Field.NumSteps;
+  if (p.wall !== prev.wall) mask |= Field.Wall;
+  if (p.holeShape !== prev.holeShape || p.lightType !== prev.lightType) mask |= Field.HoleAndLight;
+  if (!sameArray(p.lightColor, prev.lightColor)) mask |= Field.LightColor;
+  return mask;
+}
+
+class Writer {
+  constructor() {
+    this.bytes = [];
+  }
+
+  byte(value) {
+    this.bytes.push(value & 0xff);
+  }
+
+  varUInt(value) {
+    value >>>= 0;
+    while (value >= 0x80) {
+      this.bytes.push((value & 0x7f) | 0x80);
+      value >>>= 7;
+    }
+    this.bytes.push(value);
+  }
+
+  varInt(value) {
+    this.varUInt(((value << 1) ^ (value >> 31)) >>> 0);
+  }
+
+  varInt3(values) {
+    values.forEach((v) => this.varInt(v));
+  }
+}
+
+class Reader {
+  constructor(buffer) {
+    this.buffer = buffer;
+    this.offset = 0;
+  }
+
+  byte() {
+    if (this.offset >= this.buffer.length) {
+      throw new Error('stroke batch truncated');
+    }
+    return this.buffer[this.offset++];
+  }
+
+  varUInt() {
+    let value = 0;
+    for (let shift = 0; shift < 35; shift += 7) {
+      const b = this.byte();
+      value = (value | ((b & 0x7f) << shift)) >>> 0;
+      if ((b & 0x80) === 0) {
+        return value;
+      }
+    }
+    throw new Error('stroke batch varint too long');
+  }
+
+  varInt() {
+    const raw = this.varUInt();
+    return (raw >>> 1) ^ -(raw & 1);
+  }
+
+  varInt3() {
+    return [this.varInt(), this.varInt(), this.varInt()];
+  }
+}
+
+function encode(strokes) {
+  const count = Math.min(strokes.length, MAX_STROKES_PER_BATCH);
+  const w = new Writer();
+  w.byte(VERSION);
+  w.varUInt(count);
+
+  let prev = pack(DEFAULT_STROKE);
+  for (let i = 0; i < count; i++) {
+    const p = pack(strokes[i]);
+    const mask = diffMask(p, prev);
+    w.varUInt(mask);
+    for (let axis = 0; axis < 3; axis++) {
+      w.varInt((p.position[axis] - prev.position[axis]) | 0);
+    }
+
+    if (mask & Field.Type) w.byte(p.type);
+    if (mask & Field.Flags) w.byte(p.flags);
+    if (mask & Field.Radius) w.varInt(p.radius);
+    if (mask & Field.Strength) w.varInt(p.strength);
+    if (mask & Field.Falloff) w.varInt(p.falloff);
+    if (mask & Field.Rotation) p.rotation.forEach((axis) => { w.byte(axis & 0xff); w.byte(axis >> 8); });
+    if (mask & Field.Length) w.varInt(p.length);
+    if (mask & Field.Angle) w.varInt(p.angle);
+    if (mask & Field.Offset) w.varInt3(p.offset);
+    if (mask & Field.CubeExtents) w.varInt3(p.cubeExtents);
+    if (mask & Field.TorusInner) w.varInt(p.torusInner);
+    if (mask & Field.NumSteps) w.varInt(p.numSteps);
+    if (mask & Field.Wall) w.varInt(p.wall);
+    if (mask & Field.HoleAndLight) { w.byte(p.holeShape); w.byte(p.lightType); }
+    if (mask & Field.LightColor) p.lightColor.forEach((c) => w.byte(c));
+
+    prev = p;
+  }
+  return Buffer.from(w.bytes);
+}
+
+// Throws on anything FBrushStrokeCodec::Decode would reject
+function decode(buffer) {
+  const r = new Reader(buffer);
+  if (r.byte() !== VERSION) {
+    throw new Error('unknown stroke batch version');
+  }
+  const count = r.varUInt();
+  if (count > MAX_STROKES_PER_BATCH) {
+    throw new Error('stroke batch too large');
+  }
+
+  const strokes = [];
+  const cur = pack(DEFAULT_STROKE);
+  for (let i = 0; i < count; i++) {
+    const mask = r.varUInt();
+    if (mask & ~Field.All) {
+      throw new Error('unknown stroke fields');
+    }
+    for (let axis = 0; axis < 3; axis++) {
+      cur.position[axis] = (cur.position[axis] + r.varInt()) | 0;
+    }
+
+    if (mask & Field.Type) cur.type = r.byte();
+    if (mask & Field.Flags) cur.flags = r.byte();
+    if (mask & Field.Radius) cur.radius = r.varInt();
+    if (mask & Field.Strength) cur.strength = r.varInt();
+    if (mask & Field.Falloff) cur.falloff = r.varInt();
+    if (mask & Field.Rotation) cur.rotation = [0, 1, 2].map(() => r.byte() | (r.byte() << 8));
+    if (mask & Field.Length) cur.length = r.varInt();
+    if (mask & Field.Angle) cur.angle = r.varInt();
+    if (mask & Field.Offset) cur.offset = r.varInt3();
+    if (mask & Field.CubeExtents) cur.cubeExtents = r.varInt3();
+    if (mask & Field.TorusInner) cur.torusInner = r.varInt();
+    if (mask & Field.NumSteps) cur.numSteps = r.varInt();
+    if (mask & Field.Wall) cur.wall = r.varInt();
+    if (mask & Field.HoleAndLight) { cur.holeShape = r.byte(); cur.lightType = r.byte(); }
+    if (mask & Field.LightColor) cur.lightColor = [r.byte(), r.byte(), r.byte(), r.byte()];
+
+    if (cur.type > BrushType.Light || cur.holeShape > 8 || cur.lightType > 2) {
+      throw new Error('unknown stroke enum value');
+    }
+    strokes.push(unpack(cur));
+  }
+
+  if (r.offset !== buffer.length) {
+    throw new Error('trailing bytes after stroke batch');
+  }
+  return strokes;
+}
+
+// What every receiver sees for this stroke
+const quantized = (stroke) => unpack(pack(stroke));
+
+module.exports = { VERSION, MAX_STROKES_PER_BATCH, BrushType, DEFAULT_STROKE, encode, decode, quantized };